@@ -259,6 +259,56 @@ int ObNumber::from_(const uint64_t value, IAllocator &allocator)
   return from_integer_(value, allocator);
 }
 
+int ObNumber::from_scaled_int128_(const __int128_t value, const int64_t frag_len, IAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(frag_len < 0 || frag_len > SCALED_INT128_MAX_DIGITS)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid fragment length", K(ret), K(frag_len));
+  } else if (0 == value) {
+    set_zero();
+  } else {
+    // int128 has at most 5 digits, digits are filled from the lowest one
+    uint32_t digits[SCALED_INT128_MAX_DIGITS + 1] = {0};
+    unsigned __int128 abs_val = value < 0
+        ? -static_cast<unsigned __int128>(value) : static_cast<unsigned __int128>(value);
+    int64_t cnt = 0;
+    while (abs_val > 0) {
+      digits[cnt++] = static_cast<uint32_t>(abs_val % BASE);
+      abs_val /= BASE;
+    }
+    int64_t tail_zero_cnt = 0;
+    while (0 == digits[tail_zero_cnt]) {
+      ++tail_zero_cnt;
+    }
+    const int64_t len = cnt - tail_zero_cnt;
+    const int64_t exp = cnt - 1 - frag_len;
+    Desc desc;
+    desc.exp_ = ((uint8_t)exp + EXP_ZERO) & 0x7f;
+    if (value > 0) {
+      desc.sign_ = POSITIVE;
+    } else {
+      desc.sign_ = NEGATIVE;
+      desc.exp_ = 0x7f & (~desc.exp_);
+      ++desc.exp_;
+    }
+    desc.len_ = static_cast<uint8_t>(len);
+    desc.reserved_ = 0;
+
+    uint32_t *digit_mem = NULL;
+    if (OB_ISNULL(digit_mem = (uint32_t *)allocator.alloc(sizeof(uint32_t) * len))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("fail to alloc obnumber digit memory", K(ret), K(len));
+    } else {
+      for (int64_t i = 0; i < len; ++i) {
+        digit_mem[i] = digits[cnt - 1 - i];
+      }
+      assign(desc.desc_, digit_mem);
+    }
+  }
+  return ret;
+}
+
 int ObNumber::from_(const char *str, IAllocator &allocator, int16_t *precision, int16_t *scale, const bool do_rounding)
 {
   int ret = OB_SUCCESS;
@@ -186,6 +186,10 @@ public:
   static const int64_t MIN_SCI_SIZE = -130;    /* compatible with Oracle */
   static const int64_t SCI_NUMBER_LENGTH = 40;
   static const int64_t MAX_FAST_SUM_AGG_NUMBER_LENGTH = 25 + MAX_APPEND_LEN;
+  // fixed-width decimal fast path: number is stored as int128 value * BASE^(-frag_len),
+  // at most 4 digits (BASE^4 < 2^127) are used to keep the value in int128.
+  static const int64_t SCALED_INT128_FRAG_LEN = 1;
+  static const int64_t SCALED_INT128_MAX_DIGITS = 4;
   static const int POSITIVE_EXP_BOUNDARY = 0xc0;
   static const int NEGATIVE_EXP_BOUNDARY = 0x40;
   static const int MIN_ROUND_DIGIT_COUNT[];//8/4
@@ -258,6 +262,8 @@ public:
   int from(const uint32_t desc, const ObCalcVector &vector, T &allocator);
   template <class T>
   int from(const ObNumber &other, T &allocator);
+  template <class T>
+  int from_scaled_int128(const __int128_t value, const int64_t frag_len, T &allocator);
   inline void shadow_copy(const ObNumber &other);
   int deep_copy(const ObNumber &other, IAllocator &allocator);
   int deep_copy_v3(const ObNumber &other, ObIAllocator &allocator);
@@ -464,6 +470,8 @@ public:
   {
     return get_max_format_length() > ObNumber::MAX_FAST_SUM_AGG_NUMBER_LENGTH;
   }
+  // return false if number can not be represented as scaled int128 with @frag_len fragments
+  OB_INLINE bool to_scaled_int128(const int64_t frag_len, __int128_t &value) const;
   inline int64_t get_deep_copy_size() const
   {
     return sizeof(int32_t) + (is_zero() ?  0 : d_.len_ * sizeof(int32_t));
@@ -563,6 +571,7 @@ protected:
   int from_integer_(IntegerT integer_val, IAllocator &allocator);
   int from_(const int64_t value, IAllocator &allocator);
   int from_(const uint64_t value, IAllocator &allocator);
+  int from_scaled_int128_(const __int128_t value, const int64_t frag_len, IAllocator &allocator);
   int from_(const char *str,
             IAllocator &allocator,
             int16_t *precision = NULL,
@@ -1519,6 +1528,13 @@ int ObNumber::from(const uint64_t value, T &allocator)
   return from_(value, ta);
 }
 
+template <class T>
+int ObNumber::from_scaled_int128(const __int128_t value, const int64_t frag_len, T &allocator)
+{
+  TAllocator<T> ta(allocator);
+  return from_scaled_int128_(value, frag_len, ta);
+}
+
 template <class T>
 int ObNumber::from(const char *str, T &allocator, int16_t *precision, int16_t *scale, const bool do_rounding)
 {
@@ -3115,6 +3131,32 @@ inline int32_t ObNumber::get_decode_exp(const ObNumber::Desc &desc)
   return (POSITIVE == desc.sign_ ? (desc.se_ - POSITIVE_EXP_BOUNDARY) : (NEGATIVE_EXP_BOUNDARY - desc.se_));
 }
 
+OB_INLINE bool ObNumber::to_scaled_int128(const int64_t frag_len, __int128_t &value) const
+{
+  bool bret = true;
+  value = 0;
+  if (is_zero()) {
+    // do nothing
+  } else {
+    const int64_t exp = get_decode_exp(d_);
+    const int64_t len = d_.len_;
+    if (exp - (len - 1) + frag_len < 0 || exp + frag_len >= SCALED_INT128_MAX_DIGITS) {
+      // lowest digit is not integral after scaling, or highest digit may overflow
+      bret = false;
+    } else {
+      __int128_t v = 0;
+      for (int64_t i = 0; i < len; ++i) {
+        v = v * BASE + digits_[i];
+      }
+      for (int64_t i = exp - (len - 1) + frag_len; i > 0; --i) {
+        v *= BASE;
+      }
+      value = is_negative() ? -v : v;
+    }
+  }
+  return bret;
+}
+
 inline bool ObNumber::is_integer(const int32_t expr_value) const
 {
   bool bret = false;
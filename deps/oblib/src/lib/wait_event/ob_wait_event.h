@@ -398,6 +398,7 @@ WAIT_EVENT_DEF(LS_ARCHIVE_TASK_LOCK_WAIT, 19013, "latch: ls archive task lock wa
 WAIT_EVENT_DEF(ARCHIVE_ROUND_MGR_LOCK_WAIT, 19014, "latch: archive round mgr lock wait", "", "", "", CONCURRENCY, "latch: archive round mgr lock wait", true)
 WAIT_EVENT_DEF(ARCHIVE_PERSIST_MGR_LOCK_WAIT, 19015, "latch: archive persist mgr lock wait", "", "", "", CONCURRENCY, "latch: archive persist mgr lock wait", true)
 WAIT_EVENT_DEF(ARCHIVE_TASK_QUEUE_LOCK_WAIT, 19016, "latch: archive task queue lock wait", "", "", "", CONCURRENCY, "latch: archive task queue lock wait", true)
+WAIT_EVENT_DEF(PALF_HOT_CACHE_LOCK_WAIT, 19017, "latch: palf hot cache lock wait", "", "", "", CONCURRENCY, "latch: palf hot cache lock wait", true)
 
 // sleep
 WAIT_EVENT_DEF(BANDWIDTH_THROTTLE_SLEEP, 20000, "sleep: bandwidth throttle sleep wait", "sleep_interval", "", "", CONCURRENCY, "sleep: bandwidth throttle sleep wait", true)
@@ -610,9 +610,13 @@ private:
 class ObSqlNioImpl
 {
 public:
+  // accept at most this many connections in one round, so that a connection storm
+  // does not starve the io of the established connections on this thread
+  static const int ACCEPT_BATCH_SIZE = 64;
   ObSqlNioImpl(ObISqlSockHandler& handler):
     handler_(handler), epfd_(-1), lfd_(-1), tcp_keepalive_enabled_(0),
-    tcp_keepidle_(0), tcp_keepintvl_(0), tcp_keepcnt_(0) {}
+    tcp_keepidle_(0), tcp_keepintvl_(0), tcp_keepcnt_(0), busy_poll_time_(0),
+    last_event_time_(0), sock_cnt_(0) {}
   ~ObSqlNioImpl() {
     destroy();
   }
@@ -729,6 +733,8 @@ public:
       }
     }
   }
+  void set_busy_poll_time(int64_t busy_poll_time) { ATOMIC_STORE(&busy_poll_time_, busy_poll_time); }
+  int64_t get_sock_cnt() const { return ATOMIC_LOAD(&sock_cnt_); }
   void update_tcp_keepalive_params(int keepalive_enabled, uint32_t tcp_keepidle, uint32_t tcp_keepintvl, uint32_t tcp_keepcnt) {
     tcp_keepalive_enabled_ = keepalive_enabled;
     tcp_keepidle_ = tcp_keepidle;
@@ -753,7 +759,18 @@ private:
   void handle_epoll_event() {
     const int maxevents = 512;
     struct epoll_event events[maxevents];
-    int cnt = epoll_wait(epfd_, events, maxevents, 1000);
+    // busy poll: keep polling without sleep for busy_poll_time_ after the last event,
+    // which saves the wakeup latency of the thread when requests come continuously
+    int timeout = 1000;
+    const int64_t busy_poll_time = ATOMIC_LOAD(&busy_poll_time_);
+    if (busy_poll_time > 0
+        && ObTimeUtility::fast_current_time() - last_event_time_ < busy_poll_time) {
+      timeout = 0;
+    }
+    int cnt = epoll_wait(epfd_, events, maxevents, timeout);
+    if (busy_poll_time > 0 && cnt > 0) {
+      last_event_time_ = ObTimeUtility::fast_current_time();
+    }
     for(int i = 0; i < cnt; i++) {
       ObSqlSock* s = (ObSqlSock*)events[i].data.ptr;
       if (OB_UNLIKELY(NULL == s)) {
@@ -866,7 +883,8 @@ private:
   }
 
   void do_accept_loop() {
-    while(1){
+    // listen fd is level triggered, the rest connections are accepted in next rounds
+    for (int i = 0; i < ACCEPT_BATCH_SIZE; i++) {
       int fd = -1;
       if ((fd = accept4(lfd_, NULL, NULL, SOCK_NONBLOCK|SOCK_CLOEXEC)) < 0) {
         if (EAGAIN == errno || EWOULDBLOCK == errno) {
@@ -901,7 +919,6 @@ private:
     if (0 != err) {
       if (NULL != s) {
         ObSqlSockSession* sess = (ObSqlSockSession *)s->sess_;
-        remove_session_info(s);
         if (sess->is_inited()) {
           /*
            * if ObSqlSockSession is inited, ObSMConnection and ObSqlSockSession
@@ -938,9 +955,11 @@ private:
   }
   void record_session_info(ObSqlSock *& s) {
     all_list_.add(&s->all_list_link_);
+    ATOMIC_INC(&sock_cnt_);
   }
   void remove_session_info(ObSqlSock *& s) {
     all_list_.del(&s->all_list_link_);
+    ATOMIC_DEC(&sock_cnt_);
   }
 
   void update_tcp_keepalive_parameters() {
@@ -1000,6 +1019,9 @@ private:
   uint32_t tcp_keepidle_;
   uint32_t tcp_keepintvl_;
   uint32_t tcp_keepcnt_;
+  int64_t busy_poll_time_;
+  int64_t last_event_time_;
+  int64_t sock_cnt_;
 };
 
 int ObSqlNio::start(int port, ObISqlSockHandler *handler, int n_thread,
@@ -1161,6 +1183,8 @@ int ObSqlNio::set_thread_count(const int n_thread)
         new (impl_ + i) ObSqlNioImpl(*handler_);
         if (OB_FAIL(impl_[i].init(port_))) {
           LOG_WARN("impl init fail");
+        } else {
+          impl_[i].set_busy_poll_time(busy_poll_time_);
         }
       }
       if (OB_SUCC(ret)) {
@@ -1178,12 +1202,40 @@ int ObSqlNio::regist_sess(void *sess)
 {
   int err = 0;
   ((ObSqlSockSession *)sess)->nio_ = this;
-  if (0 != (err = impl_[get_dispatch_idx()].regist_sess(sess))) {
+  if (0 != (err = impl_[get_balanced_idx()].regist_sess(sess))) {
     LOG_ERROR_RET(OB_ERR_SYS, "regist sess fd fail", K(err));
   }
   return err;
 }
 
+uint64_t ObSqlNio::get_balanced_idx()
+{
+  // start from the round robin index, and choose the thread with the least sockets
+  const int n_thread = get_thread_count();
+  const uint64_t start = get_dispatch_idx();
+  uint64_t idx = start;
+  int64_t min_cnt = impl_[idx].get_sock_cnt();
+  for (int i = 1; i < n_thread && min_cnt > 0; i++) {
+    const uint64_t cur = (start + i) % n_thread;
+    const int64_t cnt = impl_[cur].get_sock_cnt();
+    if (cnt < min_cnt) {
+      min_cnt = cnt;
+      idx = cur;
+    }
+  }
+  return idx;
+}
+
+void ObSqlNio::set_busy_poll_time(int64_t busy_poll_time)
+{
+  if (NULL != impl_) {
+    for (int i = 0; i < get_thread_count(); i++) {
+      impl_[i].set_busy_poll_time(busy_poll_time);
+    }
+  }
+  busy_poll_time_ = busy_poll_time;
+}
+
 void ObSqlNio::update_tcp_keepalive_params(int keepalive_enabled, uint32_t tcp_keepidle, uint32_t tcp_keepintvl, uint32_t tcp_keepcnt)
 {
   int thread_count = get_thread_count();
@@ -30,7 +30,7 @@ class ObSqlNio: public lib::Threads
 public:
   ObSqlNio()
       : impl_(NULL), port_(0), handler_(NULL), dispatch_idx_(0),
-        tenant_id_(common::OB_INVALID_ID) {}
+        tenant_id_(common::OB_INVALID_ID), busy_poll_time_(0) {}
   virtual ~ObSqlNio() {}
   int start(int port, ObISqlSockHandler *handler, int n_thread,
             const uint64_t tenant_id);
@@ -58,15 +58,19 @@ public:
     return ATOMIC_FAA(&dispatch_idx_, 1) % get_thread_count();
   }
   void update_tcp_keepalive_params(int keepalive_enabled, uint32_t tcp_keepidle, uint32_t tcp_keepintvl, uint32_t tcp_keepcnt);
+  // time in us to poll without sleep after the last io event, 0 means disabled
+  void set_busy_poll_time(int64_t busy_poll_time);
   int write_handshake_packet(void* sess, const char* buf, int64_t sz);
 private:
   void run(int64_t idx);
+  uint64_t get_balanced_idx();
 private:
   ObSqlNioImpl* impl_;
   int port_;
   ObISqlSockHandler* handler_;
   uint64_t dispatch_idx_;
   uint64_t tenant_id_;
+  int64_t busy_poll_time_;
 };
 extern int sql_nio_add_cgroup(const uint64_t tenant_id);
 }; // end namespace obmysql
@@ -59,6 +59,11 @@ void ObSqlNioServer::update_tcp_keepalive_params(int keepalive_enabled, uint32_t
   nio_.update_tcp_keepalive_params(keepalive_enabled, tcp_keepidle, tcp_keepintvl, tcp_keepcnt);
 }
 
+void ObSqlNioServer::set_busy_poll_time(int64_t busy_poll_time)
+{
+  nio_.set_busy_poll_time(busy_poll_time);
+}
+
 ObSqlNioServer* global_sql_nio_server = NULL;
 }; // end namespace obmysql
 }; // end namespace oceanbase
@@ -40,6 +40,7 @@ public:
   void wait();
   void destroy();
   void update_tcp_keepalive_params(int keepalive_enabled, uint32_t tcp_keepidle, uint32_t tcp_keepintvl, uint32_t tcp_keepcnt);
+  void set_busy_poll_time(int64_t busy_poll_time);
 private:
   ObSqlSockProcessor thread_processor_; // for tenant worker
   ObSqlSockHandler io_handler_; // for io thread
@@ -3973,6 +3973,48 @@ TEST(ObNumber, int64_conversion)
   ASSERT_EQ(OB_INTEGER_PRECISION_OVERFLOW, num.cast_to_int64(to_int));
 }
 
+TEST(ObNumber, scaled_int128_conversion)
+{
+  const int64_t MAX_BUF_SIZE = 256;
+  char buf_alloc[MAX_BUF_SIZE];
+  ObDataBuffer allocator(buf_alloc, MAX_BUF_SIZE);
+  const int64_t frag_len = number::ObNumber::SCALED_INT128_FRAG_LEN;
+  const char *strs[] = {"0", "1", "-1", "0.5", "-0.000000001", "1234567890.12", "-9876543210987.654",
+      "999999999999999999999999999.999999999", "100000000000000000000000000"};
+  number::ObNumber num;
+  number::ObNumber res;
+  __int128_t value = 0;
+  for (int64_t i = 0; i < ARRAYSIZEOF(strs); ++i) {
+    allocator.free();
+    ASSERT_EQ(OB_SUCCESS, num.from(strs[i], allocator));
+    ASSERT_TRUE(num.to_scaled_int128(frag_len, value));
+    ASSERT_EQ(OB_SUCCESS, res.from_scaled_int128(value, frag_len, allocator));
+    ASSERT_EQ(0, num.compare(res)) << strs[i];
+  }
+
+  // sum of scaled values
+  allocator.free();
+  __int128_t sum = 0;
+  ASSERT_EQ(OB_SUCCESS, num.from("1234567890.12", allocator));
+  ASSERT_TRUE(num.to_scaled_int128(frag_len, value));
+  sum += value;
+  ASSERT_EQ(OB_SUCCESS, num.from("-0.02", allocator));
+  ASSERT_TRUE(num.to_scaled_int128(frag_len, value));
+  sum += value;
+  ASSERT_EQ(OB_SUCCESS, res.from_scaled_int128(sum, frag_len, allocator));
+  ASSERT_EQ(OB_SUCCESS, num.from("1234567890.1", allocator));
+  ASSERT_EQ(0, num.compare(res));
+
+  // more fragment digits than frag_len
+  allocator.free();
+  ASSERT_EQ(OB_SUCCESS, num.from("0.0000000001", allocator));
+  ASSERT_FALSE(num.to_scaled_int128(frag_len, value));
+  // too many integer digits for int128
+  allocator.free();
+  ASSERT_EQ(OB_SUCCESS, num.from("1000000000000000000000000000", allocator));
+  ASSERT_FALSE(num.to_scaled_int128(frag_len, value));
+}
+
 TEST(ObNumber, arithmetic_cmp)
 {
   const int64_t MAX_TEST_COUNT  = 100;
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX RPC
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include "lib/time/ob_time_utility.h"
+#include "rpc/obmysql/ob_sql_nio.h"
+#include "rpc/obmysql/ob_i_sql_sock_handler.h"
+#include "rpc/obmysql/ob_i_sm_conn_callback.h"
+#include "rpc/obmysql/ob_sql_sock_session.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+using namespace std;
+
+// Micro benchmark of the sql socket layer. ObSqlNio is driven by an echo handler
+// in the io threads, and local fake clients open short connections, each sends
+// some fixed size requests and waits for the responses, which simulates the
+// connection storm after a proxy restart.
+//
+//   ./sql_nio_bench [-t io_thread] [-c client_thread] [-n conn_per_client]
+//                   [-r req_per_conn] [-b busy_poll_us] [-p port]
+
+int io_thread_count = 4;
+int client_count = 8;
+int conn_per_client = 200;
+int req_per_conn = 10;
+int64_t busy_poll_time = 0;
+int port = 0;
+
+static const int64_t REQ_SIZE = 64;
+static const int64_t RESP_SIZE = 256;
+
+int64_t total_conn_count = 0;
+int64_t total_req_count = 0;
+int64_t total_fail_count = 0;
+
+class FakeConnCallback: public ObISMConnectionCallback
+{
+public:
+  virtual int init(ObSqlSockSession& sess, observer::ObSMConnection& conn) override
+  {
+    UNUSED(sess);
+    UNUSED(conn);
+    return OB_SUCCESS;
+  }
+  virtual void destroy(observer::ObSMConnection& conn) override { UNUSED(conn); }
+  virtual int on_disconnect(observer::ObSMConnection& conn) override
+  {
+    UNUSED(conn);
+    return OB_SUCCESS;
+  }
+};
+
+// answer each request in the io thread, without tenant worker
+class EchoHandler: public ObISqlSockHandler
+{
+public:
+  EchoHandler(ObISMConnectionCallback& conn_cb, ObSqlNio& nio): conn_cb_(conn_cb), nio_(nio)
+  {
+    memset(resp_, 'r', sizeof(resp_));
+  }
+  virtual int on_connect(void* sess, int fd) override
+  {
+    UNUSED(fd);
+    new(sess)ObSqlSockSession(conn_cb_, &nio_);
+    return OB_SUCCESS;
+  }
+  virtual int on_readable(void* udata) override
+  {
+    int ret = OB_SUCCESS;
+    ObSqlSockSession* sess = (ObSqlSockSession*)udata;
+    const char* buf = NULL;
+    int64_t sz = 0;
+    if (OB_FAIL(sess->peek_data(REQ_SIZE, buf, sz))) {
+      LOG_WARN("peek data fail", K(ret));
+    } else if (sz < REQ_SIZE) {
+      sess->revert_sock();
+    } else if (OB_FAIL(sess->consume_data(REQ_SIZE))) {
+      LOG_WARN("consume data fail", K(ret));
+    } else if (OB_FAIL(sess->write_data(resp_, RESP_SIZE))) {
+      LOG_WARN("write data fail", K(ret));
+    } else {
+      sess->revert_sock();
+    }
+    return ret;
+  }
+  virtual void on_close(void* sess, int err) override
+  {
+    UNUSED(err);
+    ((ObSqlSockSession*)sess)->destroy();
+  }
+  virtual void on_flushed(void* sess) override
+  {
+    ((ObSqlSockSession*)sess)->on_flushed();
+  }
+private:
+  ObISMConnectionCallback& conn_cb_;
+  ObSqlNio& nio_;
+  char resp_[RESP_SIZE];
+};
+
+static bool full_io(int fd, char* buf, int64_t sz, bool is_read)
+{
+  int64_t pos = 0;
+  while (pos < sz) {
+    int64_t bytes = is_read ? read(fd, buf + pos, sz - pos) : write(fd, buf + pos, sz - pos);
+    if (bytes > 0) {
+      pos += bytes;
+    } else if (bytes < 0 && EINTR == errno) {
+    } else {
+      break;
+    }
+  }
+  return pos == sz;
+}
+
+void run_client()
+{
+  char req[REQ_SIZE];
+  char resp[RESP_SIZE];
+  memset(req, 'q', sizeof(req));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(static_cast<uint16_t>(port));
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  for (int i = 0; i < conn_per_client; i++) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int nodelay = 1;
+    bool succ = fd >= 0
+        && 0 == setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay))
+        && 0 == connect(fd, (struct sockaddr*)&addr, sizeof(addr));
+    for (int j = 0; succ && j < req_per_conn; j++) {
+      succ = full_io(fd, req, REQ_SIZE, false) && full_io(fd, resp, RESP_SIZE, true);
+      if (succ) {
+        ATOMIC_INC(&total_req_count);
+      }
+    }
+    if (succ) {
+      ATOMIC_INC(&total_conn_count);
+    } else {
+      ATOMIC_INC(&total_fail_count);
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int ret = OB_SUCCESS;
+  int c = 0;
+  OB_LOGGER.set_log_level("ERROR");
+  OB_LOGGER.set_file_name("sql_nio_bench.log", true);
+  while(-1 != (c = getopt(argc, argv, "t:c:n:r:b:p:"))) {
+    switch(c) {
+      case 't': io_thread_count = atoi(optarg); break;
+      case 'c': client_count = atoi(optarg); break;
+      case 'n': conn_per_client = atoi(optarg); break;
+      case 'r': req_per_conn = atoi(optarg); break;
+      case 'b': busy_poll_time = atoll(optarg); break;
+      case 'p': port = atoi(optarg); break;
+      default:
+        printf("usage: %s [-t io_thread] [-c client_thread] [-n conn_per_client] "
+               "[-r req_per_conn] [-b busy_poll_us] [-p port]\n", argv[0]);
+        return 1;
+    }
+  }
+  if (0 == port) {
+    port = 20000 + getpid() % 20000;
+  }
+  FakeConnCallback conn_cb;
+  ObSqlNio nio;
+  EchoHandler handler(conn_cb, nio);
+  if (OB_FAIL(nio.start(port, &handler, io_thread_count, OB_INVALID_ID))) {
+    cout << "sql nio start fail, ret=" << ret << ", port=" << port << endl;
+  } else {
+    nio.set_busy_poll_time(busy_poll_time);
+    int64_t start_ts = ObTimeUtility::current_time();
+    vector<thread> clients;
+    for (int i = 0; i < client_count; i++) {
+      clients.push_back(thread(run_client));
+    }
+    for (int i = 0; i < client_count; i++) {
+      clients[i].join();
+    }
+    int64_t cost = ObTimeUtility::current_time() - start_ts;
+    cout << "io_thread: " << io_thread_count << ", client: " << client_count
+         << ", busy_poll_us: " << busy_poll_time << endl;
+    cout << "conn: " << total_conn_count << ", req: " << total_req_count
+         << ", fail: " << total_fail_count << ", cost(us): " << cost << endl;
+    cout << "conn/s: " << (double)total_conn_count * 1000000 / (double)cost
+         << ", req/s: " << (double)total_req_count * 1000000 / (double)cost << endl;
+    nio.stop();
+    nio.wait();
+    nio.destroy();
+    if (0 != total_fail_count) {
+      ret = OB_ERR_UNEXPECTED;
+    }
+  }
+  return OB_SUCCESS == ret ? 0 : 1;
+}
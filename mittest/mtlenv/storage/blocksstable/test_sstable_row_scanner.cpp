@@ -17,6 +17,8 @@
 #include "lib/random/ob_random.h"
 #include "storage/access/ob_index_tree_prefetcher.h"
 #include "storage/access/ob_sstable_row_scanner.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
 #include "ob_index_block_data_prepare.h"
 
 namespace oceanbase
@@ -313,6 +315,80 @@ TEST_F(TestSSTableRowScanner, test_border)
   ObMallocAllocator::get_instance()->print_tenant_memory_usage(1);
 }
 
+TEST_F(TestSSTableRowScanner, test_skip_index_with_incremental_border)
+{
+  ObDatumRange range;
+  ObSSTableRowScanner scanner;
+  const ObDatumRow *prow = nullptr;
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, TEST_COLUMN_CNT));
+  prepare_query_param(false, tablet_handle_.get_obj()->get_full_read_info());
+  range.set_whole_range();
+  ASSERT_EQ(OB_SUCCESS, scanner.inner_open(iter_param_, context_, &sstable_, &range));
+  ASSERT_EQ(OB_SUCCESS, scanner.inner_get_next_row(prow));
+
+  // rowkey column is never null, so "c0 is null" could skip every block by skip index
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  sql::ObPushdownWhiteFilterNode filter_node(allocator_);
+  filter_node.op_type_ = sql::WHITE_OP_NU;
+  sql::ObWhiteFilterExecutor filter(allocator_, filter_node, op);
+  const ObColumnParam *col_param = nullptr;
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.push_back(0));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.push_back(col_param));
+  filter.n_cols_ = 1;
+  iter_param_.pushdown_filter_ = &filter;
+  iter_param_.pd_filter_ = 1;
+
+  ObIndexTreeMultiPassPrefetcher &prefetcher = scanner.prefetcher_;
+  const int64_t start_idx = prefetcher.cur_micro_data_fetch_idx_ + 1;
+  const int64_t end_idx = prefetcher.micro_data_prefetch_idx_;
+  ASSERT_GT(end_idx - start_idx, 3);
+  bool can_skip = false;
+  // no incremental border checked yet, blocks may be fused with incremental rows
+  for (int64_t i = start_idx; i < end_idx; ++i) {
+    ObMicroIndexInfo &info = prefetcher.micro_data_infos_[i % prefetcher.max_micro_handle_cnt_];
+    ASSERT_EQ(OB_SUCCESS, prefetcher.check_skip_by_skip_index(info, can_skip));
+    ASSERT_FALSE(can_skip) << i;
+  }
+
+  // incremental rows start from the end key of the middle block
+  const int64_t mid_idx = (start_idx + end_idx) / 2;
+  ObDatumRowkey border_rowkey;
+  ASSERT_EQ(OB_SUCCESS, prefetcher.micro_data_infos_[mid_idx % prefetcher.max_micro_handle_cnt_]
+            .endkey_->deep_copy(border_rowkey, allocator_));
+  ASSERT_EQ(OB_SUCCESS, prefetcher.refresh_blockscan_checker(start_idx, border_rowkey));
+  int64_t skip_cnt = 0;
+  for (int64_t i = start_idx; i < end_idx; ++i) {
+    ObMicroIndexInfo &info = prefetcher.micro_data_infos_[i % prefetcher.max_micro_handle_cnt_];
+    ASSERT_EQ(OB_SUCCESS, prefetcher.check_skip_by_skip_index(info, can_skip));
+    if (i >= mid_idx) {
+      ASSERT_FALSE(info.can_blockscan(false)) << i;
+      ASSERT_FALSE(can_skip) << i;
+    } else if (can_skip) {
+      ASSERT_TRUE(info.can_blockscan(false)) << i;
+      ++skip_cnt;
+    }
+  }
+  ASSERT_GT(skip_cnt, 0);
+
+  // blocks after the border are not skipped by later prefetch, all rows are still returned
+  for (int64_t i = 1; i < row_cnt_; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    ASSERT_EQ(OB_SUCCESS, scanner.inner_get_next_row(prow)) << i;
+    ASSERT_TRUE(row == *prow) << i << " prow: " << prow;
+  }
+  ASSERT_EQ(OB_ITER_END, scanner.inner_get_next_row(prow));
+  iter_param_.pushdown_filter_ = nullptr;
+  iter_param_.pd_filter_ = 0;
+  scanner.reset();
+  destroy_query_param();
+}
+
 TEST_F(TestSSTableRowScanner, test_random)
 {
   ObDatumRange range;
@@ -315,6 +315,18 @@ public:
     }
   }
 
+  void elr_txn(ObStoreCtx *store_ctx,
+               const int64_t commit_version)
+  {
+    share::SCN commit_scn;
+    commit_scn.convert_for_tx(commit_version);
+    ObPartTransCtx *tx_ctx = store_ctx->mvcc_acc_ctx_.tx_ctx_;
+    ObMemtableCtx *mt_ctx = store_ctx->mvcc_acc_ctx_.mem_ctx_;
+    tx_ctx->ctx_tx_data_.set_commit_version(commit_scn);
+    tx_ctx->ctx_tx_data_.set_state(ObTxData::ELR_COMMIT);
+    EXPECT_EQ(OB_SUCCESS, mt_ctx->elr_trans_preparing());
+  }
+
   void abort_txn(ObStoreCtx *store_ctx,
                  const bool need_write_back = false)
   {
@@ -3063,6 +3075,138 @@ TEST_F(TestMemtableV2, test_parallel_lock_with_same_txn)
 }
 
 
+TEST_F(TestMemtableV2, test_elr_cascading_abort)
+{
+  ObMemtable *memtable = create_memtable();
+
+  TRANS_LOG(INFO, "######## CASE1: txn1 write row and release lock early");
+  ObDatumRowkey rowkey;
+  ObStoreRow write_row;
+  EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                 2, /*value*/
+                                 rowkey,
+                                 write_row));
+  ObTransID write_tx_id = ObTransID(1);
+  ObStoreCtx *wtx = start_tx(write_tx_id);
+  write_tx(wtx,
+           memtable,
+           1000, /*snapshot version*/
+           write_row);
+  elr_txn(wtx, 1500 /*commit version*/);
+  EXPECT_TRUE(get_tx_last_tnode(wtx)->is_elr());
+  EXPECT_FALSE(get_tx_last_tnode(wtx)->is_committed());
+
+  TRANS_LOG(INFO, "######## CASE2: txn2 overwrite the elr row and depend on txn1");
+  ObDatumRowkey rowkey2;
+  ObStoreRow write_row2;
+  EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                 3, /*value*/
+                                 rowkey2,
+                                 write_row2));
+  ObTransID write_tx_id2 = ObTransID(2);
+  ObStoreCtx *wtx2 = start_tx(write_tx_id2);
+  ObPartTransCtx *tx_ctx2 = wtx2->mvcc_acc_ctx_.tx_ctx_;
+  tx_ctx2->ls_tx_ctx_mgr_ = &ls_tx_ctx_mgr_;
+  write_tx(wtx2,
+           memtable,
+           2000, /*snapshot version*/
+           write_row2);
+  ObSEArray<ObTransID, 4> prev_trans;
+  EXPECT_TRUE(tx_ctx2->elr_handler_.has_prev_trans());
+  EXPECT_EQ(OB_SUCCESS, tx_ctx2->elr_handler_.get_prev_trans(prev_trans));
+  EXPECT_EQ(1, prev_trans.count());
+  EXPECT_EQ(write_tx_id, prev_trans.at(0));
+
+  // txn1 is still ELR_COMMIT, txn2 can go on
+  EXPECT_EQ(OB_SUCCESS, tx_ctx2->check_elr_prev_trans_());
+  EXPECT_FALSE(tx_ctx2->sub_state_.is_force_abort());
+
+  TRANS_LOG(INFO, "######## CASE3: txn1 aborts finally and txn2 must abort too");
+  abort_txn(wtx, false /*need_write_back*/);
+  EXPECT_EQ(OB_SUCCESS, tx_ctx2->check_elr_prev_trans_());
+  EXPECT_TRUE(tx_ctx2->sub_state_.is_force_abort());
+
+  memtable->destroy();
+}
+
+TEST_F(TestMemtableV2, test_elr_commit_no_spurious_abort)
+{
+  ObMemtable *memtable = create_memtable();
+
+  TRANS_LOG(INFO, "######## CASE1: txn1 write two rows and release lock early");
+  ObDatumRowkey rowkey;
+  ObStoreRow write_row;
+  EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                 2, /*value*/
+                                 rowkey,
+                                 write_row));
+  ObDatumRowkey rowkey2;
+  ObStoreRow write_row2;
+  EXPECT_EQ(OB_SUCCESS, mock_row(2, /*key*/
+                                 2, /*value*/
+                                 rowkey2,
+                                 write_row2));
+  ObTransID write_tx_id = ObTransID(1);
+  ObStoreCtx *wtx = start_tx(write_tx_id);
+  write_tx(wtx,
+           memtable,
+           1000, /*snapshot version*/
+           write_row);
+  write_tx(wtx,
+           memtable,
+           1000, /*snapshot version*/
+           write_row2);
+  elr_txn(wtx, 1500 /*commit version*/);
+
+  TRANS_LOG(INFO, "######## CASE2: txn2 overwrite the first elr row");
+  ObDatumRowkey rowkey3;
+  ObStoreRow write_row3;
+  EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                 3, /*value*/
+                                 rowkey3,
+                                 write_row3));
+  ObTransID write_tx_id2 = ObTransID(2);
+  ObStoreCtx *wtx2 = start_tx(write_tx_id2);
+  ObPartTransCtx *tx_ctx2 = wtx2->mvcc_acc_ctx_.tx_ctx_;
+  tx_ctx2->ls_tx_ctx_mgr_ = &ls_tx_ctx_mgr_;
+  write_tx(wtx2,
+           memtable,
+           2000, /*snapshot version*/
+           write_row3);
+  EXPECT_TRUE(tx_ctx2->elr_handler_.has_prev_trans());
+
+  TRANS_LOG(INFO, "######## CASE3: txn1 commits later and txn2 is not aborted");
+  ObMvccTransNode *elr_tnode = get_tx_last_tnode(wtx);
+  commit_txn(wtx,
+             1500, /*commit version*/
+             true  /*need_write_back*/);
+  EXPECT_TRUE(elr_tnode->is_elr());
+  EXPECT_TRUE(elr_tnode->is_committed());
+  EXPECT_EQ(OB_SUCCESS, tx_ctx2->check_elr_prev_trans_());
+  EXPECT_FALSE(tx_ctx2->sub_state_.is_force_abort());
+
+  TRANS_LOG(INFO, "######## CASE4: txn3 overwrite the committed elr row without dependency");
+  ObDatumRowkey rowkey4;
+  ObStoreRow write_row4;
+  EXPECT_EQ(OB_SUCCESS, mock_row(2, /*key*/
+                                 4, /*value*/
+                                 rowkey4,
+                                 write_row4));
+  ObTransID write_tx_id3 = ObTransID(3);
+  ObStoreCtx *wtx3 = start_tx(write_tx_id3);
+  ObPartTransCtx *tx_ctx3 = wtx3->mvcc_acc_ctx_.tx_ctx_;
+  tx_ctx3->ls_tx_ctx_mgr_ = &ls_tx_ctx_mgr_;
+  write_tx(wtx3,
+           memtable,
+           2000, /*snapshot version*/
+           write_row4);
+  EXPECT_FALSE(tx_ctx3->elr_handler_.has_prev_trans());
+  EXPECT_EQ(OB_SUCCESS, tx_ctx3->check_elr_prev_trans_());
+  EXPECT_FALSE(tx_ctx3->sub_state_.is_force_abort());
+
+  memtable->destroy();
+}
+
 } // namespace unittest
 
 namespace storage
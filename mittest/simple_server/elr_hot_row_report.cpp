@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <iostream>
+
+#include "env/ob_simple_cluster_test_base.h"
+#include "lib/mysqlclient/ob_mysql_result.h"
+
+static const char *TEST_FILE_NAME = "elr_hot_row_report";
+const int64_t TOTAL_HOT_ROW_COUNT = 1;
+const int64_t TOTAL_ELR_SESSION = 32;
+const int64_t ELR_BENCH_SECONDS = 30;
+const int64_t HOT_ROW_INIT_CNT = 100000000;
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+int64_t total_hot_row_count = TOTAL_HOT_ROW_COUNT;
+int64_t total_elr_session = TOTAL_ELR_SESSION;
+int64_t elr_bench_seconds = ELR_BENCH_SECONDS;
+
+#define EXE_SQL(sql_str)                                            \
+  ASSERT_EQ(OB_SUCCESS, sql.assign(sql_str));                       \
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write(sql.ptr(), affected_rows));
+
+#define EXE_SQL_FMT(...)                                            \
+  ASSERT_EQ(OB_SUCCESS, sql.assign_fmt(__VA_ARGS__));               \
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write(sql.ptr(), affected_rows));
+
+// Hot row update benchmark: all sessions decrease counters of a few rows with
+// single-row autocommit updates, which serialize on the row locks unless the
+// locks are released early (after commit log is submitted).
+class ObElrHotRowReport : public ObSimpleClusterTestBase
+{
+public:
+  ObElrHotRowReport() : ObSimpleClusterTestBase(TEST_FILE_NAME, "200G", "40G") {}
+
+  void create_test_tenant(uint64_t &tenant_id)
+  {
+    TRANS_LOG(INFO, "create_tenant start");
+    ASSERT_EQ(OB_SUCCESS, create_tenant("tt1", "20G", "100G"));
+    ASSERT_EQ(OB_SUCCESS, get_tenant_id(tenant_id));
+    ASSERT_EQ(OB_SUCCESS, get_curr_simple_server().init_sql_proxy2());
+    TRANS_LOG(INFO, "create_tenant end", K(tenant_id));
+  }
+
+  void set_elr(const bool enable)
+  {
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    int64_t affected_rows = 0;
+    ObSqlString sql;
+    EXE_SQL_FMT("alter system set enable_early_lock_release = %s;", enable ? "true" : "false");
+    // wait ObTxELRUtil to refresh the tenant config
+    usleep(6 * 1000 * 1000);
+  }
+
+  void prepare_hot_rows()
+  {
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    int64_t affected_rows = 0;
+    ObSqlString sql;
+    EXE_SQL("create table test_elr_hot_row (id int primary key, cnt bigint)");
+    for (int64_t i = 0; i < total_hot_row_count; i++) {
+      EXE_SQL_FMT("insert into test_elr_hot_row values(%ld, %ld)", i, HOT_ROW_INIT_CNT);
+    }
+  }
+
+  void update_hot_row_single(const int64_t idx, const int64_t end_ts, int64_t &update_cnt)
+  {
+    ObSqlString sql;
+    int64_t affected_rows = 0;
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    sqlclient::ObISQLConnection *connection = nullptr;
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.acquire(connection));
+    ASSERT_NE(nullptr, connection);
+
+    update_cnt = 0;
+    for (int64_t i = idx; ObTimeUtility::current_time() < end_ts; i++) {
+      ASSERT_EQ(OB_SUCCESS, sql.assign_fmt("update test_elr_hot_row set cnt = cnt - 1 where id = %ld",
+                                           i % total_hot_row_count));
+      if (OB_SUCCESS == connection->execute_write(OB_SYS_TENANT_ID, sql.ptr(), affected_rows)) {
+        ASSERT_EQ(1, affected_rows);
+        update_cnt++;
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.close(connection, true));
+  }
+
+  void update_hot_row_parallel(const bool enable_elr, int64_t &total_update_cnt)
+  {
+    const int64_t session_cnt = total_elr_session;
+    std::thread *threads[session_cnt];
+    int64_t update_cnt[session_cnt];
+    const int64_t begin_time = ObTimeUtility::current_time();
+    const int64_t end_ts = begin_time + elr_bench_seconds * 1000 * 1000;
+
+    for (int64_t i = 0; i < session_cnt; i++) {
+      threads[i] = new std::thread(&ObElrHotRowReport::update_hot_row_single, this, i, end_ts,
+                                   std::ref(update_cnt[i]));
+    }
+    total_update_cnt = 0;
+    for (int64_t i = 0; i < session_cnt; i++) {
+      threads[i]->join();
+      delete threads[i];
+      total_update_cnt += update_cnt[i];
+    }
+    const int64_t end_time = ObTimeUtility::current_time();
+    const int64_t tps = total_update_cnt * 1000 * 1000 / (end_time - begin_time);
+    TRANS_LOG(INFO, "hot row update report", K(enable_elr), K(total_update_cnt), K(tps),
+              K(session_cnt), K(total_hot_row_count), K(end_time - begin_time));
+    std::cout << "hot row update report(enable_elr=" << enable_elr
+              << ", sessions=" << session_cnt
+              << ", hot_rows=" << total_hot_row_count
+              << ", updates=" << total_update_cnt
+              << ", tps=" << tps << ")\n";
+  }
+
+  void check_hot_rows(const int64_t total_update_cnt)
+  {
+    common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+    ObSqlString sql;
+    int64_t sum = 0;
+    ASSERT_EQ(OB_SUCCESS, sql.assign("select sum(cnt) as total from test_elr_hot_row"));
+    SMART_VAR(ObMySQLProxy::MySQLResult, res) {
+      ASSERT_EQ(OB_SUCCESS, sql_proxy.read(res, sql.ptr()));
+      sqlclient::ObMySQLResult *result = res.get_result();
+      ASSERT_NE(nullptr, result);
+      ASSERT_EQ(OB_SUCCESS, result->next());
+      ASSERT_EQ(OB_SUCCESS, result->get_int("total", sum));
+    }
+    ASSERT_EQ(total_hot_row_count * HOT_ROW_INIT_CNT - total_update_cnt, sum);
+  }
+};
+
+TEST_F(ObElrHotRowReport, elr_hot_row_report)
+{
+  uint64_t tenant_id = 0;
+  create_test_tenant(tenant_id);
+  prepare_hot_rows();
+
+  int64_t total_update_cnt = 0;
+  int64_t update_cnt = 0;
+  set_elr(false);
+  update_hot_row_parallel(false, update_cnt);
+  total_update_cnt += update_cnt;
+  check_hot_rows(total_update_cnt);
+
+  set_elr(true);
+  update_hot_row_parallel(true, update_cnt);
+  total_update_cnt += update_cnt;
+  check_hot_rows(total_update_cnt);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+void tutorial()
+{
+  std::cout << "./mittest/simple_server/test_elr_hot_row_report -r $1 -s $2 -t $3\n"
+            << "-r(row count): n = n hot rows updated by all sessions\n"
+            << "-s(session count): n = n sessions that update hot rows concurrently\n"
+            << "-t(time): n = n seconds for each round of benchmark\n";
+}
+
+int main(int argc, char **argv)
+{
+  int c = 0;
+  while(EOF != (c = getopt(argc,argv,"h:r:s:t:"))) {
+    switch(c) {
+    case 'h':
+      tutorial();
+      return 0;
+    case 'r':
+      oceanbase::unittest::total_hot_row_count = (int64_t)atoi(optarg);
+      break;
+    case 's':
+      oceanbase::unittest::total_elr_session = (int64_t)atoi(optarg);
+      break;
+    case 't':
+      oceanbase::unittest::elr_bench_seconds = (int64_t)atoi(optarg);
+      break;
+    default:
+      break;
+    }
+  }
+
+  if (oceanbase::unittest::total_hot_row_count <= 0
+      || oceanbase::unittest::total_elr_session <= 0
+      || oceanbase::unittest::elr_bench_seconds <= 0) {
+    TRANS_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "wrong choice",
+                  K(oceanbase::unittest::total_hot_row_count),
+                  K(oceanbase::unittest::total_elr_session),
+                  K(oceanbase::unittest::elr_bench_seconds));
+    ob_abort();
+  }
+
+  oceanbase::unittest::init_log_and_gtest(argc, argv);
+  OB_LOGGER.set_log_level("info");
+  ::testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -499,6 +499,16 @@ public:
   // 2. When configured on, the timestamp field is synchronized to integer
   T_DEF_BOOL(enable_convert_timestamp_to_unix_timestamp, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Whether to output numeric and temporal columns as typed binary value instead of text
+  // 1. off by default, all columns are formatted to text.
+  // 2. When configured on, int/uint/bit columns are output as 8 bytes integer, float/double as
+  //    4/8 bytes IEEE754, datetime/timestamp/time as 8 bytes microseconds, date as 4 bytes days
+  //    and year as 1 byte offset (0 for year 0000, otherwise year - 1900), all in little endian.
+  //    Consumer decodes them by column type in table meta.
+  // 3. Default values in table meta are always text, default values filled into row of columns
+  //    absent from redo are output the same as row values. Not effective in hbase mode.
+  T_DEF_BOOL(enable_output_binary_value, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+
   // Whether to output invisible columns externally
   // 1. DRC link is off by default; if valid, output hidden primary key
   // 2. Backup is on by default
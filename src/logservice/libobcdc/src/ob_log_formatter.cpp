@@ -1436,7 +1436,7 @@ int ObLogFormatter::fill_orig_default_value_(
           rv->orig_default_value_[usr_column_index] = NULL;
         } else {
           // default vlaue
-          const common::ObString *orig_default_value_str = column_schema_info->get_orig_default_value_str();
+          const common::ObString *orig_default_value_str = column_schema_info->get_row_default_value_str();
           ObString *str = static_cast<ObString *>(allocator.alloc(sizeof(ObString)));
 
           if (OB_ISNULL(str)) {
@@ -692,6 +692,7 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   bool enable_backup_mode = (TCONF.enable_backup_mode != 0);
   bool skip_hbase_mode_put_column_count_not_consistency = (TCONF.skip_hbase_mode_put_column_count_not_consistency != 0);
   bool enable_convert_timestamp_to_unix_timestamp = (TCONF.enable_convert_timestamp_to_unix_timestamp != 0);
+  bool enable_output_binary_value = (TCONF.enable_output_binary_value != 0);
   bool enable_output_hidden_primary_key = (TCONF.enable_output_hidden_primary_key != 0);
   bool enable_oracle_mode_match_case_sensitive = (TCONF.enable_oracle_mode_match_case_sensitive != 0);
   const char *rs_list = TCONF.rootserver_list.str();
@@ -926,9 +927,10 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   // After initializing the timezone info getter successfully, initialize the obj2str_helper_
   if (OB_SUCC(ret)) {
     if (OB_FAIL(obj2str_helper_.init(*timezone_info_getter_, hbase_util_, enable_hbase_mode,
-            enable_convert_timestamp_to_unix_timestamp, enable_backup_mode, *tenant_mgr_))) {
+            enable_convert_timestamp_to_unix_timestamp, enable_backup_mode, enable_output_binary_value,
+            *tenant_mgr_))) {
       LOG_ERROR("init obj2str_helper fail", KR(ret), K(enable_hbase_mode),
-          K(enable_convert_timestamp_to_unix_timestamp), K(enable_backup_mode));
+          K(enable_convert_timestamp_to_unix_timestamp), K(enable_backup_mode), K(enable_output_binary_value));
     }
   }
 
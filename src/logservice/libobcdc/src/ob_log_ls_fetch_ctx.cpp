@@ -23,6 +23,7 @@
 #include "ob_log_instance.h"                  // TCTX
 #include "ob_log_fetcher.h"                   // IObLogFetcher
 #include "logservice/restoreservice/ob_remote_log_source_allocator.h"
+#include "logservice/palf/log_compressor.h"   // LogDecompressBuf
 
 #define STAT(level, fmt, args...) OBLOG_FETCHER_LOG(level, "[STAT] [FETCH_CTX] " fmt, ##args)
 #define _STAT(level, fmt, args...) _OBLOG_FETCHER_LOG(level, "[STAT] [FETCH_CTX] " fmt, ##args)
@@ -394,8 +395,11 @@ int LSFetchCtx::read_log(
     volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
-  const char *buf = log_entry.get_data_buf();
-  const int64_t buf_len = log_entry.get_data_len();
+  // data of log_entry may be compressed, resolver copies what it needs, so the
+  // decompressed data only need to be valid in this function.
+  palf::LogDecompressBuf decompress_buf;
+  const char *buf = NULL;
+  int64_t buf_len = 0;
   const int64_t submit_ts = log_entry.get_scn().get_val_for_logservice();
   int64_t pos = 0;
   logservice::ObLogBaseHeader log_base_header;
@@ -403,6 +407,8 @@ int LSFetchCtx::read_log(
   if (OB_ISNULL(part_trans_resolver_)) {
     ret = OB_INVALID_ERROR;
     LOG_ERROR("invalid part trans resolver", KR(ret), K_(part_trans_resolver));
+  } else if (OB_FAIL(decompress_buf.decompress(log_entry, buf, buf_len))) {
+    LOG_ERROR("decompress log_entry failed", KR(ret), K(log_entry), K(lsn), K_(tls_id));
   } else if (OB_ISNULL(buf) || OB_UNLIKELY(0 >= buf_len)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_ERROR("invalid log_entry buf or buf_len", KR(ret), K(log_entry), K(lsn), K_(tls_id));
@@ -486,8 +492,11 @@ int LSFetchCtx::read_miss_tx_log(
     IObCDCPartTransResolver::MissingLogInfo &missing)
 {
   int ret = OB_SUCCESS;
-  const char *buf = log_entry.get_data_buf();
-  const int64_t buf_len = log_entry.get_data_len();
+  // data of log_entry may be compressed, resolver copies what it needs, so the
+  // decompressed data only need to be valid in this function.
+  palf::LogDecompressBuf decompress_buf;
+  const char *buf = NULL;
+  int64_t buf_len = 0;
   const int64_t submit_ts = log_entry.get_scn().get_val_for_logservice();
   int64_t pos = 0;
   logservice::ObLogBaseHeader log_base_header;
@@ -495,6 +504,8 @@ int LSFetchCtx::read_miss_tx_log(
   if (OB_ISNULL(part_trans_resolver_)) {
     ret = OB_INVALID_ERROR;
     LOG_ERROR("invalid part trans resolver", KR(ret), K(part_trans_resolver_));
+  } else if (OB_FAIL(decompress_buf.decompress(log_entry, buf, buf_len))) {
+    LOG_ERROR("decompress log_entry failed", KR(ret), K(log_entry), K(lsn), K_(tls_id));
   } else if (OB_ISNULL(buf) || OB_UNLIKELY(0 >= buf_len)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_ERROR("invalid log_entry buf or buf_len", KR(ret), K(log_entry), K(lsn), K_(tls_id));
@@ -40,6 +40,7 @@ ColumnSchemaInfo::ColumnSchemaInfo()
       accuracy_(),
       collation_type_(),
       orig_default_value_str_(NULL),
+      orig_default_value_bin_(NULL),
       extended_type_info_size_(0),
       extended_type_info_(NULL),
       is_rowkey_(false)
@@ -67,18 +68,25 @@ int ColumnSchemaInfo::init(
 {
   int ret = OB_SUCCESS;
   common::ObString *orig_default_value_str = NULL;
+  common::ObString *orig_default_value_bin = NULL;
 
   if (OB_UNLIKELY(column_stored_idx < 0 || column_stored_idx > OB_USER_ROW_MAX_COLUMNS_COUNT + OB_APP_MIN_COLUMN_ID)
       || OB_UNLIKELY(is_usr_column && (usr_column_idx < 0 || usr_column_idx > OB_USER_ROW_MAX_COLUMNS_COUNT))) {
     LOG_ERROR("invalid argument", K(column_stored_idx), K(is_usr_column), K(usr_column_idx));
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_FAIL(get_column_ori_default_value_(table_schema, column_table_schema, column_stored_idx, tz_info_wrap,
-            obj2str_helper, allocator, orig_default_value_str))) {
+            obj2str_helper, true/*is_default_value*/, allocator, orig_default_value_str))) {
       LOG_ERROR("get_column_ori_default_value_ fail", KR(ret), K(table_schema), K(column_table_schema),
           K(column_stored_idx));
   } else if (OB_ISNULL(orig_default_value_str)) {
     LOG_ERROR("orig_default_value_str is null", K(orig_default_value_str));
     ret = OB_ERR_UNEXPECTED;
+  // Default value filled into row is output in the same format as the row values
+  } else if (obj2str_helper.is_binary_output_obj(column_table_schema.get_orig_default_value())
+      && OB_FAIL(get_column_ori_default_value_(table_schema, column_table_schema, column_stored_idx, tz_info_wrap,
+            obj2str_helper, false/*is_default_value*/, allocator, orig_default_value_bin))) {
+      LOG_ERROR("get_column_ori_default_value_ as binary fail", KR(ret), K(table_schema), K(column_table_schema),
+          K(column_stored_idx));
   } else if (OB_FAIL(init_extended_type_info_(table_schema, column_table_schema, column_stored_idx, allocator))) {
     LOG_ERROR("init_extended_type_info_ fail", KR(ret),
         "table_id", table_schema.get_table_id(),
@@ -109,6 +117,7 @@ int ColumnSchemaInfo::init(
     accuracy_ = accuracy;
     collation_type_ =  collation_type;
     orig_default_value_str_ = orig_default_value_str;
+    orig_default_value_bin_ = orig_default_value_bin;
     is_rowkey_ = column_table_schema.is_original_rowkey_column();
   }
 
@@ -136,6 +145,11 @@ void ColumnSchemaInfo::reset()
     orig_default_value_str_ = NULL;
   }
 
+  if (NULL != orig_default_value_bin_) {
+    LOG_ERROR_RET(OB_ERR_UNEXPECTED, "orig_default_value_bin_ should be null", K(orig_default_value_bin_));
+    orig_default_value_bin_ = NULL;
+  }
+
   extended_type_info_size_ = 0;
   extended_type_info_ = NULL;
   is_rowkey_ = false;
@@ -154,6 +168,7 @@ int ColumnSchemaInfo::get_column_ori_default_value_(
     const int16_t column_idx,
     const ObTimeZoneInfoWrap *tz_info_wrap,
     ObObj2strHelper &obj2str_helper,
+    const bool is_default_value,
     common::ObIAllocator &allocator,
     common::ObString *&str)
 {
@@ -178,7 +193,8 @@ int ColumnSchemaInfo::get_column_ori_default_value_(
             column_table_schema.get_extended_type_info(),
             column_table_schema.get_accuracy(),
             column_table_schema.get_collation_type(),
-            tz_info_wrap))) {
+            tz_info_wrap,
+            is_default_value))) {
       LOG_ERROR("obj2str cast orig_default_value fail", KR(ret), K(orig_default_obj), K(*str),
           "tenant_id", table_schema.get_tenant_id(),
           "table_id", table_schema.get_table_id(),
@@ -264,6 +280,11 @@ void ColumnSchemaInfo::release_mem(common::ObIAllocator &allocator)
     orig_default_value_str_ = NULL;
   }
 
+  if (NULL != orig_default_value_bin_) {
+    allocator.free(orig_default_value_bin_);
+    orig_default_value_bin_ = NULL;
+  }
+
   if (NULL != extended_type_info_) {
     for (int64_t idx = 0; idx < extended_type_info_size_; ++idx) {
       void *ptr = static_cast<void *>(&extended_type_info_[idx]);
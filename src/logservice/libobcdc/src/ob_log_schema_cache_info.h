@@ -100,6 +100,9 @@ public:
     orig_default_value_str_ = &orig_default_value_str;
   }
   inline const common::ObString *get_orig_default_value_str() const { return orig_default_value_str_; }
+  // default value filled into row, binary if enable_output_binary_value and the column is fixed length
+  inline const common::ObString *get_row_default_value_str() const
+  { return NULL != orig_default_value_bin_ ? orig_default_value_bin_ : orig_default_value_str_; }
   // 1. To resolve the memory space, ObArrayHelper is not used directly to store information, get_extended_type_info returns size and an array of pointers directly
   // 2. call ObArrayHelper<ObString>(size, str_ptr, size) directly from the outer layer to construct a temporary array
   inline void get_extended_type_info(int64_t &size, common::ObString *&str_ptr) const
@@ -120,6 +123,7 @@ public:
       K_(accuracy),
       K_(collation_type),
       K_(orig_default_value_str),
+      KP_(orig_default_value_bin),
       K_(extended_type_info_size),
       K_(extended_type_info),
       K_(is_rowkey));
@@ -132,6 +136,7 @@ private:
       const int16_t column_idx,
       const ObTimeZoneInfoWrap *tz_info_wrap,
       ObObj2strHelper &obj2str_helper,
+      const bool is_default_value,
       common::ObIAllocator &allocator,
       common::ObString *&str);
 
@@ -153,6 +158,8 @@ private:
   common::ObCollationType collation_type_;
   // TODO: There are no multiple versions of the default value, consider maintaining a copy
   common::ObString   *orig_default_value_str_;
+  // binary value of the default value, only valid if it is output as binary in row
+  common::ObString   *orig_default_value_bin_;
   // used for enum and set
   int64_t            extended_type_info_size_;
   common::ObString   *extended_type_info_;
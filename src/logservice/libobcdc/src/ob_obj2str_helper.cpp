@@ -40,6 +40,7 @@ ObObj2strHelper::ObObj2strHelper() : inited_(false),
                                      enable_hbase_mode_(false),
                                      enable_convert_timestamp_to_unix_timestamp_(false),
                                      enable_backup_mode_(false),
+                                     enable_output_binary_value_(false),
                                      tenant_mgr_(NULL)
 {
 }
@@ -54,6 +55,7 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     const bool enable_hbase_mode,
     const bool enable_convert_timestamp_to_unix_timestamp,
     const bool enable_backup_mode,
+    const bool enable_output_binary_value,
     IObLogTenantMgr &tenant_mgr)
 {
   int ret = OB_SUCCESS;
@@ -68,6 +70,7 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     enable_hbase_mode_ = enable_hbase_mode;
     enable_convert_timestamp_to_unix_timestamp_ = enable_convert_timestamp_to_unix_timestamp;
     enable_backup_mode_ = enable_backup_mode;
+    enable_output_binary_value_ = enable_output_binary_value;
     tenant_mgr_ = &tenant_mgr;
     inited_ = true;
   }
@@ -104,6 +107,7 @@ void ObObj2strHelper::destroy()
   enable_hbase_mode_ = false;
   enable_convert_timestamp_to_unix_timestamp_ = false;
   enable_backup_mode_ = false;
+  enable_output_binary_value_ = false;
   tenant_mgr_ = NULL;
 }
 
@@ -119,15 +123,22 @@ int ObObj2strHelper::obj2str(const uint64_t tenant_id,
     const common::ObIArray<common::ObString> &extended_type_info,
     const common::ObAccuracy &accuracy,
     const common::ObCollationType &collation_type,
-    const ObTimeZoneInfoWrap *tz_info_wrap) const
+    const ObTimeZoneInfoWrap *tz_info_wrap,
+    const bool is_default_value) const
 {
   int ret = OB_SUCCESS;
   ObObjType obj_type = obj.get_type();
   common::ObObjTypeClass obj_tc = common::ob_obj_type_class(obj_type);
   lib::Worker::CompatMode compat_mode = THIS_WORKER.get_compatibility_mode();
 
+  // Output fixed length value as binary directly, skip formatting.
+  // Default value in schema keeps text format.
+  if (! is_default_value && is_binary_output_obj(obj)) {
+    if (OB_FAIL(convert_obj_to_binary_(obj, str, allocator))) {
+      OBLOG_LOG(ERROR, "convert_obj_to_binary_ fail", KR(ret), K(table_id), K(column_id), K(obj), K(obj_type));
+    }
   // Configure allowed conversions: mysql timestamp column -> UTC integer time
-  if (ObTimestampType == obj_type && enable_convert_timestamp_to_unix_timestamp_) {
+  } else if (ObTimestampType == obj_type && enable_convert_timestamp_to_unix_timestamp_) {
     if (OB_FAIL(convert_mysql_timestamp_to_utc_(obj, str, allocator))) {
       OBLOG_LOG(ERROR, "convert_mysql_timestamp_to_utc_ fail", KR(ret), K(table_id), K(column_id), K(obj), K(obj_type),
           K(str));
@@ -301,6 +312,100 @@ int ObObj2strHelper::obj2str(const uint64_t tenant_id,
   return ret;
 }
 
+bool ObObj2strHelper::is_binary_output_type_(const common::ObObjTypeClass obj_tc)
+{
+  bool bool_ret = false;
+  switch (obj_tc) {
+    case ObIntTC:
+    case ObUIntTC:
+    case ObFloatTC:
+    case ObDoubleTC:
+    case ObDateTimeTC:
+    case ObDateTC:
+    case ObTimeTC:
+    case ObYearTC:
+    case ObBitTC:
+      bool_ret = true;
+      break;
+    default:
+      break;
+  }
+  return bool_ret;
+}
+
+int ObObj2strHelper::convert_obj_to_binary_(const common::ObObj &obj,
+    common::ObString &str,
+    common::ObIAllocator &allocator) const
+{
+  int ret = OB_SUCCESS;
+  const common::ObObjTypeClass obj_tc = obj.get_type_class();
+  union {
+    int64_t int64_;
+    uint64_t uint64_;
+    float float_;
+    double double_;
+    int32_t date_;
+    uint8_t year_;
+  } value;
+  int64_t len = 0;
+  char *buf = NULL;
+
+  switch (obj_tc) {
+    case ObIntTC:
+      value.int64_ = obj.get_int();
+      len = sizeof(int64_t);
+      break;
+    case ObUIntTC:
+      value.uint64_ = obj.get_uint64();
+      len = sizeof(uint64_t);
+      break;
+    case ObBitTC:
+      value.uint64_ = obj.get_bit();
+      len = sizeof(uint64_t);
+      break;
+    case ObFloatTC:
+      value.float_ = obj.get_float();
+      len = sizeof(float);
+      break;
+    case ObDoubleTC:
+      value.double_ = obj.get_double();
+      len = sizeof(double);
+      break;
+    case ObDateTimeTC:
+      value.int64_ = obj.get_datetime();
+      len = sizeof(int64_t);
+      break;
+    case ObTimeTC:
+      value.int64_ = obj.get_time();
+      len = sizeof(int64_t);
+      break;
+    case ObDateTC:
+      value.date_ = obj.get_date();
+      len = sizeof(int32_t);
+      break;
+    case ObYearTC:
+      // offset to 1900, 0 for year 0000, same as the storage format of year
+      value.year_ = obj.get_year();
+      len = sizeof(uint8_t);
+      break;
+    default:
+      ret = OB_NOT_SUPPORTED;
+      OBLOG_LOG(ERROR, "obj type not supported to output as binary", KR(ret), K(obj));
+      break;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(len)))) {
+    OBLOG_LOG(ERROR, "allocate memory fail", K(len));
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    MEMCPY(buf, &value, len);
+    str.assign_ptr(buf, static_cast<ObString::obstr_size_t>(len));
+  }
+
+  return ret;
+}
+
 int ObObj2strHelper::convert_timestamp_with_timezone_data_util_succ_(const common::ObObjType &target_type,
     common::ObObjCastParams &cast_param,
     const common::ObObj &in_obj,
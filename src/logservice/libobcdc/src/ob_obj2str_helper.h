@@ -49,6 +49,9 @@ public:
   //  2) string_deep_copy == true
   //    deep copy of the string
   // 2. otherwise use allocator to allocate memory and print the object into memory
+  // 3. If enable_output_binary_value, fixed length types of row values are output as binary,
+  //    see convert_obj_to_binary_; default values of table meta (is_default_value) are always text,
+  //    default values filled into row are converted with is_default_value = false
    int obj2str(const uint64_t tenant_id,
        const uint64_t table_id,
        const uint64_t column_id,
@@ -59,7 +62,14 @@ public:
        const common::ObIArray<common::ObString> &extended_type_info,
        const common::ObAccuracy &accuracy,
        const common::ObCollationType &collation_type,
-       const ObTimeZoneInfoWrap *tz_info_wrap) const;
+       const ObTimeZoneInfoWrap *tz_info_wrap,
+       const bool is_default_value = false) const;
+
+   // Whether the obj in row is output as binary value
+   bool is_binary_output_obj(const common::ObObj &obj) const
+   {
+     return enable_output_binary_value_ && ! enable_hbase_mode_ && is_binary_output_type_(obj.get_type_class());
+   }
 
 public:
   int init(IObLogTimeZoneInfoGetter &timezone_info_getter,
@@ -67,6 +77,7 @@ public:
       const bool enable_hbase_mode,
       const bool enable_convert_timestamp_to_unix_timestamp,
       const bool enable_backup_mode,
+      const bool enable_output_binary_value,
       IObLogTenantMgr &tenant_mgr);
   void destroy();
 
@@ -120,6 +131,16 @@ private:
       common::ObString &str,
       common::ObIAllocator &allocator) const;
 
+  // Fixed length types which could be output as binary value without formatting
+  static bool is_binary_output_type_(const common::ObObjTypeClass obj_tc);
+  // Output value in little endian, length is decided by type class:
+  // int/uint/bit: 8 bytes; float/double: 4/8 bytes IEEE754;
+  // datetime/timestamp/time: 8 bytes microseconds; date: 4 bytes days since 1970-01-01;
+  // year: 1 byte offset, 0 means year 0000, otherwise year = 1900 + offset, e.g. 2024 is 124.
+  int convert_obj_to_binary_(const common::ObObj &obj,
+      common::ObString &str,
+      common::ObIAllocator &allocator) const;
+
 private:
   bool                          inited_;
   IObLogTimeZoneInfoGetter      *timezone_info_getter_;
@@ -127,6 +148,7 @@ private:
   bool                          enable_hbase_mode_;
   bool                          enable_convert_timestamp_to_unix_timestamp_;
   bool                          enable_backup_mode_;
+  bool                          enable_output_binary_value_;
   IObLogTenantMgr               *tenant_mgr_;
 
 private:
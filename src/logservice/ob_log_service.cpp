@@ -19,6 +19,7 @@
 #include "rpc/frame/ob_req_transport.h"
 #include "rpc/obrpc/ob_net_keepalive.h"       // ObNetKeepAlive
 #include "share/ob_ls_id.h"
+#include "share/ob_cluster_version.h"         // GET_MIN_DATA_VERSION
 #include "share/allocator/ob_tenant_mutil_allocator.h"
 #include "share/allocator/ob_tenant_mutil_allocator_mgr.h"
 #include "share/ob_tenant_info_proxy.h"
@@ -508,9 +509,20 @@ int ObLogService::update_palf_options_except_disk_usage_limit_size()
   } else {
     PalfOptions palf_opts;
     common::ObCompressorType compressor_type = LZ4_COMPRESSOR;
+    common::ObCompressorType storage_compressor_type = LZ4_COMPRESSOR;
+    uint64_t tenant_data_version = 0;
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = GET_MIN_DATA_VERSION(MTL_ID(), tenant_data_version))) {
+      // regard as the lowest version, only storage compression is turned off
+      tenant_data_version = 0;
+      CLOG_LOG_RET(WARN, tmp_ret, "get tenant data version failed, storage compression is off", K(tmp_ret), K(MTL_ID()));
+    }
     if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor_type(
                 tenant_config->log_transport_compress_func, compressor_type))) {
       CLOG_LOG(ERROR, "log_transport_compress_func invalid.", K(ret));
+    } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor_type(
+                tenant_config->log_storage_compress_func, storage_compressor_type))) {
+      CLOG_LOG(ERROR, "log_storage_compress_func invalid.", K(ret));
     //需要获取log_disk_usage_limit_size
     } else if (OB_FAIL(palf_env_->get_options(palf_opts))) {
       CLOG_LOG(WARN, "palf get_options failed", K(ret));
@@ -519,6 +531,17 @@ int ObLogService::update_palf_options_except_disk_usage_limit_size()
       palf_opts.disk_options_.log_disk_utilization_limit_threshold_ = tenant_config->log_disk_utilization_limit_threshold;
       palf_opts.compress_options_.enable_transport_compress_ = tenant_config->log_transport_compress_all;
       palf_opts.compress_options_.transport_compress_func_ = compressor_type;
+      // servers of lower version could not read compressed log entries, it's enabled
+      // after the data version of tenant has been upgraded
+      const bool enable_storage_compress = tenant_config->log_storage_compress_all;
+      palf_opts.storage_compress_options_.enable_storage_compress_ =
+          enable_storage_compress && tenant_data_version >= DATA_VERSION_4_1_0_1;
+      if (enable_storage_compress && !palf_opts.storage_compress_options_.enable_storage_compress_) {
+        CLOG_LOG(WARN, "log_storage_compress_all is ignored before data version is upgraded",
+                 K(MTL_ID()), K(tenant_data_version));
+      }
+      palf_opts.storage_compress_options_.storage_compress_func_ = storage_compressor_type;
+      palf_opts.hot_cache_options_.cache_size_ = tenant_config->_log_hot_cache_size;
       if (OB_FAIL(palf_env_->update_options(palf_opts))) {
         CLOG_LOG(WARN, "palf update_options failed", K(MTL_ID()), K(ret));
       } else {
@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX PALF
+#include "log_compressor.h"
+#include "lib/compress/ob_compressor_pool.h"   // ObCompressorPool
+#include "lib/utility/serialization.h"
+#include "share/rc/ob_tenant_base.h"           // MTL_ID
+#include "log_entry.h"                         // LogEntry
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+int LogCompressor::get_max_compressed_size(const ObCompressorType compressor_type,
+                                           const int64_t src_len,
+                                           int64_t &max_size)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  if (0 >= src_len) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(compressor_type), K(src_len));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(src_len, max_overflow_size))) {
+    PALF_LOG(WARN, "get_max_overflow_size failed", K(ret), K(compressor_type), K(src_len));
+  } else {
+    max_size = HEADER_SIZE + src_len + max_overflow_size;
+  }
+  return ret;
+}
+
+int LogCompressor::compress(const ObCompressorType compressor_type,
+                            const char *src,
+                            const int64_t src_len,
+                            char *dst,
+                            const int64_t dst_size,
+                            int64_t &dst_len)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t pos = 0;
+  int64_t compressed_len = 0;
+  if (NULL == src || 0 >= src_len || src_len > INT32_MAX || NULL == dst || HEADER_SIZE >= dst_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(src), K(src_len), KP(dst), K(dst_size));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(serialization::encode_i16(dst, dst_size, pos, MAGIC))
+             || OB_FAIL(serialization::encode_i16(dst, dst_size, pos, static_cast<int16_t>(compressor_type)))
+             || OB_FAIL(serialization::encode_i32(dst, dst_size, pos, static_cast<int32_t>(src_len)))) {
+    PALF_LOG(WARN, "encode compress header failed", K(ret), K(dst_size), K(pos));
+  } else if (OB_FAIL(compressor->compress(src, src_len, dst + pos, dst_size - pos, compressed_len))) {
+    PALF_LOG(WARN, "compress failed", K(ret), K(compressor_type), K(src_len), K(dst_size));
+  } else if (pos + compressed_len >= src_len) {
+    ret = OB_BUF_NOT_ENOUGH;
+  } else {
+    dst_len = pos + compressed_len;
+  }
+  return ret;
+}
+
+int LogCompressor::get_decompressed_size(const char *src,
+                                         const int64_t src_len,
+                                         int64_t &orig_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  int16_t magic = 0;
+  int16_t compressor_type = 0;
+  int32_t len = 0;
+  if (NULL == src || HEADER_SIZE >= src_len) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(src), K(src_len));
+  } else if (OB_FAIL(serialization::decode_i16(src, src_len, pos, &magic))
+             || OB_FAIL(serialization::decode_i16(src, src_len, pos, &compressor_type))
+             || OB_FAIL(serialization::decode_i32(src, src_len, pos, &len))) {
+    PALF_LOG(WARN, "decode compress header failed", K(ret), K(src_len));
+  } else if (MAGIC != magic || 0 >= len) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(ERROR, "invalid compress header", K(ret), K(magic), K(compressor_type), K(len));
+  } else {
+    orig_len = len;
+  }
+  return ret;
+}
+
+int LogCompressor::decompress(const char *src,
+                              const int64_t src_len,
+                              char *dst,
+                              const int64_t dst_size,
+                              int64_t &dst_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  int16_t magic = 0;
+  int16_t compressor_type = 0;
+  int32_t orig_len = 0;
+  ObCompressor *compressor = NULL;
+  if (NULL == src || HEADER_SIZE >= src_len || NULL == dst || 0 >= dst_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(src), K(src_len), KP(dst), K(dst_size));
+  } else if (OB_FAIL(serialization::decode_i16(src, src_len, pos, &magic))
+             || OB_FAIL(serialization::decode_i16(src, src_len, pos, &compressor_type))
+             || OB_FAIL(serialization::decode_i32(src, src_len, pos, &orig_len))) {
+    PALF_LOG(WARN, "decode compress header failed", K(ret), K(src_len));
+  } else if (MAGIC != magic || 0 >= orig_len) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(ERROR, "invalid compress header", K(ret), K(magic), K(compressor_type), K(orig_len));
+  } else if (dst_size < orig_len) {
+    ret = OB_BUF_NOT_ENOUGH;
+    PALF_LOG(WARN, "decompress buffer is not enough", K(ret), K(dst_size), K(orig_len));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(
+             static_cast<ObCompressorType>(compressor_type), compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->decompress(src + pos, src_len - pos, dst, dst_size, dst_len))) {
+    PALF_LOG(WARN, "decompress failed", K(ret), K(compressor_type), K(src_len), K(orig_len));
+  } else if (dst_len != orig_len) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(ERROR, "decompressed data len is unexpected", K(ret), K(dst_len), K(orig_len));
+  }
+  return ret;
+}
+
+LogDecompressBuf::LogDecompressBuf()
+  : buf_(NULL),
+    buf_size_(0)
+{}
+
+LogDecompressBuf::~LogDecompressBuf()
+{
+  destroy();
+}
+
+void LogDecompressBuf::destroy()
+{
+  if (NULL != buf_) {
+    ob_free(buf_);
+    buf_ = NULL;
+  }
+  buf_size_ = 0;
+}
+
+int LogDecompressBuf::decompress(const LogEntry &entry, const char *&buf, int64_t &buf_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t orig_len = 0;
+  if (false == entry.get_header().is_compressed()) {
+    buf = entry.get_data_buf();
+    buf_len = entry.get_data_len();
+  } else if (OB_FAIL(LogCompressor::get_decompressed_size(entry.get_data_buf(),
+             entry.get_data_len(), orig_len))) {
+    PALF_LOG(WARN, "get_decompressed_size failed", K(ret), K(entry));
+  } else if (OB_FAIL(reserve_(orig_len))) {
+    PALF_LOG(WARN, "reserve decompress buffer failed", K(ret), K(orig_len));
+  } else if (OB_FAIL(LogCompressor::decompress(entry.get_data_buf(), entry.get_data_len(),
+             buf_, buf_size_, buf_len))) {
+    PALF_LOG(WARN, "decompress failed", K(ret), K(entry));
+  } else {
+    buf = buf_;
+  }
+  return ret;
+}
+
+int LogDecompressBuf::reserve_(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size > buf_size_) {
+    const uint64_t tenant_id = is_valid_tenant_id(MTL_ID()) ? MTL_ID() : OB_SERVER_TENANT_ID;
+    ObMemAttr mem_attr(tenant_id, "LogDecompress");
+    char *tmp_buf = NULL;
+    if (NULL == (tmp_buf = static_cast<char *>(ob_malloc(size, mem_attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "alloc memory failed", K(ret), K(size));
+    } else {
+      destroy();
+      buf_ = tmp_buf;
+      buf_size_ = size;
+    }
+  }
+  return ret;
+}
+
+LogCompressBuf::LogCompressBuf()
+  : buf_(NULL),
+    buf_size_(0)
+{}
+
+LogCompressBuf::~LogCompressBuf()
+{
+  destroy();
+}
+
+void LogCompressBuf::destroy()
+{
+  if (NULL != buf_) {
+    ob_free(buf_);
+    buf_ = NULL;
+  }
+  buf_size_ = 0;
+}
+
+int LogCompressBuf::reserve(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size > buf_size_) {
+    ObMemAttr mem_attr(OB_SERVER_TENANT_ID, "LogCompress");
+    char *tmp_buf = NULL;
+    if (NULL == (tmp_buf = static_cast<char *>(ob_malloc(size, mem_attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "alloc memory failed", K(ret), K(size));
+    } else {
+      destroy();
+      buf_ = tmp_buf;
+      buf_size_ = size;
+    }
+  }
+  return ret;
+}
+
+void LogCompressBuf::shrink()
+{
+  if (buf_size_ > MAX_CACHED_SIZE) {
+    destroy();
+  }
+}
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_COMPRESSOR_
+#define OCEANBASE_LOGSERVICE_LOG_COMPRESSOR_
+
+#include "lib/compress/ob_compress_util.h"     // ObCompressorType
+#include "lib/utility/ob_macro_utils.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace palf
+{
+class LogEntry;
+// Compress the data of one LogEntry, the compressed data is self-described:
+//
+// | magic(2B) | compressor type(2B) | original data len(4B) | compressed data |
+//
+// LogEntryHeader records whether the data has been compressed, the checksum of
+// LogEntryHeader is calculated by compressed data.
+class LogCompressor
+{
+public:
+  static int get_max_compressed_size(const common::ObCompressorType compressor_type,
+                                     const int64_t src_len,
+                                     int64_t &max_size);
+  // @retval
+  //   OB_SUCCESS
+  //   OB_BUF_NOT_ENOUGH, compressed data is not smaller than source data, no need to compress.
+  static int compress(const common::ObCompressorType compressor_type,
+                      const char *src,
+                      const int64_t src_len,
+                      char *dst,
+                      const int64_t dst_size,
+                      int64_t &dst_len);
+  static int get_decompressed_size(const char *src,
+                                   const int64_t src_len,
+                                   int64_t &orig_len);
+  static int decompress(const char *src,
+                        const int64_t src_len,
+                        char *dst,
+                        const int64_t dst_size,
+                        int64_t &dst_len);
+public:
+  // log smaller than MIN_COMPRESS_SIZE will not be compressed
+  static const int64_t MIN_COMPRESS_SIZE = 1024;
+  static const int64_t HEADER_SIZE = 8;
+private:
+  static constexpr int16_t MAGIC = 0x4C43;  // 'LC' means LOG COMPRESSED
+};
+
+// Buffer to hold the decompressed data of LogEntry, it's reused by successive
+// LogEntries and enlarged on demand, so the data returned is valid until next call.
+class LogDecompressBuf
+{
+public:
+  LogDecompressBuf();
+  ~LogDecompressBuf();
+  void destroy();
+  // return the data of 'entry' directly if it has not been compressed.
+  int decompress(const LogEntry &entry, const char *&buf, int64_t &buf_len);
+  TO_STRING_KV(KP_(buf), K_(buf_size));
+private:
+  int reserve_(const int64_t size);
+private:
+  char *buf_;
+  int64_t buf_size_;
+  DISALLOW_COPY_AND_ASSIGN(LogDecompressBuf);
+};
+
+// Buffer to hold the compressed data of submitted log, each submitting thread keeps
+// one and reuses it for successive logs. It's allocated by server tenant because the
+// thread may submit logs of different tenants.
+class LogCompressBuf
+{
+public:
+  LogCompressBuf();
+  ~LogCompressBuf();
+  void destroy();
+  int reserve(const int64_t size);
+  // release big buffer enlarged by occasional big log
+  void shrink();
+  char *get_buf() { return buf_; }
+  int64_t get_buf_size() const { return buf_size_; }
+  TO_STRING_KV(KP_(buf), K_(buf_size));
+public:
+  static const int64_t MAX_CACHED_SIZE = 256 * 1024;
+private:
+  char *buf_;
+  int64_t buf_size_;
+  DISALLOW_COPY_AND_ASSIGN(LogCompressBuf);
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
@@ -84,6 +84,10 @@ const int64_t LEADER_DEFAULT_GROUP_BUFFER_SIZE = 1 << 25;
 const int64_t MAX_ALLOWED_SKEW_FOR_REF_US = 3600L * 1000 * 1000;          // 1h
 // follower's group buffer size is 8MB larger than leader's.
 const int64_t FOLLOWER_DEFAULT_GROUP_BUFFER_SIZE = LEADER_DEFAULT_GROUP_BUFFER_SIZE + 8 * 1024 * 1024L;
+// default size of the ring cache which holds recently flushed logs of each palf,
+// all caches of one tenant use at most PALF_HOT_CACHE_MEMORY_PERCENTAGE of tenant memory.
+const int64_t PALF_HOT_CACHE_SIZE = 1 << 23;                                        // 8M
+const int64_t PALF_HOT_CACHE_MEMORY_PERCENTAGE = 2;
 const int64_t PALF_STAT_PRINT_INTERVAL_US = 1 * 1000 * 1000L;
 // The advance delay threshold for match lsn is 1s.
 const int64_t MATCH_LSN_ADVANCE_DELAY_THRESHOLD_US = 1 * 1000 * 1000L;
@@ -85,11 +85,13 @@ int LogEngine::init(const int64_t palf_id,
                     ILogBlockPool *log_block_pool,
                     LogRpc *log_rpc,
                     LogIOWorker *log_io_worker,
+                    LogHotCacheQuota *hot_cache_quota,
                     const int64_t palf_epoch,
                     const int64_t log_storage_block_size,
                     const int64_t log_meta_storage_block_ize)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   auto log_meta_storage_update_manifest_cb = [](const block_id_t max_block_id) {
     // do nothing
     return OB_SUCCESS;
@@ -138,6 +140,10 @@ int LogEngine::init(const int64_t palf_id,
   } else if (OB_FAIL(append_log_meta_(log_meta))) {
     PALF_LOG(ERROR, "append_log_meta_ failed", K(ret));
   } else {
+    if (0 != log_storage_block_size && NULL != hot_cache_quota
+        && OB_SUCCESS != (tmp_ret = log_storage_.init_hot_cache(hot_cache_quota))) {
+      PALF_LOG(WARN, "init hot cache failed, read logs from disk only", K(tmp_ret), K(palf_id));
+    }
     palf_id_ = palf_id;
     log_meta_ = log_meta;
     alloc_mgr_ = alloc_mgr;
@@ -177,6 +183,7 @@ int LogEngine::load(const int64_t palf_id,
                     ILogBlockPool *log_block_pool,
                     LogRpc *log_rpc,
                     LogIOWorker *log_io_worker,
+                    LogHotCacheQuota *hot_cache_quota,
                     LogGroupEntryHeader &entry_header,
                     const int64_t palf_epoch,
                     bool &is_integrity,
@@ -184,6 +191,7 @@ int LogEngine::load(const int64_t palf_id,
                     const int64_t log_meta_storage_block_ize)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   ObTimeGuard guard("load", 0);
   auto log_meta_storage_update_manifest_cb = [&](const block_id_t max_block_id) {
     // do nothing
@@ -238,6 +246,10 @@ int LogEngine::load(const int64_t palf_id,
   } else if (OB_FAIL(log_net_service_.init(palf_id, log_rpc))) {
     PALF_LOG(ERROR, "LogNetService init failed", K(ret), K(palf_id));
   } else {
+    if (0 != log_storage_block_size && NULL != hot_cache_quota
+        && OB_SUCCESS != (tmp_ret = log_storage_.init_hot_cache(hot_cache_quota))) {
+      PALF_LOG(WARN, "init hot cache failed, read logs from disk only", K(tmp_ret), K(palf_id));
+    }
     palf_id_ = palf_id;
     palf_epoch_ = palf_epoch;
     alloc_mgr_ = alloc_mgr;
@@ -89,6 +89,7 @@ public:
            ILogBlockPool *log_block_pool,
            LogRpc *log_rpc,
            LogIOWorker *log_io_worker,
+           LogHotCacheQuota *hot_cache_quota,
            const int64_t palf_epoch,
            const int64_t log_storage_block_size,
            const int64_t log_meta_storage_block_size);
@@ -100,6 +101,7 @@ public:
            ILogBlockPool *log_block_pool,
            LogRpc *log_rpc,
            LogIOWorker *log_io_worker,
+           LogHotCacheQuota *hot_cache_quota,
            LogGroupEntryHeader &entry_header,
            const int64_t palf_epoch,
            bool &is_integrity,
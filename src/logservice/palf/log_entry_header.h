@@ -30,6 +30,11 @@ public:
   int generate_header(const char *log_data,
                       const int64_t data_len,
                       const share::SCN &scn);
+  // 'is_compressed' means log_data has been compressed by LogCompressor
+  int generate_header(const char *log_data,
+                      const int64_t data_len,
+                      const share::SCN &scn,
+                      const bool is_compressed);
   LogEntryHeader& operator=(const LogEntryHeader &header);
   void reset();
   bool is_valid() const;
@@ -38,6 +43,7 @@ public:
   const share::SCN get_scn() const { return scn_; }
   int64_t get_data_checksum() const { return data_checksum_; }
   bool check_header_integrity() const;
+  bool is_compressed() const { return 0 != (flag_ & COMPRESSED_MASK); }
   NEED_SERIALIZE_AND_DESERIALIZE;
   TO_STRING_KV("magic", magic_,
                "version", version_,
@@ -54,6 +60,7 @@ private:
   bool check_header_checksum_() const;
 private:
   static constexpr int16_t LOG_ENTRY_HEADER_VERSION = 1;
+  static constexpr int64_t COMPRESSED_MASK = 1 << 1;
 private:
   int16_t magic_;
   int16_t version_;
@@ -61,6 +68,7 @@ private:
   share::SCN scn_;
   int64_t data_checksum_;
   // The lowest bit is used for parity check.
+  // The second bit marks whether the log data is compressed.
   int64_t flag_;
 };
 }
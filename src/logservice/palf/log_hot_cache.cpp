@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX PALF
+#include "log_hot_cache.h"
+#include "lib/alloc/alloc_func.h"               // get_tenant_memory_limit
+#include "lib/allocator/ob_malloc.h"           // ob_malloc
+#include "lib/time/ob_time_utility.h"           // ObTimeUtility
+#include "log_writer_utils.h"                   // LogWriteBuf
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+LogHotCacheQuota::LogHotCacheQuota()
+  : tenant_id_(OB_INVALID_TENANT_ID),
+    cache_size_(0),
+    used_size_(0)
+{}
+
+LogHotCacheQuota::~LogHotCacheQuota()
+{
+  destroy();
+}
+
+int LogHotCacheQuota::init(const uint64_t tenant_id, const int64_t cache_size)
+{
+  int ret = OB_SUCCESS;
+  if (!is_valid_tenant_id(tenant_id) || 0 > cache_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(tenant_id), K(cache_size));
+  } else {
+    tenant_id_ = tenant_id;
+    cache_size_ = cache_size;
+    used_size_ = 0;
+  }
+  return ret;
+}
+
+void LogHotCacheQuota::destroy()
+{
+  if (0 != ATOMIC_LOAD(&used_size_)) {
+    PALF_LOG_RET(WARN, OB_ERR_UNEXPECTED, "hot cache memory is not released", KPC(this));
+  }
+  tenant_id_ = OB_INVALID_TENANT_ID;
+  cache_size_ = 0;
+  used_size_ = 0;
+}
+
+bool LogHotCacheQuota::acquire(const int64_t size)
+{
+  bool bool_ret = false;
+  // tenant memory may be resized, calculate the limit each time.
+  const int64_t limit = lib::get_tenant_memory_limit(tenant_id_) / 100 * PALF_HOT_CACHE_MEMORY_PERCENTAGE;
+  int64_t used_size = ATOMIC_LOAD(&used_size_);
+  while (!bool_ret && used_size + size <= limit) {
+    const int64_t old_used_size = ATOMIC_VCAS(&used_size_, used_size, used_size + size);
+    if (old_used_size == used_size) {
+      bool_ret = true;
+    } else {
+      used_size = old_used_size;
+    }
+  }
+  return bool_ret;
+}
+
+void LogHotCacheQuota::release(const int64_t size)
+{
+  ATOMIC_SAF(&used_size_, size);
+}
+
+LogHotCache::LogHotCache()
+  : palf_id_(INVALID_PALF_ID),
+    quota_(NULL),
+    buf_(NULL),
+    cache_size_(0),
+    last_alloc_fail_ts_(OB_INVALID_TIMESTAMP),
+    start_lsn_(),
+    end_lsn_(),
+    hit_cnt_(0),
+    miss_cnt_(0),
+    hit_size_(0),
+    lock_(common::ObLatchIds::PALF_HOT_CACHE_LOCK),
+    is_inited_(false)
+{}
+
+LogHotCache::~LogHotCache()
+{
+  destroy();
+}
+
+int LogHotCache::init(const int64_t palf_id, LogHotCacheQuota *quota)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+  } else if (false == is_valid_palf_id(palf_id) || OB_ISNULL(quota)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(palf_id), KP(quota));
+  } else {
+    palf_id_ = palf_id;
+    quota_ = quota;
+    last_alloc_fail_ts_ = OB_INVALID_TIMESTAMP;
+    start_lsn_.reset();
+    end_lsn_.reset();
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogHotCache init success", KPC(this));
+  }
+  return ret;
+}
+
+void LogHotCache::destroy()
+{
+  WLockGuard guard(lock_);
+  if (IS_INIT) {
+    PALF_LOG(INFO, "LogHotCache destroy", KPC(this));
+    is_inited_ = false;
+    free_buf_();
+    quota_ = NULL;
+    palf_id_ = INVALID_PALF_ID;
+  }
+}
+
+void LogHotCache::reset()
+{
+  WLockGuard guard(lock_);
+  start_lsn_.reset();
+  end_lsn_.reset();
+}
+
+void LogHotCache::trim(const LSN &lsn)
+{
+  WLockGuard guard(lock_);
+  if (!start_lsn_.is_valid() || lsn <= start_lsn_) {
+  } else if (lsn >= end_lsn_) {
+    start_lsn_.reset();
+    end_lsn_.reset();
+  } else {
+    start_lsn_ = lsn;
+  }
+}
+
+void LogHotCache::fill(const LSN &lsn, const LogWriteBuf &write_buf)
+{
+  int ret = OB_SUCCESS;
+  WLockGuard guard(lock_);
+  if (IS_NOT_INIT || !lsn.is_valid()) {
+  } else if (OB_SUCCESS != prepare_buf_()) {
+    // read logs from disk only
+  } else {
+    if (!end_lsn_.is_valid() || lsn != end_lsn_) {
+      start_lsn_ = lsn;
+      end_lsn_ = lsn;
+    }
+    const int64_t buf_count = write_buf.get_buf_count();
+    for (int64_t i = 0; OB_SUCC(ret) && i < buf_count; i++) {
+      const char *data = NULL;
+      int64_t data_len = 0;
+      if (OB_FAIL(write_buf.get_write_buf(i, data, data_len))) {
+        PALF_LOG(WARN, "get_write_buf failed", K(ret), K(i), K(write_buf));
+      } else {
+        append_(data, data_len);
+      }
+    }
+    if (OB_FAIL(ret)) {
+      start_lsn_.reset();
+      end_lsn_.reset();
+    }
+  }
+}
+
+int LogHotCache::read(const LSN &lsn,
+                      const int64_t in_read_size,
+                      char *buf,
+                      int64_t &out_read_size) const
+{
+  int ret = OB_SUCCESS;
+  RLockGuard guard(lock_);
+  if (IS_NOT_INIT || NULL == buf_ || !start_lsn_.is_valid()
+      || lsn < start_lsn_ || lsn + in_read_size > end_lsn_) {
+    ret = OB_ENTRY_NOT_EXIST;
+    ATOMIC_INC(&miss_cnt_);
+  } else {
+    const int64_t pos = static_cast<int64_t>(lsn.val_ % cache_size_);
+    const int64_t first_len = MIN(in_read_size, cache_size_ - pos);
+    MEMCPY(buf, buf_ + pos, first_len);
+    if (first_len < in_read_size) {
+      MEMCPY(buf + first_len, buf_, in_read_size - first_len);
+    }
+    out_read_size = in_read_size;
+    ATOMIC_INC(&hit_cnt_);
+    ATOMIC_AAF(&hit_size_, in_read_size);
+  }
+  return ret;
+}
+
+int LogHotCache::prepare_buf_()
+{
+  int ret = OB_SUCCESS;
+  const int64_t cache_size = quota_->get_cache_size();
+  if (cache_size != cache_size_) {
+    // cache size has been changed, reallocate buffer
+    free_buf_();
+  }
+  if (NULL != buf_) {
+  } else if (0 >= cache_size) {
+    ret = OB_EAGAIN;
+  } else if (OB_INVALID_TIMESTAMP != last_alloc_fail_ts_
+             && ObTimeUtility::current_time() - last_alloc_fail_ts_ < ALLOC_RETRY_INTERVAL_US) {
+    ret = OB_EAGAIN;
+  } else if (false == quota_->acquire(cache_size)) {
+    ret = OB_EAGAIN;
+    last_alloc_fail_ts_ = ObTimeUtility::current_time();
+    PALF_LOG(TRACE, "hot cache quota is exhausted", K(ret), KPC(quota_), KPC(this));
+  } else if (NULL == (buf_ = static_cast<char *>(ob_malloc(cache_size,
+      ObMemAttr(quota_->get_tenant_id(), "LogHotCache"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    quota_->release(cache_size);
+    last_alloc_fail_ts_ = ObTimeUtility::current_time();
+    PALF_LOG(WARN, "alloc memory failed", K(ret), K(cache_size), KPC(this));
+  } else {
+    cache_size_ = cache_size;
+    last_alloc_fail_ts_ = OB_INVALID_TIMESTAMP;
+    start_lsn_.reset();
+    end_lsn_.reset();
+    PALF_LOG(INFO, "alloc hot cache buffer success", K(ret), KPC(quota_), KPC(this));
+  }
+  return ret;
+}
+
+void LogHotCache::free_buf_()
+{
+  if (NULL != buf_) {
+    ob_free(buf_);
+    quota_->release(cache_size_);
+    buf_ = NULL;
+  }
+  cache_size_ = 0;
+  start_lsn_.reset();
+  end_lsn_.reset();
+}
+
+void LogHotCache::append_(const char *data, const int64_t data_len)
+{
+  // only the last 'cache_size_' bytes need to be kept.
+  const int64_t skip_len = data_len > cache_size_ ? data_len - cache_size_ : 0;
+  const LSN append_lsn = end_lsn_ + skip_len;
+  const int64_t append_len = data_len - skip_len;
+  const int64_t pos = static_cast<int64_t>(append_lsn.val_ % cache_size_);
+  const int64_t first_len = MIN(append_len, cache_size_ - pos);
+  MEMCPY(buf_ + pos, data + skip_len, first_len);
+  if (first_len < append_len) {
+    MEMCPY(buf_, data + skip_len + first_len, append_len - first_len);
+  }
+  end_lsn_ = end_lsn_ + data_len;
+  if (end_lsn_ - start_lsn_ > static_cast<offset_t>(cache_size_)) {
+    start_lsn_ = end_lsn_ - cache_size_;
+  }
+}
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+#define OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+
+#include "lib/atomic/ob_atomic.h"               // ATOMIC_*
+#include "lib/lock/ob_tc_rwlock.h"              // RWLock
+#include "lib/utility/ob_macro_utils.h"
+#include "lib/utility/ob_print_utils.h"
+#include "log_define.h"
+#include "lsn.h"
+
+namespace oceanbase
+{
+namespace palf
+{
+class LogWriteBuf;
+// Memory quota of all hot caches in one tenant, the total size is bounded by
+// PALF_HOT_CACHE_MEMORY_PERCENTAGE of tenant memory.
+class LogHotCacheQuota
+{
+public:
+  LogHotCacheQuota();
+  ~LogHotCacheQuota();
+  int init(const uint64_t tenant_id, const int64_t cache_size);
+  void destroy();
+  // size of each hot cache, 0 means hot cache is disabled.
+  void set_cache_size(const int64_t cache_size) { ATOMIC_STORE(&cache_size_, cache_size); }
+  int64_t get_cache_size() const { return ATOMIC_LOAD(&cache_size_); }
+  uint64_t get_tenant_id() const { return tenant_id_; }
+  // return false if the quota is exhausted
+  bool acquire(const int64_t size);
+  void release(const int64_t size);
+  TO_STRING_KV(K_(tenant_id), K_(cache_size), K_(used_size));
+private:
+  uint64_t tenant_id_;
+  int64_t cache_size_;
+  int64_t used_size_;
+  DISALLOW_COPY_AND_ASSIGN(LogHotCacheQuota);
+};
+
+// Ring buffer which holds the most recently flushed logs of one palf, the cached
+// range is [start_lsn_, end_lsn_) and always continuous.
+//
+// It's filled by the writer after data has been written to disk, so everything in
+// cache is readable from disk too, readers try cache before reading disk. The buffer
+// is allocated at the first fill and only when the tenant quota allows.
+class LogHotCache
+{
+public:
+  LogHotCache();
+  ~LogHotCache();
+  int init(const int64_t palf_id, LogHotCacheQuota *quota);
+  void destroy();
+  // drop all cached data
+  void reset();
+  // drop cached data before 'lsn'
+  void trim(const LSN &lsn);
+  // Append data has been written to disk at 'lsn', cache will be reset if 'lsn' is not
+  // continuous with cached data.
+  void fill(const LSN &lsn, const LogWriteBuf &write_buf);
+  // @retval
+  //   OB_SUCCESS
+  //   OB_ENTRY_NOT_EXIST, [lsn, lsn + in_read_size) is not cached totally.
+  int read(const LSN &lsn,
+           const int64_t in_read_size,
+           char *buf,
+           int64_t &out_read_size) const;
+  bool is_inited() const { return is_inited_; }
+  TO_STRING_KV(K_(palf_id), KP_(buf), K_(cache_size), K_(start_lsn), K_(end_lsn),
+               K_(hit_cnt), K_(miss_cnt), K_(hit_size));
+private:
+  // @retval
+  //   OB_SUCCESS, buf_ is ready
+  //   OB_EAGAIN, hot cache is disabled or the quota is exhausted
+  //   OB_ALLOCATE_MEMORY_FAILED
+  int prepare_buf_();
+  void free_buf_();
+  void append_(const char *data, const int64_t data_len);
+  typedef common::RWLock::RLockGuard RLockGuard;
+  typedef common::RWLock::WLockGuard WLockGuard;
+  static const int64_t ALLOC_RETRY_INTERVAL_US = 1000 * 1000;
+private:
+  int64_t palf_id_;
+  LogHotCacheQuota *quota_;
+  char *buf_;
+  int64_t cache_size_;
+  int64_t last_alloc_fail_ts_;
+  LSN start_lsn_;
+  LSN end_lsn_;
+  mutable int64_t hit_cnt_;
+  mutable int64_t miss_cnt_;
+  mutable int64_t hit_size_;
+  mutable common::RWLock lock_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(LogHotCache);
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
@@ -30,6 +30,8 @@ LogIOWorker::LogIOWorker()
     : log_io_worker_num_(-1),
       cb_thread_pool_tg_id_(-1),
       palf_env_impl_(NULL),
+      batch_ctrl_(),
+      print_batch_ctrl_interval_(OB_INVALID_TIMESTAMP),
       do_task_used_ts_(0),
       do_task_count_(0),
       print_log_interval_(OB_INVALID_TIMESTAMP),
@@ -65,6 +67,9 @@ int LogIOWorker::init(const LogIOWorkerConfig &config,
                                              allocator))) {
     PALF_LOG(ERROR, "BatchLogIOFlushLogTaskMgr init failed", K(ret), K(config));
   } else {
+    // 'batch_width_' and 'batch_depth_' are the upper bound of one batch, the actual
+    // aggregation is tuned online by 'batch_ctrl_'.
+    batch_ctrl_.init(config.batch_width_ * config.batch_depth_);
     share::ObThreadPool::set_run_wrapper(MTL_CTX());
     log_io_worker_num_ = config.io_worker_num_;
     cb_thread_pool_tg_id_ = cb_thread_pool_tg_id;
@@ -94,6 +99,7 @@ void LogIOWorker::destroy()
   log_io_worker_num_ = -1;
   queue_.destroy();
   batch_io_task_mgr_.destroy();
+  batch_ctrl_.reset();
 }
 
 int LogIOWorker::submit_io_task(LogIOTask *io_task)
@@ -195,11 +201,15 @@ int LogIOWorker::reduce_io_task_(void *task)
   int ret = OB_SUCCESS;
   LogIOTask *io_task = NULL;
   bool last_io_task_has_been_reduced = true;
+  int64_t batch_size = 0;
+  const int64_t target_batch_size = batch_ctrl_.get_target_batch_size();
+  const int64_t wait_deadline_us = ObTimeUtility::current_time() + batch_ctrl_.get_wait_window_us();
 
   // termination conditions for aggregation:
   // 1. the top LogIOTask of 'queue_' can not be aggreated
   // 2. there is no usable BatchLogIOFlushLogTask in 'batch_io_task_mgr_'.
-  // 3. there is no LogIOTask in 'queue_'
+  // 3. there is no LogIOTask in 'queue_', and 'target_batch_size' has been reached
+  //    or wait window has been passed.
   int tmp_ret = OB_SUCCESS;
   while (OB_SUCCESS == tmp_ret && true == last_io_task_has_been_reduced) {
     io_task = reinterpret_cast<LogIOTask *>(task);
@@ -218,16 +228,28 @@ int LogIOWorker::reduce_io_task_(void *task)
       if (OB_SUCCESS != (tmp_ret = batch_io_task_mgr_.insert(flush_log_task))) {
         last_io_task_has_been_reduced = false;
         PALF_LOG(WARN, "batch_io_task_mgr_ insert failed", K(tmp_ret));
+      } else if (FALSE_IT(batch_size++)) {
       } else if (OB_SUCCESS == (tmp_ret = queue_.pop(task))) {
-      // When 'queue_' is empty, stop aggreating.
+      } else if (batch_size < target_batch_size) {
+        // When 'queue_' is empty, wait for more LogIOTask in the wait window.
+        const int64_t wait_us = wait_deadline_us - ObTimeUtility::current_time();
+        tmp_ret = wait_us > 0 ? queue_.pop(task, wait_us) : tmp_ret;
       } else {
       }
     }
   }
 
+  const int64_t flush_start_ts = ObTimeUtility::current_time();
   if (OB_FAIL(batch_io_task_mgr_.handle(cb_thread_pool_tg_id_, palf_env_impl_))) {
     PALF_LOG(WARN, "batch_io_task_mgr_ handle failed", K(ret), K(batch_io_task_mgr_));
   }
+  if (0 < batch_size) {
+    batch_ctrl_.on_batch_done(batch_size, ObTimeUtility::current_time() - flush_start_ts, queue_.size());
+  }
+  if (palf_reach_time_interval(5 * 1000 * 1000, print_batch_ctrl_interval_)) {
+    PALF_EVENT("group commit statistics", 0, K_(batch_ctrl), "io_queue_size", queue_.size());
+    batch_ctrl_.reset_statistics();
+  }
 
   if (false == last_io_task_has_been_reduced && OB_NOT_NULL(io_task)) {
     io_task = reinterpret_cast<LogIOFlushLogTask *>(io_task);
@@ -237,6 +259,64 @@ int LogIOWorker::reduce_io_task_(void *task)
   return ret;
 }
 
+void LogIOBatchCtrl::init(const int64_t max_batch_size)
+{
+  reset();
+  max_batch_size_ = MAX(MIN_TARGET_BATCH_SIZE, MIN(max_batch_size, MAX_TARGET_BATCH_SIZE));
+}
+
+void LogIOBatchCtrl::reset()
+{
+  max_batch_size_ = MIN_TARGET_BATCH_SIZE;
+  target_batch_size_ = MIN_TARGET_BATCH_SIZE;
+  wait_window_us_ = 0;
+  avg_flush_cost_us_ = 0;
+  avg_queue_size_ = 0;
+  reset_statistics();
+}
+
+void LogIOBatchCtrl::reset_statistics()
+{
+  batch_count_ = 0;
+  MEMSET(batch_size_hist_, 0, sizeof(batch_size_hist_));
+  total_flush_cost_us_ = 0;
+  max_flush_cost_us_ = 0;
+}
+
+void LogIOBatchCtrl::on_batch_done(const int64_t batch_size,
+                                   const int64_t flush_cost_us,
+                                   const int64_t queue_size)
+{
+  // exponential moving average with weight 1/8
+  avg_flush_cost_us_ = (0 == batch_count_ && 0 == avg_flush_cost_us_) ?
+      flush_cost_us : (avg_flush_cost_us_ * 7 + flush_cost_us) / 8;
+  avg_queue_size_ = (avg_queue_size_ * 7 + queue_size) / 8;
+  if (0 < queue_size || (1 < batch_size && batch_size >= target_batch_size_)) {
+    // tasks are arriving faster than flushing, aggregate more for throughput
+    target_batch_size_ = MIN(max_batch_size_, target_batch_size_ * 2);
+  } else if (1 >= batch_size && 0 == avg_queue_size_) {
+    // idle, flush as soon as possible
+    target_batch_size_ = MAX(MIN_TARGET_BATCH_SIZE, target_batch_size_ / 2);
+  }
+  if (1 < batch_size && 0 == queue_size) {
+    // several writers without backlog, waiting a fraction of flush cost is cheaper
+    // than an extra fsync for the next task.
+    wait_window_us_ = MIN(MAX_WAIT_WINDOW_US, avg_flush_cost_us_ / 4);
+  } else {
+    // backlog feeds the batch directly, or idle, the wait window is useless.
+    wait_window_us_ /= 2;
+  }
+
+  int64_t bucket = 0;
+  for (int64_t size = batch_size; size > 1 && bucket < BATCH_SIZE_BUCKET_NUM - 1; size >>= 1) {
+    bucket++;
+  }
+  batch_size_hist_[bucket]++;
+  batch_count_++;
+  total_flush_cost_us_ += flush_cost_us;
+  max_flush_cost_us_ = MAX(max_flush_cost_us_, flush_cost_us);
+}
+
 LogIOWorker::BatchLogIOFlushLogTaskMgr::BatchLogIOFlushLogTaskMgr()
   : handle_count_(0), has_batched_size_(0), usable_count_(0), batch_width_(0)
 {}
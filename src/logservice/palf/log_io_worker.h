@@ -19,6 +19,7 @@
 #include "lib/utility/ob_print_utils.h"             // TO_STRING_KV
 #include "lib/thread/thread_mgr_interface.h"        // TGTaskHandler
 #include "lib/container/ob_fixed_array.h"           // ObSEArrayy
+#include "lib/container/ob_array_wrap.h"            // ObArrayWrap
 #include "lib/hash/ob_array_hash_map.h"             // ObArrayHashMap
 #include "share/ob_thread_pool.h"                   // ObThreadPool
 #include "log_io_task.h"                            // LogBatchIOFlushLogTask
@@ -62,6 +63,44 @@ struct LogIOWorkerConfig
   TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth));
 };
 
+// Group commit controller of LogIOWorker, tunes the number of LogIOFlushLogTask to be
+// aggregated and the time to wait for them by observed flush cost and queue size:
+// 1. there are tasks left in queue after flush, aggregate more tasks for throughput;
+// 2. batch has several tasks but queue is empty, wait a fraction of flush cost for more tasks;
+// 3. only one task in batch, flush immediately for latency.
+class LogIOBatchCtrl
+{
+public:
+  LogIOBatchCtrl() { reset(); }
+  ~LogIOBatchCtrl() { reset(); }
+  void init(const int64_t max_batch_size);
+  void reset();
+  void reset_statistics();
+  void on_batch_done(const int64_t batch_size, const int64_t flush_cost_us, const int64_t queue_size);
+  int64_t get_target_batch_size() const { return target_batch_size_; }
+  int64_t get_wait_window_us() const { return wait_window_us_; }
+  int64_t get_avg_flush_cost_us() const { return avg_flush_cost_us_; }
+  static constexpr int64_t MAX_WAIT_WINDOW_US = 1000;
+  static constexpr int64_t MIN_TARGET_BATCH_SIZE = 1;
+  static constexpr int64_t MAX_TARGET_BATCH_SIZE = 1024;
+  // batch size distribution: [1], [2, 4), [4, 8) ... [2^(N-1), +∞)
+  static constexpr int64_t BATCH_SIZE_BUCKET_NUM = 8;
+  TO_STRING_KV(K_(target_batch_size), K_(wait_window_us), K_(avg_flush_cost_us), K_(avg_queue_size),
+      K_(batch_count), "batch_size_distribution", common::ObArrayWrap<int64_t>(batch_size_hist_, BATCH_SIZE_BUCKET_NUM),
+      K_(total_flush_cost_us), K_(max_flush_cost_us));
+private:
+  int64_t max_batch_size_;
+  int64_t target_batch_size_;
+  int64_t wait_window_us_;
+  int64_t avg_flush_cost_us_;
+  int64_t avg_queue_size_;
+  // statistics
+  int64_t batch_count_;
+  int64_t batch_size_hist_[BATCH_SIZE_BUCKET_NUM];
+  int64_t total_flush_cost_us_;
+  int64_t max_flush_cost_us_;
+};
+
 class LogIOWorker : public share::ObThreadPool
 {
 public:
@@ -77,8 +116,9 @@ public:
   void run1() override final;
   int submit_io_task(LogIOTask *io_task);
   int64_t get_last_working_time() const { return ATOMIC_LOAD(&last_working_time_); }
+  const LogIOBatchCtrl &get_batch_ctrl() const { return batch_ctrl_; }
   static constexpr int64_t MAX_THREAD_NUM = 1;
-  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id));
+  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id), K_(batch_ctrl));
 private:
 
   bool need_reduce_(LogIOTask *task);
@@ -120,6 +160,8 @@ private:
   IPalfEnvImpl *palf_env_impl_;
   ObLightyQueue queue_;
   BatchLogIOFlushLogTaskMgr batch_io_task_mgr_;
+  LogIOBatchCtrl batch_ctrl_;
+  int64_t print_batch_ctrl_interval_;
   int64_t do_task_used_ts_;
   int64_t do_task_count_;
   int64_t print_log_interval_;
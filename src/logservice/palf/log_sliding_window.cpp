@@ -415,6 +415,16 @@ int LogSlidingWindow::submit_log(const char *buf,
                                  const SCN &ref_scn,
                                  LSN &lsn,
                                  SCN &result_scn)
+{
+  return submit_log(buf, buf_len, false, ref_scn, lsn, result_scn);
+}
+
+int LogSlidingWindow::submit_log(const char *buf,
+                                 const int64_t buf_len,
+                                 const bool is_compressed,
+                                 const SCN &ref_scn,
+                                 LSN &lsn,
+                                 SCN &result_scn)
 {
   int ret = OB_SUCCESS;
   int64_t log_id = OB_INVALID_LOG_ID;
@@ -462,7 +472,7 @@ int LogSlidingWindow::submit_log(const char *buf,
             K(padding_size), K(is_new_log), K(valid_log_size));
       } else if (is_need_handle && FALSE_IT(is_need_handle_next |= is_need_handle)) {
       } else if (OB_FAIL(generate_new_group_log_(tmp_lsn, log_id, scn, padding_entry_body_size, LOG_PADDING, \
-              NULL, padding_entry_body_size, is_need_handle))) {
+              NULL, padding_entry_body_size, false, is_need_handle))) {
         PALF_LOG(ERROR, "generate_new_group_log_ failed", K(ret), K_(palf_id), K_(self), K(log_id), K(tmp_lsn), K(padding_size),
             K(is_new_log), K(valid_log_size));
       } else if (is_need_handle && FALSE_IT(is_need_handle_next |= is_need_handle)) {
@@ -485,7 +495,7 @@ int LogSlidingWindow::submit_log(const char *buf,
           PALF_LOG(WARN, "try_freeze_prev_log_ failed", K(ret), K_(palf_id), K_(self), K(log_id));
         } else if (is_need_handle && FALSE_IT(is_need_handle_next |= is_need_handle)) {
         } else if (OB_FAIL(generate_new_group_log_(tmp_lsn, log_id, scn, valid_log_size, LOG_SUBMIT, \
-                buf, buf_len, is_need_handle))) {
+                buf, buf_len, is_compressed, is_need_handle))) {
           PALF_LOG(WARN, "generate_new_group_log_ failed", K(ret), K_(palf_id), K_(self), K(log_id));
         } else if (is_need_handle && FALSE_IT(is_need_handle_next |= is_need_handle)) {
         } else {
@@ -494,7 +504,7 @@ int LogSlidingWindow::submit_log(const char *buf,
         }
       } else {
         // this log need to be appended to last log
-        if (OB_FAIL(append_to_group_log_(lsn, log_id, scn, valid_log_size, buf, buf_len, is_need_handle))) {
+        if (OB_FAIL(append_to_group_log_(lsn, log_id, scn, valid_log_size, buf, buf_len, is_compressed, is_need_handle))) {
           PALF_LOG(WARN, "append_to_group_log_ failed", K(ret), K_(palf_id), K_(self), K(log_id));
         } else if (is_need_handle && FALSE_IT(is_need_handle_next |= is_need_handle)) {
         } else {
@@ -599,6 +609,7 @@ int LogSlidingWindow::append_to_group_log_(const LSN &lsn,
                                            const int64_t log_entry_size, // log_entry_header + log_data
                                            const char *log_data,
                                            const int64_t data_len,
+                                           const bool is_compressed,
                                            bool &is_need_handle)
 {
   int ret = OB_SUCCESS;
@@ -628,7 +639,7 @@ int LogSlidingWindow::append_to_group_log_(const LSN &lsn,
       PALF_LOG(ERROR, "group_buffer wait failed", K(ret), K_(palf_id), K_(self), K(lsn), K(log_entry_size));
     } else if (OB_FAIL(group_buffer_.fill(log_entry_data_lsn, log_data, data_len))) {
       PALF_LOG(ERROR, "fill group buffer failed", K(ret), K_(palf_id), K_(self));
-    } else if (OB_FAIL(log_entry_header.generate_header(log_data, data_len, scn))) {
+    } else if (OB_FAIL(log_entry_header.generate_header(log_data, data_len, scn, is_compressed))) {
       PALF_LOG(WARN, "genearate header failed", K(ret), K_(palf_id), K_(self));
     } else if (OB_FAIL(log_entry_header.serialize(tmp_buf, TMP_HEADER_SER_BUF_LEN, pos))) {
       PALF_LOG(WARN, "serialize log_entry_header failed", K(ret), K_(palf_id), K_(self));
@@ -654,6 +665,7 @@ int LogSlidingWindow::generate_new_group_log_(const LSN &lsn,
                                               const LogType &log_type,
                                               const char *log_data,
                                               const int64_t data_len,
+                                              const bool is_compressed,
                                               bool &is_need_handle)
 {
   int ret = OB_SUCCESS;
@@ -718,7 +730,7 @@ int LogSlidingWindow::generate_new_group_log_(const LSN &lsn,
         char tmp_buf[TMP_HEADER_SER_BUF_LEN];
         if (OB_FAIL(group_buffer_.fill(log_entry_data_lsn, log_data, data_len))) {
           PALF_LOG(ERROR, "fill group buffer failed", K(ret), K_(palf_id), K_(self));
-        } else if (OB_FAIL(log_entry_header.generate_header(log_data, data_len, scn))) {
+        } else if (OB_FAIL(log_entry_header.generate_header(log_data, data_len, scn, is_compressed))) {
           PALF_LOG(WARN, "genearate header failed", K(ret), K_(palf_id), K_(self));
         } else if (OB_FAIL(log_entry_header.serialize(tmp_buf, TMP_HEADER_SER_BUF_LEN, pos))) {
           PALF_LOG(WARN, "serialize log_entry_header failed", K(ret), K_(palf_id), K_(self));
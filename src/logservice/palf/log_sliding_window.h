@@ -184,6 +184,13 @@ public:
                  const share::SCN &ref_scn,
                  LSN &lsn,
                  share::SCN &scn);
+  // 'is_compressed' means buf has been compressed by LogCompressor
+  virtual int submit_log(const char *buf,
+                 const int64_t buf_len,
+                 const bool is_compressed,
+                 const share::SCN &ref_scn,
+                 LSN &lsn,
+                 share::SCN &scn);
   virtual int submit_group_log(const LSN &lsn,
                        const char *buf,
                        const int64_t buf_len);
@@ -325,6 +332,7 @@ private:
                               const LogType &log_type,
                               const char *log_data,
                               const int64_t data_len,
+                              const bool is_compressed,
                               bool &is_need_handle);
   int append_to_group_log_(const LSN &lsn,
                            const int64_t log_id,
@@ -332,6 +340,7 @@ private:
                            const int64_t log_entry_size,
                            const char *log_data,
                            const int64_t data_len,
+                           const bool is_compressed,
                            bool &is_need_handle);
   int handle_next_submit_log_(bool &is_committed_lsn_updated);
   int handle_committed_log_();
@@ -26,6 +26,7 @@ class LogReader;
 LogStorage::LogStorage() :
     block_mgr_(),
     log_reader_(),
+    hot_cache_(),
     log_tail_(),
     log_block_header_(),
     curr_block_writable_size_(0),
@@ -94,6 +95,17 @@ int LogStorage::load_manifest_for_meta_storage(block_id_t &expected_next_block_i
   return ret;
 }
 
+int LogStorage::init_hot_cache(LogHotCacheQuota *hot_cache_quota)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(hot_cache_.init(palf_id_, hot_cache_quota))) {
+    PALF_LOG(WARN, "LogHotCache init failed", K(ret), KP(hot_cache_quota), KPC(this));
+  }
+  return ret;
+}
+
 void LogStorage::destroy()
 {
   is_inited_ = false;
@@ -105,6 +117,7 @@ void LogStorage::destroy()
   readable_log_tail_.reset();
   log_tail_.reset();
   log_reader_.destroy();
+  hot_cache_.destroy();
   block_mgr_.destroy();
   PALF_LOG(INFO, "LogStorage destroy success");
 }
@@ -141,6 +154,10 @@ int LogStorage::writev(const LSN &lsn, const LogWriteBuf &write_buf, const SCN &
                  lsn_2_block(lsn, logical_block_size_), get_phy_offset_(lsn), write_buf))) {
     PALF_LOG(ERROR, "LogVirtualFileMgr writev failed", K(ret), K(write_buf), K(lsn));
   } else {
+    // In process of flashback, the data of old blocks is still readable, don't cache new data.
+    if (hot_cache_.is_inited() && get_readable_log_tail_guarded_by_lock_() == log_tail_) {
+      hot_cache_.fill(lsn, write_buf);
+    }
     curr_block_writable_size_ -= write_size;
     update_log_tail_guarded_by_lock_(write_size);
     PALF_LOG(TRACE, "LogStorage writev success", K(ret), K(log_block_header_), K(lsn),
@@ -328,6 +345,7 @@ int LogStorage::inner_truncate_(const LSN &lsn)
                                          get_phy_offset_(lsn)))) {
     PALF_LOG(WARN, "block_mgr_ truncate success", K(ret), K(lsn), KPC(this));
   } else {
+    hot_cache_.reset();
     reset_log_tail_for_last_block_(lsn, true);
     PALF_LOG(INFO, "inner_truncate_ success", K(ret), K(lsn), KPC(this));
   }
@@ -363,6 +381,7 @@ int LogStorage::truncate_prefix_blocks(const LSN &lsn)
     // before 'block_id' (not include 'block_id'), otherwise, need delete all blocks
     // before 'max_block_id'(include 'max_block_id') and reset 'log_tail_' to 'lsn';
     truncate_end_block_id = MIN(block_id, max_block_id + 1);
+    hot_cache_.trim(LSN(truncate_end_block_id * logical_block_size_));
     PALF_LOG(INFO, "truncate_prefix_blocks trace", K(truncate_end_block_id), KPC(this));
     for (block_id_t i = min_block_id; i < truncate_end_block_id && OB_SUCC(ret); i++) {
       if (OB_FAIL(delete_block(i)) && OB_NO_SUCH_FILE_OR_DIRECTORY != ret) {
@@ -381,6 +400,7 @@ int LogStorage::truncate_prefix_blocks(const LSN &lsn)
   if (OB_SUCC(ret) && block_id > max_block_id) {
     PALF_LOG(WARN, "need reset log_tail", K(ret), K(block_id),
              KPC(this));
+    hot_cache_.reset();
 		reset_log_tail_for_last_block_(lsn, false);
     block_mgr_.reset(lsn_2_block(lsn, logical_block_size_));
   }
@@ -404,6 +424,7 @@ int LogStorage::begin_flashback(const LSN &start_lsn_of_block)
   } else if (OB_FAIL(block_mgr_.create_tmp_block_handler(tmp_block_id))) {
     PALF_LOG(ERROR, "LogBlockMgr create_tmp_block_handler failed", K(ret), KPC(this), K(start_lsn_of_block));
   } else {
+    hot_cache_.reset();
     const LSN origin_log_tail = log_tail_;
     // make tmp block be writeable, set log_tail_ to start_lsn_of_block.
     reset_log_tail_for_last_block_(start_lsn_of_block, true);
@@ -439,6 +460,7 @@ int LogStorage::end_flashback(const LSN &start_lsn_of_block)
     PALF_LOG(ERROR, "LogBlockMgr rename_tmp_block_handler_to_normal failed", K(ret), KPC(this),
         K(start_lsn_of_block));
   } else {
+    hot_cache_.reset();
 		ObSpinLockGuard guard(tail_info_lock_);
     readable_log_tail_ = log_tail_;
     PALF_EVENT("[END STORAGE FLASHBACK]", palf_id_, KPC(this), K(start_lsn_of_block));
@@ -814,6 +836,11 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   if (read_lsn >= log_tail) {
     ret = OB_ERR_OUT_OF_UPPER_BOUND;
     PALF_LOG(WARN, "read something out of upper bound", K(ret), K(read_lsn), K(log_tail_));
+  } else if (real_read_offset == get_phy_offset_(read_lsn)
+             && real_in_read_size <= read_buf.buf_len_
+             && OB_SUCCESS == hot_cache_.read(read_lsn, real_in_read_size,
+                                              read_buf.buf_, out_read_size)) {
+    PALF_LOG(TRACE, "inner_pread hit hot cache", K(ret), K(read_lsn), K(real_in_read_size));
   } else if (OB_FAIL(log_reader_.pread(read_block_id,
                                        real_read_offset,
                                        real_in_read_size,
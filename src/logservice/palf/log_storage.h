@@ -18,6 +18,7 @@
 #include "log_block_header.h"      // LogBlockHeader
 #include "log_block_mgr.h"         // LogBlockMgr
 #include "log_reader.h"            // LogReader
+#include "log_hot_cache.h"         // LogHotCache
 #include "log_storage_interface.h" // ILogStorage
 #include "log_writer_utils.h"      // LogWriteBuf
 #include "lsn.h"                   // LSN
@@ -66,6 +67,8 @@ public:
            LSN &lsn);
 
   int load_manifest_for_meta_storage(block_id_t &expected_next_block_id);
+  // Cache recently written logs in memory, pread will try to read them from cache firstly.
+  int init_hot_cache(LogHotCacheQuota *hot_cache_quota);
   void destroy();
 
   int writev(const LSNArray &lsn_array, const LogWriteBufArray &write_buf_array, const SCNArray &scn_array);
@@ -115,7 +118,8 @@ public:
                K_(block_mgr),
                K(logical_block_size_),
                K(curr_block_writable_size_),
-               KP(block_header_serialize_buf_));
+               KP(block_header_serialize_buf_),
+               K_(hot_cache));
 
 private:
   int do_init_(const char *log_dir,
@@ -163,6 +167,7 @@ private:
   // Used to perform IO tasks in the background
   LogBlockMgr block_mgr_;
   LogReader log_reader_;
+  LogHotCache hot_cache_;
   LSN log_tail_;
   // always same as 'log_tail_' except in process of flashback.
   LSN readable_log_tail_;
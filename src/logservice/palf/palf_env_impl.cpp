@@ -141,6 +141,8 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(common::ObLatchIds::PALF_ENV_LOCK),
                              block_gc_timer_task_(),
                              log_updater_(),
                              disk_options_wrapper_(),
+                             storage_compress_options_(),
+                             hot_cache_quota_(),
                              check_disk_print_log_interval_(OB_INVALID_TIMESTAMP),
                              self_(),
                              palf_handle_impl_map_(64),  // 指定min_size=64
@@ -218,7 +220,10 @@ int PalfEnvImpl::init(
     PALF_LOG(ERROR, "disk_options_wrapper_ init failed", K(ret));
   } else if (OB_FAIL(log_updater_.init(this))) {
     PALF_LOG(ERROR, "LogUpdater init failed", K(ret));
+  } else if (OB_FAIL(hot_cache_quota_.init(tenant_id, options.hot_cache_options_.cache_size_))) {
+    PALF_LOG(ERROR, "LogHotCacheQuota init failed", K(ret), K(options));
   } else {
+    storage_compress_options_ = options.storage_compress_options_;
     log_alloc_mgr_ = log_alloc_mgr;
     log_block_pool_ = log_block_pool;
     self_ = self;
@@ -304,6 +309,8 @@ void PalfEnvImpl::destroy()
   log_dir_[0] = '\0';
   tmp_log_dir_[0] = '\0';
   disk_options_wrapper_.reset();
+  storage_compress_options_.reset();
+  hot_cache_quota_.destroy();
 }
 
 // NB: not thread safe
@@ -797,6 +804,8 @@ int PalfEnvImpl::update_options(const PalfOptions &options)
   } else if (OB_FAIL(log_rpc_.update_transport_compress_options(options.compress_options_))) {
     PALF_LOG(WARN, "update_transport_compress_options failed", K(ret), K(options));
   } else {
+    storage_compress_options_ = options.storage_compress_options_;
+    hot_cache_quota_.set_cache_size(options.hot_cache_options_.cache_size_);
     PALF_LOG(INFO, "update_palf_options success", K(options));
   }
   return ret;
@@ -810,6 +819,8 @@ int PalfEnvImpl::get_options(PalfOptions &options)
   } else {
     options.disk_options_ = disk_options_wrapper_.get_disk_opts_for_recycling_blocks();
     options.compress_options_ = log_rpc_.get_compress_opts();
+    options.storage_compress_options_ = storage_compress_options_;
+    options.hot_cache_options_.cache_size_ = hot_cache_quota_.get_cache_size();
   }
   return ret;
 }
@@ -1153,6 +1164,17 @@ int64_t PalfEnvImpl::get_tenant_id()
 {
   return tenant_id_;
 }
+
+common::ObCompressorType PalfEnvImpl::get_log_compress_func()
+{
+  return storage_compress_options_.get_compress_func();
+}
+
+LogHotCacheQuota *PalfEnvImpl::get_hot_cache_quota()
+{
+  return &hot_cache_quota_;
+}
+
 int PalfEnvImpl::update_replayable_point(const SCN &replayable_scn)
 {
   int ret = OB_SUCCESS;
@@ -162,6 +162,10 @@ public:
   virtual bool check_disk_space_enough() = 0;
   virtual int get_io_start_time(int64_t &last_working_time) = 0;
   virtual int64_t get_tenant_id() = 0;
+  // NONE_COMPRESSOR means LogEntry should not be compressed
+  virtual common::ObCompressorType get_log_compress_func() = 0;
+  // memory quota shared by hot caches of all palf instances
+  virtual LogHotCacheQuota *get_hot_cache_quota() = 0;
   // should be removed in version 4.2.0.0
   virtual int update_replayable_point(const SCN &replayable_scn) = 0;
   VIRTUAL_TO_STRING_KV("IPalfEnvImpl", "Dummy");
@@ -227,6 +231,8 @@ public:
   common::ObILogAllocator* get_log_allocator() override final;
   int get_io_start_time(int64_t &last_working_time) override final;
   int64_t get_tenant_id() override final;
+  common::ObCompressorType get_log_compress_func() override final;
+  LogHotCacheQuota *get_hot_cache_quota() override final;
   int update_replayable_point(const SCN &replayable_scn) override final;
   INHERIT_TO_STRING_KV("IPalfEnvImpl", IPalfEnvImpl, K_(self), K_(log_dir), K_(disk_options_wrapper),
       KPC(log_alloc_mgr_));
@@ -317,6 +323,8 @@ private:
   LogUpdater log_updater_;
 
   PalfDiskOptionsWrapper disk_options_wrapper_;
+  PalfStorageCompressOptions storage_compress_options_;
+  LogHotCacheQuota hot_cache_quota_;
   int64_t check_disk_print_log_interval_;
 
   char log_dir_[common::MAX_PATH_SIZE];
@@ -24,6 +24,7 @@
 #include "log_engine.h"                                // LogEngine
 #include "election/interface/election_priority.h"
 #include "palf_iterator.h"                             // Iterator
+#include "log_compressor.h"                            // LogCompressor
 #include "palf_env_impl.h"                             // IPalfEnvImpl::
 
 namespace oceanbase
@@ -140,7 +141,8 @@ int PalfHandleImpl::init(const int64_t palf_id,
     ret = OB_ERR_UNEXPECTED;
     PALF_LOG(ERROR, "error unexpected", K(ret), K(palf_id));
   } else if (OB_FAIL(log_engine_.init(palf_id, log_dir, log_meta, alloc_mgr, log_block_pool, log_rpc, \
-          log_io_worker, palf_epoch, PALF_BLOCK_SIZE, PALF_META_BLOCK_SIZE))) {
+          log_io_worker, palf_env_impl->get_hot_cache_quota(), palf_epoch, PALF_BLOCK_SIZE,
+          PALF_META_BLOCK_SIZE))) {
     PALF_LOG(WARN, "LogEngine init failed", K(ret), K(palf_id), K(log_dir), K(alloc_mgr),
         K(log_rpc), K(log_io_worker));
   } else if (OB_FAIL(do_init_mem_(palf_id, palf_base_info, log_meta, log_dir, self, fetch_log_engine,
@@ -185,12 +187,13 @@ int PalfHandleImpl::load(const int64_t palf_id,
              || NULL == alloc_mgr
              || NULL == log_rpc
              || NULL == log_io_worker
+             || NULL == palf_env_impl
              || false == self.is_valid()) {
     ret = OB_INVALID_ARGUMENT;
     PALF_LOG(ERROR, "Invalid argument!!!", K(ret), K(palf_id), K(log_dir), K(alloc_mgr),
-        K(log_rpc), K(log_io_worker));
+        K(log_rpc), K(log_io_worker), K(palf_env_impl));
   } else if (OB_FAIL(log_engine_.load(palf_id, log_dir, alloc_mgr, log_block_pool, log_rpc,
-        log_io_worker, entry_header, palf_epoch, is_integrity, PALF_BLOCK_SIZE, PALF_META_BLOCK_SIZE))) {
+        log_io_worker, palf_env_impl->get_hot_cache_quota(), entry_header, palf_epoch, is_integrity, PALF_BLOCK_SIZE, PALF_META_BLOCK_SIZE))) {
     PALF_LOG(WARN, "LogEngine load failed", K(ret), K(palf_id));
     // NB: when 'entry_header' is invalid, means that there is no data on disk, and set max_committed_end_lsn
     //     to 'base_lsn_', we will generate default PalfBaseInfo or get it from LogSnapshotMeta(rebuild).
@@ -393,7 +396,7 @@ int PalfHandleImpl::submit_log(
       if (palf_reach_time_interval(200 * 1000, chaning_config_warn_time_)) {
         PALF_LOG(WARN, "can not submit log when memberlist is being changed", KPC(this));
       }
-    } else if (OB_FAIL(sw_.submit_log(buf, buf_len, ref_scn, lsn, scn))) {
+    } else if (OB_FAIL(submit_log_to_sw_(buf, buf_len, ref_scn, lsn, scn))) {
       if (OB_EAGAIN != ret) {
         PALF_LOG(WARN, "submit_log failed", KPC(this), KP(buf), K(buf_len));
       }
@@ -408,6 +411,44 @@ int PalfHandleImpl::submit_log(
   return ret;
 }
 
+int PalfHandleImpl::submit_log_to_sw_(const char *buf,
+                                      const int64_t buf_len,
+                                      const SCN &ref_scn,
+                                      LSN &lsn,
+                                      SCN &scn)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  const common::ObCompressorType compressor_type = palf_env_impl_->get_log_compress_func();
+  // submit_log is called concurrently, so the compress buffer is kept by each thread
+  RLOCAL(LogCompressBuf, compress_buf);
+  int64_t compress_buf_size = 0;
+  int64_t compressed_len = 0;
+  bool is_compressed = false;
+  if (common::ObCompressorType::NONE_COMPRESSOR == compressor_type
+      || buf_len < LogCompressor::MIN_COMPRESS_SIZE) {
+  } else if (OB_TMP_FAIL(LogCompressor::get_max_compressed_size(compressor_type, buf_len, compress_buf_size))) {
+    PALF_LOG(WARN, "get_max_compressed_size failed", K(tmp_ret), K_(palf_id), K(compressor_type), K(buf_len));
+  } else if (OB_TMP_FAIL(compress_buf.reserve(compress_buf_size))) {
+    PALF_LOG(WARN, "reserve compress buffer failed", K(tmp_ret), K_(palf_id), K(compress_buf_size));
+  } else if (OB_TMP_FAIL(LogCompressor::compress(compressor_type, buf, buf_len,
+             compress_buf.get_buf(), compress_buf.get_buf_size(), compressed_len))) {
+    // OB_BUF_NOT_ENOUGH means the data can not be compressed smaller, submit the original data.
+    if (OB_BUF_NOT_ENOUGH != tmp_ret) {
+      PALF_LOG(WARN, "compress log failed", K(tmp_ret), K_(palf_id), K(compressor_type), K(buf_len));
+    }
+  } else {
+    is_compressed = true;
+  }
+  if (is_compressed) {
+    ret = sw_.submit_log(compress_buf.get_buf(), compressed_len, true, ref_scn, lsn, scn);
+  } else {
+    ret = sw_.submit_log(buf, buf_len, false, ref_scn, lsn, scn);
+  }
+  compress_buf.shrink();
+  return ret;
+}
+
 int PalfHandleImpl::get_palf_id(int64_t &palf_id) const
 {
   int ret = OB_SUCCESS;
@@ -891,6 +891,12 @@ public:
   int update_palf_stat() override final;
   TO_STRING_KV(K_(palf_id), K_(self), K_(has_set_deleted));
 private:
+  // compress log data by LogCompressor if needed and submit it to sliding window.
+  int submit_log_to_sw_(const char *buf,
+                        const int64_t buf_len,
+                        const share::SCN &ref_scn,
+                        LSN &lsn,
+                        share::SCN &scn);
   int do_init_mem_(const int64_t palf_id,
                    const PalfBaseInfo &palf_base_info,
                    const LogMeta &log_meta,
@@ -14,6 +14,7 @@
 #define OCEANBASE_LOGSERVICE_PALF_ITERATOR_
 #include "log_iterator_impl.h"           // LogIteratorImpl
 #include "log_iterator_storage.h"        // LogIteratorStorage
+#include "log_compressor.h"              // LogDecompressBuf
 //#include "log_define.h"                  // PALF_INITIAL_PROPOSAL_ID
 namespace oceanbase
 {
@@ -27,7 +28,7 @@ template <class PalfIteratorStorage, class LogEntryType>
 class PalfIterator
 {
 public:
-  PalfIterator() : iterator_storage_(), iterator_impl_(), is_inited_(false) {}
+  PalfIterator() : iterator_storage_(), iterator_impl_(), decompress_buf_(), is_inited_(false) {}
   ~PalfIterator() {destroy();}
 
   int init(const LSN &start_offset,
@@ -81,6 +82,7 @@ public:
       is_inited_ = false;
       iterator_impl_.destroy();
       iterator_storage_.destroy();
+      decompress_buf_.destroy();
     }
   }
 
@@ -158,7 +160,8 @@ public:
     }
     return ret;
   }
-  // @brief get log entry from iterator
+  // @brief get log entry from iterator, the data of entry may be compressed, see
+  // LogEntryHeader::is_compressed.
   // @retval
   //  OB_SUCCESS
   //  OB_INVALID_DATA
@@ -186,9 +189,10 @@ public:
       ret = OB_NOT_INIT;
     } else if (OB_FAIL(iterator_impl_.get_entry(entry, lsn, is_raw_write)) && OB_ITER_END != ret) {
       PALF_LOG(WARN, "PalfIterator get_entry failed", K(ret), K(entry), K(lsn), KPC(this));
+    } else if (OB_ITER_END == ret) {
+    } else if (OB_FAIL(decompress_buf_.decompress(entry, buffer, nbytes))) {
+      PALF_LOG(WARN, "PalfIterator decompress failed", K(ret), K(entry), K(lsn), KPC(this));
     } else {
-      buffer = entry.get_data_buf();
-      nbytes = entry.get_data_len();
       scn = entry.get_scn();
       PALF_LOG(TRACE, "PalfIterator get_entry success", K(ret), KPC(this), K(entry), K(is_raw_write));
     }
@@ -219,9 +223,10 @@ public:
       ret = OB_NOT_INIT;
     } else if (OB_FAIL(iterator_impl_.get_entry(entry, lsn, unused_is_raw_write)) && OB_ITER_END != ret) {
       PALF_LOG(WARN, "PalfIterator get_entry failed", K(ret), K(entry), K(lsn), KPC(this));
+    } else if (OB_ITER_END == ret) {
+    } else if (OB_FAIL(decompress_buf_.decompress(entry, buffer, nbytes))) {
+      PALF_LOG(WARN, "PalfIterator decompress failed", K(ret), K(entry), K(lsn), KPC(this));
     } else {
-      buffer = entry.get_data_buf();
-      nbytes = entry.get_data_len();
       scn = entry.get_scn();
       PALF_LOG(TRACE, "PalfIterator get_entry success", K(iterator_impl_), K(ret), KPC(this), K(entry));
     }
@@ -271,6 +276,8 @@ private:
 private:
   PalfIteratorStorage iterator_storage_;
   LogIteratorImpl<LogEntryType> iterator_impl_;
+  // holds decompressed data returned by get_entry(buffer, nbytes, ...)
+  LogDecompressBuf decompress_buf_;
   bool is_inited_;
 };
 
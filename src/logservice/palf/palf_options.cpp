@@ -21,11 +21,14 @@ void PalfOptions::reset()
 {
   disk_options_.reset();
   compress_options_.reset();
+  storage_compress_options_.reset();
+  hot_cache_options_.reset();
 }
 
 bool PalfOptions::is_valid() const
 {
-  return disk_options_.is_valid() && compress_options_.is_valid();
+  return disk_options_.is_valid() && compress_options_.is_valid() && storage_compress_options_.is_valid()
+    && hot_cache_options_.is_valid();
 }
 
 void PalfDiskOptions::reset()
@@ -83,5 +86,51 @@ PalfTransportCompressOptions &PalfTransportCompressOptions::operator=(const Palf
   }
   return *this;
 }
+
+void PalfStorageCompressOptions::reset()
+{
+  enable_storage_compress_ = false;
+  storage_compress_func_ = ObCompressorType::INVALID_COMPRESSOR;
+}
+
+bool PalfStorageCompressOptions::is_valid() const
+{
+  return !enable_storage_compress_ || (ObCompressorType::INVALID_COMPRESSOR != storage_compress_func_);
+}
+
+//为了使用时可以无锁,需要考虑修改顺序
+PalfStorageCompressOptions &PalfStorageCompressOptions::operator=(const PalfStorageCompressOptions &other)
+{
+  if (!other.enable_storage_compress_) {
+    enable_storage_compress_ = other.enable_storage_compress_;
+    MEM_BARRIER();
+    storage_compress_func_ = other.storage_compress_func_;
+  } else {
+    storage_compress_func_ = other.storage_compress_func_;
+    MEM_BARRIER();
+    enable_storage_compress_ = other.enable_storage_compress_;
+  }
+  return *this;
+}
+
+ObCompressorType PalfStorageCompressOptions::get_compress_func() const
+{
+  ObCompressorType compress_func = ObCompressorType::NONE_COMPRESSOR;
+  if (ATOMIC_LOAD(&enable_storage_compress_)) {
+    MEM_BARRIER();
+    compress_func = storage_compress_func_;
+  }
+  return compress_func;
+}
+
+void PalfHotCacheOptions::reset()
+{
+  cache_size_ = PALF_HOT_CACHE_SIZE;
+}
+
+bool PalfHotCacheOptions::is_valid() const
+{
+  return 0 <= cache_size_;
+}
 }
 }
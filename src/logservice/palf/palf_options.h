@@ -14,6 +14,7 @@
 #define OCEANBASE_LOGSERVICE_PALF_OPTIONS_
 #include "lib/compress/ob_compress_util.h"
 #include "share/ob_partition_modify.h"
+#include "log_define.h"
 #include <stdint.h>
 namespace oceanbase
 {
@@ -158,19 +159,60 @@ public:
                K(transport_compress_func_));
 };
 
+// Compression of LogEntry persisted in clog disk, archive and transported to followers.
+struct PalfStorageCompressOptions
+{
+public:
+  PalfStorageCompressOptions() :
+    enable_storage_compress_(false),
+    storage_compress_func_(ObCompressorType::INVALID_COMPRESSOR)
+  {}
+  ~PalfStorageCompressOptions() { reset(); }
+  void reset();
+  bool is_valid() const;
+  PalfStorageCompressOptions &operator=(const PalfStorageCompressOptions &other);
+  // NONE_COMPRESSOR means not to compress
+  ObCompressorType get_compress_func() const;
+public:
+  bool enable_storage_compress_;
+  ObCompressorType storage_compress_func_;
+  TO_STRING_KV(K(enable_storage_compress_),
+               K(storage_compress_func_));
+};
+
+// Cache of recently flushed logs for each palf.
+struct PalfHotCacheOptions
+{
+public:
+  PalfHotCacheOptions() : cache_size_(PALF_HOT_CACHE_SIZE) {}
+  ~PalfHotCacheOptions() { reset(); }
+  void reset();
+  bool is_valid() const;
+public:
+  // 0 means not to cache logs
+  int64_t cache_size_;
+  TO_STRING_KV(K(cache_size_));
+};
+
 struct PalfOptions
 {
   PalfOptions() : disk_options_(),
-                  compress_options_()
+                  compress_options_(),
+                  storage_compress_options_(),
+                  hot_cache_options_()
   {}
   ~PalfOptions() { reset(); }
   void reset();
   bool is_valid() const;
   TO_STRING_KV(K(disk_options_),
-               K(compress_options_));
+               K(compress_options_),
+               K(storage_compress_options_),
+               K(hot_cache_options_));
 public:
   PalfDiskOptions disk_options_;
   PalfTransportCompressOptions compress_options_;
+  PalfStorageCompressOptions storage_compress_options_;
+  PalfHotCacheOptions hot_cache_options_;
 };
 } // end namespace palf
 } // end namspace oceanbase
@@ -16,6 +16,8 @@
 #include "ob_mysql_result_set.h"
 #include "obmp_base.h"
 #include "obsm_row.h"
+#include "obsm_batch_row.h"
+#include "sql/engine/ob_operator.h"
 #include "rpc/obmysql/packet/ompk_row.h"
 #include "rpc/obmysql/packet/ompk_resheader.h"
 #include "rpc/obmysql/packet/ompk_field.h"
@@ -141,7 +143,17 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       LOG_WARN("fields is null", K(ret), KP(fields));
     }
   }
-  while (OB_SUCC(ret) && row_num < limit_count && !OB_FAIL(result.get_next_row(result_row)) ) {
+  bool is_batch_encoded = false;
+  if (OB_SUCC(ret) && !is_ps_protocol && !is_packed && !is_prexecute_) {
+    if (OB_FAIL(response_query_result_batch(result, *fields, has_more_result, can_retry,
+                                            limit_count, row_num, is_batch_encoded))) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("fail to response query result in batch", K(ret), K(row_num));
+      }
+    }
+  }
+  while (OB_SUCC(ret) && !is_batch_encoded && row_num < limit_count
+         && !OB_FAIL(result.get_next_row(result_row)) ) {
     ObNewRow *row = const_cast<ObNewRow*>(result_row);
     if (is_prexecute_ && row_num == limit_count - 1) {
       LOG_DEBUG("is_prexecute_ and row_num is equal with limit_count", K(limit_count));
@@ -222,7 +234,7 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       }
     }
   }
-  if (is_cac_found_rows) {
+  if (is_cac_found_rows && !is_batch_encoded) {
     while (OB_SUCC(ret) && !OB_FAIL(result.get_next_row(result_row))) {
       // nothing
     }
@@ -243,6 +255,74 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
   return ret;
 }
 
+// Encode the result rows from the batches of the vectorized root operator directly.
+// is_batch_encoded is false if the result is not supported, and no row is fetched.
+int ObQueryDriver::response_query_result_batch(ObResultSet &result,
+                                               const ColumnsFieldIArray &fields,
+                                               bool has_more_result,
+                                               bool &can_retry,
+                                               const int64_t limit_count,
+                                               int64_t &row_num,
+                                               bool &is_batch_encoded)
+{
+  int ret = OB_SUCCESS;
+  ObOperator *root = NULL;
+  ObCharsetType result_charset = CHARSET_INVALID;
+  ObSMBatchRowEncoder encoder;
+  const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
+  is_batch_encoded = false;
+  if (!session_.is_enable_batch_result_encoding()
+      || lib::is_oracle_mode()
+      || NULL == (root = result.get_vectorized_root())) {
+    // encode row by row
+  } else if (OB_FAIL(session_.get_character_set_results(result_charset))) {
+    LOG_WARN("fail to get result charset", K(ret));
+  } else if (OB_FAIL(encoder.init(root->get_spec().output_, root->get_eval_ctx(), fields,
+                                  dtc_params, result_charset))) {
+    if (OB_NOT_SUPPORTED == ret) {
+      ret = OB_SUCCESS;
+    } else {
+      LOG_WARN("fail to init batch row encoder", K(ret));
+    }
+  } else {
+    is_batch_encoded = true;
+    const bool is_cac_found_rows = result.is_calc_found_rows();
+    const ObBatchRows *brs = NULL;
+    bool iter_end = false;
+    while (OB_SUCC(ret) && !iter_end && (row_num < limit_count || is_cac_found_rows)) {
+      if (OB_FAIL(result.get_next_batch(INT64_MAX, brs))) {
+        LOG_WARN("fail to get next batch", K(ret), K(row_num));
+      } else {
+        iter_end = brs->end_;
+        encoder.bind_batch();
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < brs->size_ && row_num < limit_count; i++) {
+        if (brs->skip_->at(i)) {
+          continue;
+        } else if (can_retry) {
+          can_retry = false; // 已经获取到第一行数据，不再重试了
+          if (OB_FAIL(response_query_header(result, has_more_result, false, is_prexecute_))) {
+            LOG_WARN("fail to response query header", K(ret), K(row_num), K(can_retry));
+          }
+        }
+        if (OB_SUCC(ret)) {
+          ObSMBatchRow sm(encoder, i);
+          OMPKRow rp(sm);
+          if (OB_FAIL(sender_.response_packet(rp, &result.get_session()))) {
+            LOG_WARN("response packet fail", K(ret), K(i), K(row_num), K(can_retry));
+          } else {
+            ++row_num;
+          }
+        }
+      }
+    }
+    if (OB_SUCC(ret) && iter_end) {
+      ret = OB_ITER_END;
+    }
+  }
+  return ret;
+}
+
 int ObQueryDriver::convert_field_charset(ObIAllocator& allocator,
                                          const ObCollationType& from_collation,
                                          const ObCollationType& dest_collation,
@@ -106,6 +106,13 @@ private:
                                            const common::ObCollationType &from_collation,
                                            const common::ObString &from_string,
                                            bool &is_not_match);
+  int response_query_result_batch(sql::ObResultSet &result,
+                                  const common::ColumnsFieldIArray &fields,
+                                  bool has_more_result,
+                                  bool &can_retry,
+                                  const int64_t limit_count,
+                                  int64_t &row_num,
+                                  bool &is_batch_encoded);
 
 protected:
   /* variables */
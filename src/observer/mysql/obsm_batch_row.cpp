@@ -0,0 +1,364 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SERVER
+
+#include "obsm_batch_row.h"
+
+#include "lib/charset/ob_charset.h"
+#include "lib/utility/ob_fast_convert.h"
+#include "rpc/obmysql/ob_mysql_global.h"
+#include "rpc/obmysql/ob_mysql_util.h"
+#include "share/datum/ob_datum.h"
+#include "sql/engine/expr/ob_expr.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+using namespace oceanbase::sql;
+
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const int32_t FRAC_DIVISORS[] = { 1000000, 100000, 10000, 1000, 100, 10, 1 };
+
+#define WRITE_TWO_DIGITS(ptr, v)                        \
+  do {                                                  \
+    MEMCPY((ptr), DIGIT_PAIRS + (v) * 2, 2);            \
+    (ptr) += 2;                                         \
+  } while (0)
+
+int ObSMBatchRowEncoder::init(const ObIArray<ObExpr *> &exprs,
+                              ObEvalCtx &eval_ctx,
+                              const ColumnsFieldIArray &fields,
+                              const ObDataTypeCastParams &dtc_params,
+                              const ObCharsetType result_charset)
+{
+  int ret = OB_SUCCESS;
+  columns_.reuse();
+  if (OB_UNLIKELY(exprs.count() != fields.count())) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_TRACE("output exprs mismatch with fields", K(ret), K(exprs.count()), K(fields.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < exprs.count(); i++) {
+    const ObExpr *expr = exprs.at(i);
+    const ObField &field = fields.at(i);
+    Column col;
+    if (OB_ISNULL(expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("output expr is null", K(ret), K(i));
+    } else if (!can_encode(expr->obj_meta_, result_charset)) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("output type is not supported by batch encoding", K(ret), K(i),
+                K(expr->obj_meta_));
+    } else {
+      col.expr_ = expr;
+      col.scale_ = field.accuracy_.get_scale();
+      col.zerofill_ = field.flags_ & ZEROFILL_FLAG;
+      col.zflength_ = field.length_;
+      switch (expr->obj_meta_.get_type_class()) {
+        case ObNullTC: col.kind_ = COL_NULL; break;
+        case ObIntTC: col.kind_ = COL_INT; break;
+        case ObUIntTC: col.kind_ = COL_UINT; break;
+        case ObFloatTC: col.kind_ = COL_FLOAT; break;
+        case ObDoubleTC: col.kind_ = COL_DOUBLE; break;
+        case ObNumberTC: col.kind_ = COL_NUMBER; break;
+        case ObDateTimeTC:
+          col.kind_ = expr->obj_meta_.is_timestamp() ? COL_TIMESTAMP : COL_DATETIME;
+          break;
+        case ObDateTC: col.kind_ = COL_DATE; break;
+        case ObTimeTC: col.kind_ = COL_TIME; break;
+        case ObYearTC: col.kind_ = COL_YEAR; break;
+        case ObStringTC: col.kind_ = COL_STRING; break;
+        default: {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected type class", K(ret), K(expr->obj_meta_));
+        }
+      }
+      if (OB_SUCC(ret) && OB_FAIL(columns_.push_back(col))) {
+        LOG_WARN("push back column failed", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    eval_ctx_ = &eval_ctx;
+    dtc_params_ = &dtc_params;
+  } else {
+    columns_.reuse();
+  }
+  return ret;
+}
+
+bool ObSMBatchRowEncoder::can_encode(const ObObjMeta &meta, const ObCharsetType result_charset)
+{
+  bool bret = false;
+  switch (meta.get_type_class()) {
+    case ObNullTC:
+    case ObIntTC:
+    case ObUIntTC:
+    case ObFloatTC:
+    case ObDoubleTC:
+    case ObNumberTC:
+    case ObDateTimeTC:
+    case ObDateTC:
+    case ObTimeTC:
+    case ObYearTC: {
+      bret = true;
+      break;
+    }
+    case ObStringTC: {
+      // same as the charset conversion of ObQueryDriver::convert_string_value_charset(),
+      // strings which need to be converted to the result charset are not supported
+      const ObCollationType cs_type = meta.get_collation_type();
+      bret = CS_TYPE_INVALID == cs_type
+          || CS_TYPE_BINARY == cs_type
+          || !ObCharset::is_valid_charset(result_charset)
+          || CHARSET_BINARY == result_charset
+          || ObCharset::charset_type_by_coll(cs_type) == result_charset;
+      break;
+    }
+    default: {
+      // text, lob, json, enum/set, bit, raw, extend, etc.
+      bret = false;
+    }
+  }
+  return bret;
+}
+
+void ObSMBatchRowEncoder::bind_batch()
+{
+  for (int64_t i = 0; i < columns_.count(); i++) {
+    Column &col = columns_.at(i);
+    col.datums_ = col.expr_->locate_batch_datums(*eval_ctx_);
+    col.is_batch_ = col.expr_->is_batch_result();
+  }
+}
+
+int ObSMBatchRowEncoder::encode_cell(const int64_t col_idx, const int64_t row_idx,
+                                     char *buf, const int64_t len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  const Column &col = columns_.at(col_idx);
+  const ObDatum &datum = col.datums_[col.is_batch_ ? row_idx : 0];
+  if (datum.is_null()) {
+    ret = ObMySQLUtil::store_null(buf, len, pos);
+  } else {
+    switch (col.kind_) {
+      case COL_NULL: {
+        ret = ObMySQLUtil::store_null(buf, len, pos);
+        break;
+      }
+      case COL_INT:
+      case COL_UINT: {
+        if (OB_UNLIKELY(col.zerofill_)) {
+          ret = ObMySQLUtil::int_cell_str(buf, len, datum.get_int(), col.expr_->obj_meta_.get_type(),
+                                          COL_UINT == col.kind_, TEXT, pos, true, col.zflength_);
+        } else {
+          ret = int_cell_str(buf, len, datum.get_int(), COL_UINT == col.kind_, pos);
+        }
+        break;
+      }
+      case COL_FLOAT: {
+        ret = ObMySQLUtil::float_cell_str(buf, len, datum.get_float(), TEXT, pos, col.scale_,
+                                          col.zerofill_, col.zflength_);
+        break;
+      }
+      case COL_DOUBLE: {
+        ret = ObMySQLUtil::double_cell_str(buf, len, datum.get_double(), TEXT, pos, col.scale_,
+                                           col.zerofill_, col.zflength_);
+        break;
+      }
+      case COL_NUMBER: {
+        number::ObNumber nmb(datum.get_number());
+        ret = ObMySQLUtil::number_cell_str(buf, len, nmb, pos, col.scale_,
+                                           col.zerofill_, col.zflength_);
+        break;
+      }
+      case COL_DATETIME: {
+        ret = datetime_cell_str(buf, len, datum.get_datetime(), col.scale_, pos);
+        break;
+      }
+      case COL_TIMESTAMP: {
+        ret = ObMySQLUtil::datetime_cell_str(buf, len, datum.get_timestamp(), TEXT, pos,
+                                             dtc_params_->tz_info_, col.scale_);
+        break;
+      }
+      case COL_DATE: {
+        ret = date_cell_str(buf, len, datum.get_date(), pos);
+        break;
+      }
+      case COL_TIME: {
+        ret = ObMySQLUtil::time_cell_str(buf, len, datum.get_time(), TEXT, pos, col.scale_);
+        break;
+      }
+      case COL_YEAR: {
+        ret = ObMySQLUtil::year_cell_str(buf, len, datum.get_year(), TEXT, pos);
+        break;
+      }
+      case COL_STRING: {
+        ret = ObMySQLUtil::varchar_cell_str(buf, len, datum.get_string(), false, pos);
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected column kind", K(ret), K(col));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObSMBatchRowEncoder::int_cell_str(char *buf, const int64_t len, const int64_t val,
+                                      const bool is_unsigned, int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  const bool is_neg = !is_unsigned && val < 0;
+  uint64_t uval = is_neg ? (0 - static_cast<uint64_t>(val)) : static_cast<uint64_t>(val);
+  const int64_t length = ob_fast_digits10(uval) + (is_neg ? 1 : 0);
+  if (OB_UNLIKELY(len - pos < length + 1)) {
+    ret = OB_SIZE_OVERFLOW;
+  } else {
+    // length < 251, stored in one byte
+    buf[pos] = static_cast<char>(length);
+    char *ptr = buf + pos + 1 + length;
+    while (uval >= 100) {
+      const uint64_t idx = (uval % 100) * 2;
+      uval /= 100;
+      *--ptr = DIGIT_PAIRS[idx + 1];
+      *--ptr = DIGIT_PAIRS[idx];
+    }
+    if (uval >= 10) {
+      *--ptr = DIGIT_PAIRS[uval * 2 + 1];
+      *--ptr = DIGIT_PAIRS[uval * 2];
+    } else {
+      *--ptr = static_cast<char>('0' + uval);
+    }
+    if (is_neg) {
+      *--ptr = '-';
+    }
+    pos += length + 1;
+  }
+  return ret;
+}
+
+int ObSMBatchRowEncoder::date_cell_str(char *buf, const int64_t len, const int32_t val,
+                                       int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  int32_t year = 0;
+  int32_t month = 0;
+  int32_t mday = 0;
+  if (OB_UNLIKELY(ObTimeConverter::ZERO_DATE == val || !days_to_ymd(val, year, month, mday))) {
+    ret = ObMySQLUtil::date_cell_str(buf, len, val, TEXT, pos);
+  } else if (OB_UNLIKELY(len - pos < DATE_CELL_LEN)) {
+    ret = OB_SIZE_OVERFLOW;
+  } else {
+    buf[pos] = static_cast<char>(DATE_CELL_LEN - 1);
+    write_ymd(buf + pos + 1, year, month, mday);
+    pos += DATE_CELL_LEN;
+  }
+  return ret;
+}
+
+int ObSMBatchRowEncoder::datetime_cell_str(char *buf, const int64_t len, const int64_t val,
+                                           const int16_t scale, int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  int64_t value = val;
+  int64_t usec = 0;
+  int32_t days = 0;
+  int32_t year = 0;
+  int32_t month = 0;
+  int32_t mday = 0;
+  bool is_fast = false;
+  if (OB_LIKELY(scale >= 0 && scale <= 6 && ObTimeConverter::ZERO_DATETIME != val)) {
+    // same as ObTimeConverter::datetime_to_str()
+    ObTimeConverter::round_datetime(scale, value);
+    days = static_cast<int32_t>(value / USECS_PER_DAY);
+    usec = value % USECS_PER_DAY;
+    if (usec < 0) {
+      --days;
+      usec += USECS_PER_DAY;
+    }
+    is_fast = days_to_ymd(days, year, month, mday);
+  }
+  if (OB_UNLIKELY(!is_fast)) {
+    ret = ObMySQLUtil::datetime_cell_str(buf, len, val, TEXT, pos, NULL, scale);
+  } else {
+    // YYYY-MM-DD hh:mm:ss[.fraction]
+    const int64_t length = 19 + (scale > 0 ? scale + 1 : 0);
+    if (OB_UNLIKELY(len - pos < length + 1)) {
+      ret = OB_SIZE_OVERFLOW;
+    } else {
+      char *ptr = buf + pos;
+      *ptr++ = static_cast<char>(length);
+      write_ymd(ptr, year, month, mday);
+      ptr += 10;
+      *ptr++ = ' ';
+      const int32_t secs = static_cast<int32_t>(usec / 1000000);
+      WRITE_TWO_DIGITS(ptr, secs / 3600);
+      *ptr++ = ':';
+      WRITE_TWO_DIGITS(ptr, secs / 60 % 60);
+      *ptr++ = ':';
+      WRITE_TWO_DIGITS(ptr, secs % 60);
+      if (scale > 0) {
+        *ptr++ = '.';
+        int32_t frac = static_cast<int32_t>(usec % 1000000) / FRAC_DIVISORS[scale];
+        for (int64_t i = scale - 1; i >= 0; i--) {
+          ptr[i] = static_cast<char>('0' + frac % 10);
+          frac /= 10;
+        }
+      }
+      pos += length + 1;
+    }
+  }
+  return ret;
+}
+
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+bool ObSMBatchRowEncoder::days_to_ymd(const int32_t days, int32_t &year, int32_t &month,
+                                      int32_t &mday)
+{
+  const int64_t z = static_cast<int64_t>(days) + 719468;
+  const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const int64_t doe = z - era * 146097;
+  const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const int64_t mp = (5 * doy + 2) / 153;
+  mday = static_cast<int32_t>(doy - (153 * mp + 2) / 5 + 1);
+  month = static_cast<int32_t>(mp < 10 ? mp + 3 : mp - 9);
+  const int64_t y = yoe + era * 400 + (month <= 2 ? 1 : 0);
+  year = static_cast<int32_t>(y);
+  return y >= 1 && y <= 9999;
+}
+
+void ObSMBatchRowEncoder::write_ymd(char *buf, const int32_t year, const int32_t month,
+                                    const int32_t mday)
+{
+  char *ptr = buf;
+  WRITE_TWO_DIGITS(ptr, year / 100);
+  WRITE_TWO_DIGITS(ptr, year % 100);
+  *ptr++ = '-';
+  WRITE_TWO_DIGITS(ptr, month);
+  *ptr++ = '-';
+  WRITE_TWO_DIGITS(ptr, mday);
+}
+
+#undef WRITE_TWO_DIGITS
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef _OCEABASE_COMMON_OBSM_BATCH_ROW_H_
+#define _OCEABASE_COMMON_OBSM_BATCH_ROW_H_
+
+#include "lib/timezone/ob_time_convert.h"
+#include "lib/container/ob_se_array.h"
+#include "rpc/obmysql/ob_mysql_row.h"
+#include "common/ob_field.h"
+#include "common/object/ob_object.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+struct ObExpr;
+struct ObEvalCtx;
+}
+
+namespace common
+{
+struct ObDatum;
+
+// Text protocol encoder of the rows in the batch result of a vectorized root operator.
+// Cells are encoded from the output expr datums directly, without converting the row
+// to ObNewRow first. Integers, dates and datetimes are formatted into the packet buffer
+// by the kernels below, other types reuse the ObMySQLUtil cell encoders.
+//
+// Only the output types which need no value conversion before response are supported,
+// see can_encode(). The caller should fall back to ObSMRow if init() returns
+// OB_NOT_SUPPORTED.
+class ObSMBatchRowEncoder
+{
+public:
+  // length byte and "-9223372036854775808"
+  static const int64_t MAX_INT_CELL_LEN = 1 + 20;
+  // length byte and "YYYY-MM-DD"
+  static const int64_t DATE_CELL_LEN = 1 + 10;
+  // length byte and "YYYY-MM-DD hh:mm:ss.ffffff"
+  static const int64_t MAX_DATETIME_CELL_LEN = 1 + 26;
+
+  ObSMBatchRowEncoder() : eval_ctx_(NULL), dtc_params_(NULL), columns_() {}
+  ~ObSMBatchRowEncoder() {}
+
+  int init(const common::ObIArray<sql::ObExpr *> &exprs,
+           sql::ObEvalCtx &eval_ctx,
+           const ColumnsFieldIArray &fields,
+           const ObDataTypeCastParams &dtc_params,
+           const ObCharsetType result_charset);
+  // locate the datums of the batch, must be called after each get_next_batch()
+  void bind_batch();
+  int64_t get_column_cnt() const { return columns_.count(); }
+  int encode_cell(const int64_t col_idx, const int64_t row_idx,
+                  char *buf, const int64_t len, int64_t &pos) const;
+
+  static bool can_encode(const ObObjMeta &meta, const ObCharsetType result_charset);
+
+  // Text formatting kernels. They write the length encoded cell at buf + pos and return
+  // OB_SIZE_OVERFLOW without moving pos if the buffer is not enough. Values not handled
+  // by the kernels (zero date, years out of [1, 9999]) are encoded by ObMySQLUtil.
+  static int int_cell_str(char *buf, const int64_t len, const int64_t val,
+                          const bool is_unsigned, int64_t &pos);
+  static int date_cell_str(char *buf, const int64_t len, const int32_t val, int64_t &pos);
+  static int datetime_cell_str(char *buf, const int64_t len, const int64_t val,
+                               const int16_t scale, int64_t &pos);
+
+private:
+  enum ColumnKind
+  {
+    COL_NULL,
+    COL_INT,
+    COL_UINT,
+    COL_FLOAT,
+    COL_DOUBLE,
+    COL_NUMBER,
+    COL_DATETIME,
+    COL_TIMESTAMP,
+    COL_DATE,
+    COL_TIME,
+    COL_YEAR,
+    COL_STRING,
+  };
+  struct Column
+  {
+    Column()
+      : expr_(NULL), datums_(NULL), is_batch_(false), kind_(COL_NULL),
+        scale_(0), zerofill_(false), zflength_(0)
+    {}
+    TO_STRING_KV(KP_(expr), KP_(datums), K_(is_batch), K_(kind), K_(scale), K_(zerofill),
+                 K_(zflength));
+
+    const sql::ObExpr *expr_;
+    const ObDatum *datums_;
+    bool is_batch_;
+    ColumnKind kind_;
+    int16_t scale_;
+    bool zerofill_;
+    int32_t zflength_;
+  };
+  // convert days since 1970-01-01 to the civil date, return false if the year is
+  // out of [1, 9999]
+  static bool days_to_ymd(const int32_t days, int32_t &year, int32_t &month, int32_t &mday);
+  static void write_ymd(char *buf, const int32_t year, const int32_t month, const int32_t mday);
+
+private:
+  sql::ObEvalCtx *eval_ctx_;
+  const ObDataTypeCastParams *dtc_params_;
+  common::ObSEArray<Column, 16> columns_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObSMBatchRowEncoder);
+};
+
+// One row in the batch, encoded by ObSMBatchRowEncoder.
+class ObSMBatchRow
+    : public obmysql::ObMySQLRow
+{
+public:
+  ObSMBatchRow(const ObSMBatchRowEncoder &encoder, const int64_t row_idx)
+    : ObMySQLRow(obmysql::TEXT), encoder_(encoder), row_idx_(row_idx)
+  {}
+  virtual ~ObSMBatchRow() {}
+
+protected:
+  virtual int64_t get_cells_cnt() const { return encoder_.get_column_cnt(); }
+  virtual int encode_cell(
+      int64_t idx, char *buf,
+      int64_t len, int64_t &pos, char *bitmap) const
+  {
+    UNUSED(bitmap);
+    return encoder_.encode_cell(idx, row_idx_, buf, len, pos);
+  }
+
+private:
+  const ObSMBatchRowEncoder &encoder_;
+  const int64_t row_idx_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObSMBatchRow);
+};
+
+} // end of namespace common
+} // end of namespace oceanbase
+
+#endif /* _OCEABASE_COMMON_OBSM_BATCH_ROW_H_ */
@@ -207,6 +207,8 @@ int ObSrvNetworkFrame::start()
         if (OB_FAIL(obmysql::global_sql_nio_server->start(
                 GCONF.mysql_port, &deliver_, sql_net_thread_count))) {
           LOG_ERROR("sql nio server start failed", K(ret));
+        } else {
+          obmysql::global_sql_nio_server->set_busy_poll_time(GCONF._sql_nio_busy_poll_time);
         }
       }
     }
@@ -253,6 +255,8 @@ int ObSrvNetworkFrame::reload_config()
                                                                         tcp_keepidle, tcp_keepintvl,
                                                                         tcp_keepcnt))) {
     LOG_WARN("Failed to set sql tcp keepalive parameters for sql nio server", K(ret));
+  } else if (enable_new_sql_nio() && NULL != global_sql_nio_server) {
+    global_sql_nio_server->set_busy_poll_time(GCONF._sql_nio_busy_poll_time);
   }
 
   return ret;
@@ -40,6 +40,7 @@
 #include "sql/das/ob_data_access_service.h"
 #include "sql/engine/ob_tenant_sql_memory_manager.h"
 #include "sql/engine/px/ob_px_admission.h"
+#include "sql/plan_cache/ob_plan_cache_snapshot.h"
 #include "share/ob_get_compat_mode.h"
 #include "storage/tx/wrs/ob_tenant_weak_read_service.h"   // ObTenantWeakReadService
 #include "share/allocator/ob_tenant_mutil_allocator.h"
@@ -1612,6 +1613,12 @@ int ObMultiTenant::clear_persistent_data(const uint64_t tenant_id)
     }
   }
 
+  if (OB_FAIL(ret)) {
+    // do nothing
+  } else if (OB_FAIL(sql::ObPlanCacheSnapshot::remove(tenant_id))) {
+    LOG_WARN("fail to remove plan cache snapshot", K(ret), K(tenant_id));
+  }
+
   return ret;
 }
 
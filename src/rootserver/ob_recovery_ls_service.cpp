@@ -19,6 +19,7 @@
 #include "logservice/ob_log_base_header.h"          //ObLogBaseHeader
 #include "logservice/ob_log_handler.h"              //ObLogHandler
 #include "logservice/palf/log_entry.h"              //LogEntry
+#include "logservice/palf/log_compressor.h"         //LogDecompressBuf
 #include "logservice/palf/log_define.h"
 #include "share/scn.h"//SCN
 #include "logservice/ob_garbage_collector.h"//ObGCLSLog
@@ -200,6 +201,7 @@ int ObRecoveryLSService::process_ls_log_(
 {
   int ret = OB_SUCCESS;
   palf::LogEntry log_entry;
+  palf::LogDecompressBuf decompress_buf;
   palf::LSN target_lsn;
   SCN sync_scn;
   SCN last_sync_scn;
@@ -219,8 +221,8 @@ int ObRecoveryLSService::process_ls_log_(
     } else {
       LOG_DEBUG("get log", K(log_entry), K(target_lsn), K(start_scn));
       sync_scn = log_entry.get_scn();
-      const char *log_buf = log_entry.get_data_buf();
-      const int64_t log_length = log_entry.get_data_len();
+      const char *log_buf = NULL;
+      int64_t log_length = 0;
       logservice::ObLogBaseHeader header;
       const int64_t HEADER_SIZE = header.get_serialize_size();
       int64_t log_pos = 0;
@@ -241,6 +243,8 @@ int ObRecoveryLSService::process_ls_log_(
                    KR(ret), K(sync_scn), K(tenant_info), K(log_entry), K(target_lsn), K(start_scn));
           start_scn.reset();
         }
+      } else if (OB_FAIL(decompress_buf.decompress(log_entry, log_buf, log_length))) {
+        LOG_WARN("failed to decompress log entry", KR(ret), K(log_entry), K(target_lsn));
       } else if (OB_FAIL(header.deserialize(log_buf, HEADER_SIZE, log_pos))) {
         LOG_WARN("failed to deserialize", KR(ret), K(HEADER_SIZE));
       } else if (OB_UNLIKELY(log_pos >= log_length)) {
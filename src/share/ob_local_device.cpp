@@ -12,6 +12,7 @@
 
 #include <sys/vfs.h>
 #include <sys/statvfs.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #include <linux/falloc.h>
 #include "share/ob_local_device.h"
@@ -73,6 +74,307 @@ void *ObLocalIOEvents::get_ith_data(const int64_t i) const
 }
 
 
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+/**
+ * ---------------------------------------------ObLocalIOUringContext---------------------------------------------
+ */
+ObLocalIOUringContext::ObLocalIOUringContext()
+  : ring_fd_(-1),
+    sq_entries_(0),
+    cq_entries_(0),
+    fixed_fd_(-1),
+    enable_sqpoll_(false),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_ring_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    sqes_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_ring_mask_(nullptr),
+    cqes_(nullptr),
+    sq_ring_ptr_(MAP_FAILED),
+    sq_ring_size_(0),
+    cq_ring_ptr_(MAP_FAILED),
+    cq_ring_size_(0),
+    sqes_size_(0),
+    sq_lock_(),
+    submitting_(false)
+{
+}
+
+ObLocalIOUringContext::~ObLocalIOUringContext()
+{
+  destroy();
+}
+
+int ObLocalIOUringContext::init(const uint32_t max_events, const bool enable_sqpoll, const int fixed_fd)
+{
+  int ret = OB_SUCCESS;
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  if (enable_sqpoll) {
+    params.flags |= IORING_SETUP_SQPOLL;
+    params.sq_thread_idle = 1000; // ms before the kernel polling thread goes to sleep
+  }
+  if (OB_UNLIKELY(ring_fd_ >= 0)) {
+    ret = OB_INIT_TWICE;
+    SHARE_LOG(WARN, "io uring context has been inited", K(ret), K(*this));
+  } else if (OB_UNLIKELY(0 == max_events)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "invalid argument", K(ret), K(max_events));
+  } else if ((ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, max_events, &params))) < 0) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "fail to setup io uring", K(ret), K(max_events), K(enable_sqpoll), K(errno), KERRMSG);
+  } else if (0 == (params.features & IORING_FEAT_EXT_ARG)) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "io uring doesn't support waiting with timeout", K(ret), K(params.features));
+  } else {
+    sq_entries_ = params.sq_entries;
+    cq_entries_ = params.cq_entries;
+    enable_sqpoll_ = enable_sqpoll;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes_ptr = MAP_FAILED;
+    if (MAP_FAILED == (sq_ring_ptr_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING))) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "fail to mmap sq ring", K(ret), K_(sq_ring_size), K(errno), KERRMSG);
+    } else if (MAP_FAILED == (cq_ring_ptr_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING))) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "fail to mmap cq ring", K(ret), K_(cq_ring_size), K(errno), KERRMSG);
+    } else if (MAP_FAILED == (sqes_ptr = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES))) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "fail to mmap sqes", K(ret), K_(sqes_size), K(errno), KERRMSG);
+    } else {
+      char *sq_ptr = static_cast<char *>(sq_ring_ptr_);
+      char *cq_ptr = static_cast<char *>(cq_ring_ptr_);
+      sq_head_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.head);
+      sq_tail_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.tail);
+      sq_ring_mask_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.ring_mask);
+      sq_flags_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.flags);
+      sq_array_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.array);
+      sqes_ = static_cast<struct io_uring_sqe *>(sqes_ptr);
+      cq_head_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.head);
+      cq_tail_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.tail);
+      cq_ring_mask_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.ring_mask);
+      cqes_ = reinterpret_cast<struct io_uring_cqe *>(cq_ptr + params.cq_off.cqes);
+    }
+  }
+
+  if (OB_SUCC(ret) && fixed_fd >= 0) {
+    // register block file so that the kernel skips fd lookup and refcount on each io
+    if (0 != ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_FILES, &fixed_fd, 1)) {
+      SHARE_LOG(INFO, "fail to register fixed file, use normal fd instead", K(fixed_fd), K(errno), KERRMSG);
+    } else {
+      fixed_fd_ = fixed_fd;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+    destroy();
+  } else {
+    SHARE_LOG(INFO, "succeed to init io uring context", K(*this));
+  }
+  return ret;
+}
+
+void ObLocalIOUringContext::destroy()
+{
+  if (nullptr != sqes_) {
+    ::munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (MAP_FAILED != cq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+    cq_ring_ptr_ = MAP_FAILED;
+  }
+  if (MAP_FAILED != sq_ring_ptr_) {
+    ::munmap(sq_ring_ptr_, sq_ring_size_);
+    sq_ring_ptr_ = MAP_FAILED;
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  sq_head_ = nullptr;
+  sq_tail_ = nullptr;
+  sq_ring_mask_ = nullptr;
+  sq_flags_ = nullptr;
+  sq_array_ = nullptr;
+  cq_head_ = nullptr;
+  cq_tail_ = nullptr;
+  cq_ring_mask_ = nullptr;
+  cqes_ = nullptr;
+  sq_entries_ = 0;
+  cq_entries_ = 0;
+  fixed_fd_ = -1;
+  enable_sqpoll_ = false;
+  submitting_ = false;
+}
+
+int ObLocalIOUringContext::enter(
+    const uint32_t to_submit,
+    const uint32_t min_complete,
+    const uint32_t flags,
+    struct timespec *timeout,
+    uint32_t &submitted)
+{
+  int ret = OB_SUCCESS;
+  int sys_ret = 0;
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  if (nullptr != timeout) {
+    ts.tv_sec = timeout->tv_sec;
+    ts.tv_nsec = timeout->tv_nsec;
+    MEMSET(&arg, 0, sizeof(arg));
+    arg.ts = reinterpret_cast<uint64_t>(&ts);
+  }
+  submitted = 0;
+  while (true) {
+    if (nullptr == timeout) {
+      sys_ret = static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete,
+                                           flags, nullptr, 0));
+    } else {
+      sys_ret = static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete,
+                                           flags | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)));
+    }
+    if (sys_ret < 0 && EINTR == errno && to_submit > 0) {
+      // nothing is consumed, retry so that the sqes are not left behind
+    } else {
+      break;
+    }
+  }
+  if (sys_ret >= 0) {
+    // kernel returns the count of consumed sqes when submitting
+    submitted = to_submit > 0 ? static_cast<uint32_t>(sys_ret) : 0;
+  } else if (0 == to_submit && (ETIME == errno || EINTR == errno)) {
+    // timeout or interrupted while waiting, caller will reap what is available
+  } else if (EAGAIN == errno || EBUSY == errno || ETIME == errno) {
+    ret = OB_EAGAIN;
+  } else {
+    ret = OB_IO_ERROR;
+    SHARE_LOG(WARN, "fail to enter io uring", K(ret), K(to_submit), K(min_complete), K(flags), K(errno), KERRMSG);
+  }
+  return ret;
+}
+
+int ObLocalIOUringContext::submit(const struct iocb &cb)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  {
+    ObSpinLockGuard guard(sq_lock_);
+    const uint32_t tail = *sq_tail_;
+    if (OB_UNLIKELY(tail - ATOMIC_LOAD_ACQ(sq_head_) >= sq_entries_)) {
+      ret = OB_EAGAIN;
+      SHARE_LOG(WARN, "io uring submission queue is full", K(ret), K(*this));
+    } else {
+      const uint32_t index = tail & *sq_ring_mask_;
+      struct io_uring_sqe *sqe = &sqes_[index];
+      MEMSET(sqe, 0, sizeof(*sqe));
+      sqe->opcode = IO_CMD_PREAD == cb.aio_lio_opcode ? IORING_OP_READ : IORING_OP_WRITE;
+      if (fixed_fd_ >= 0 && fixed_fd_ == static_cast<int>(cb.aio_fildes)) {
+        sqe->fd = 0; // index in registered files
+        sqe->flags |= IOSQE_FIXED_FILE;
+      } else {
+        sqe->fd = static_cast<int32_t>(cb.aio_fildes);
+      }
+      sqe->addr = reinterpret_cast<uint64_t>(cb.u.c.buf);
+      sqe->len = static_cast<uint32_t>(cb.u.c.nbytes);
+      sqe->off = static_cast<uint64_t>(cb.u.c.offset);
+      sqe->user_data = reinterpret_cast<uint64_t>(cb.data);
+      sq_array_[index] = index;
+      ATOMIC_STORE_REL(sq_tail_, tail + 1);
+    }
+  }
+  // the sqe is queued in ring, it is submitted to kernel here or by a later flush
+  if (OB_SUCC(ret) && OB_SUCCESS != (tmp_ret = flush())) {
+    SHARE_LOG(WARN, "fail to flush io uring sqes, retry later", K(tmp_ret), K(*this));
+  }
+  return ret;
+}
+
+int ObLocalIOUringContext::flush()
+{
+  int ret = OB_SUCCESS;
+  uint32_t submitted = 0;
+  if (enable_sqpoll_) {
+    // kernel thread consumes sqes by itself, only wake it up when it sleeps
+    if (0 != (ATOMIC_LOAD(sq_flags_) & IORING_SQ_NEED_WAKEUP)) {
+      ret = enter(0, 0, IORING_ENTER_SQ_WAKEUP, nullptr, submitted);
+    }
+  } else {
+    // the thread who wins submitting_ submits all queued sqes in one syscall, others
+    // just return, and it checks again after release in case of a late sqe
+    while (OB_SUCC(ret)
+           && ATOMIC_LOAD_ACQ(sq_tail_) != ATOMIC_LOAD_ACQ(sq_head_)
+           && ATOMIC_BCAS(&submitting_, false, true)) {
+      uint32_t to_submit = 0;
+      while (OB_SUCC(ret) && 0 != (to_submit = ATOMIC_LOAD_ACQ(sq_tail_) - ATOMIC_LOAD_ACQ(sq_head_))) {
+        if (OB_FAIL(enter(to_submit, 0, 0, nullptr, submitted))) {
+        } else if (submitted < to_submit) {
+          // kernel is short of resources, the rest sqes stay in ring
+          ret = OB_EAGAIN;
+        }
+      }
+      ATOMIC_STORE(&submitting_, false);
+    }
+  }
+  return ret;
+}
+
+int64_t ObLocalIOUringContext::reap_events(const int64_t max_nr, struct io_event *events)
+{
+  int64_t cnt = 0;
+  uint32_t head = *cq_head_;
+  const uint32_t tail = ATOMIC_LOAD_ACQ(cq_tail_);
+  while (head != tail && cnt < max_nr) {
+    const struct io_uring_cqe &cqe = cqes_[head & *cq_ring_mask_];
+    events[cnt].data = reinterpret_cast<void *>(cqe.user_data);
+    events[cnt].res = static_cast<unsigned long>(static_cast<long>(cqe.res));
+    events[cnt].res2 = 0;
+    ++cnt;
+    ++head;
+  }
+  if (cnt > 0) {
+    ATOMIC_STORE_REL(cq_head_, head);
+  }
+  return cnt;
+}
+
+int ObLocalIOUringContext::get_events(
+    const int64_t min_nr,
+    const int64_t max_nr,
+    struct io_event *events,
+    struct timespec *timeout,
+    int64_t &complete_cnt)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  uint32_t submitted = 0;
+  // sqes left by a failed submission are retried on each wakeup
+  if (OB_SUCCESS != (tmp_ret = flush()) && REACH_TIME_INTERVAL(1000000L)) {
+    SHARE_LOG(WARN, "fail to flush io uring sqes", K(tmp_ret), K(*this));
+  }
+  // completions already in cq ring are polled without any syscall
+  complete_cnt = reap_events(max_nr, events);
+  if (complete_cnt < min_nr) {
+    if (OB_FAIL(enter(0, static_cast<uint32_t>(min_nr - complete_cnt), IORING_ENTER_GETEVENTS,
+                      timeout, submitted))) {
+      SHARE_LOG(WARN, "fail to wait io uring events", K(ret), K(min_nr), K(*this));
+    } else {
+      complete_cnt += reap_events(max_nr - complete_cnt, events + complete_cnt);
+    }
+  }
+  return ret;
+}
+#endif
+
 /**
  * ---------------------------------------------ObLocalDevice---------------------------------------------------
  */
@@ -1013,6 +1315,9 @@ int ObLocalDevice::io_setup(
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     SHARE_LOG(WARN, "The ObLocalDevice has not been inited, ", K(ret));
+  } else if (GCONF._enable_io_uring
+      && OB_SUCCESS == io_uring_setup(max_events, io_context)) {
+    // io uring is ready, otherwise fall back to libaio
   } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObLocalIOContext)))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     SHARE_LOG(WARN, "Fail to allocate memory, ", K(ret));
@@ -1045,6 +1350,12 @@ int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
   } else if (OB_ISNULL(io_context)) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid argument, ", KP(io_context));
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+  } else if (nullptr != dynamic_cast<ObLocalIOUringContext*> (io_context)) {
+    ObLocalIOUringContext *uring_context = static_cast<ObLocalIOUringContext*> (io_context);
+    uring_context->~ObLocalIOUringContext();
+    allocator_.free(io_context);
+#endif
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
@@ -1147,6 +1458,12 @@ int ObLocalDevice::io_submit(
   } else if (OB_ISNULL(local_iocb = dynamic_cast<ObLocalIOCB*> (iocb))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid iocb pointer, ", K(ret), KP(iocb));
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+  } else if (nullptr != dynamic_cast<ObLocalIOUringContext*> (io_context)) {
+    if (OB_FAIL(static_cast<ObLocalIOUringContext*> (io_context)->submit(local_iocb->iocb_))) {
+      SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret));
+    }
+#endif
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
@@ -1179,6 +1496,11 @@ int ObLocalDevice::io_cancel(
   } else if (OB_ISNULL(local_iocb = dynamic_cast<ObLocalIOCB*> (iocb))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid iocb pointer, ", K(ret), KP(iocb));
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+  } else if (nullptr != dynamic_cast<ObLocalIOUringContext*> (io_context)) {
+    // same as libaio on most file systems, the request will complete normally
+    ret = OB_NOT_SUPPORTED;
+#endif
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
@@ -1211,6 +1533,16 @@ int ObLocalDevice::io_getevents(
   } else if (OB_ISNULL(local_io_events = dynamic_cast<ObLocalIOEvents*> (events))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io events pointer, ", K(ret), KP(events));
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+  } else if (nullptr != dynamic_cast<ObLocalIOUringContext*> (io_context)) {
+    int64_t complete_cnt = 0;
+    if (OB_FAIL(static_cast<ObLocalIOUringContext*> (io_context)->get_events(
+        min_nr, local_io_events->max_event_cnt_, local_io_events->io_events_, timeout, complete_cnt))) {
+      SHARE_LOG(WARN, "Fail to get io uring events, ", K(ret));
+    } else {
+      local_io_events->complete_io_cnt_ = complete_cnt;
+    }
+#endif
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
@@ -1232,6 +1564,32 @@ int ObLocalDevice::io_getevents(
   return ret;
 }
 
+int ObLocalDevice::io_uring_setup(const uint32_t max_events, common::ObIOContext *&io_context)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+  void *buf = nullptr;
+  ObLocalIOUringContext *uring_context = nullptr;
+  if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObLocalIOUringContext)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SHARE_LOG(WARN, "Fail to allocate memory, ", K(ret));
+  } else if (FALSE_IT(uring_context = new (buf) ObLocalIOUringContext())) {
+  } else if (OB_FAIL(uring_context->init(max_events, GCONF._io_uring_sqpoll, block_fd_ > 0 ? block_fd_ : -1))) {
+    SHARE_LOG(WARN, "Fail to init io uring context, fall back to libaio", K(ret), K(max_events));
+    uring_context->~ObLocalIOUringContext();
+    allocator_.free(buf);
+  } else {
+    io_context = uring_context;
+  }
+#else
+  UNUSED(max_events);
+  UNUSED(io_context);
+  ret = OB_NOT_SUPPORTED;
+  SHARE_LOG(WARN, "io uring is not supported by this build, fall back to libaio", K(ret));
+#endif
+  return ret;
+}
+
 common::ObIOCB* ObLocalDevice::alloc_iocb()
 {
   ObLocalIOCB *iocb = nullptr;
@@ -14,9 +14,21 @@
 #define SRC_SHARE_OB_LOCAL_DEVICE_H_
 
 #include <libaio.h>
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+#include <sys/syscall.h>
 #include "lib/allocator/ob_fifo_allocator.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "common/storage/ob_io_device.h"
 
+// io_uring is driven by raw syscalls, require a kernel header new enough to wait with timeout
+#if defined(IORING_FEAT_EXT_ARG) && defined(__NR_io_uring_setup)
+#define OB_LOCAL_DEVICE_IO_URING_ENABLED 1
+#endif
+
 namespace oceanbase {
 namespace share {
 
@@ -42,6 +54,54 @@ private:
   io_context_t io_context_;
 };
 
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+// Async io context backed by an io_uring instance, iocbs prepared for libaio are
+// translated into sqes on submit so that callers are unaware of the backend.
+// Sqes queued by concurrent submitters are handed to kernel by one io_uring_enter.
+class ObLocalIOUringContext : public common::ObIOContext
+{
+public:
+  ObLocalIOUringContext();
+  virtual ~ObLocalIOUringContext();
+  int init(const uint32_t max_events, const bool enable_sqpoll, const int fixed_fd);
+  void destroy();
+  int submit(const struct iocb &cb);
+  int get_events(const int64_t min_nr, const int64_t max_nr, struct io_event *events,
+                 struct timespec *timeout, int64_t &complete_cnt);
+  TO_STRING_KV(K_(ring_fd), K_(sq_entries), K_(cq_entries), K_(fixed_fd), K_(enable_sqpoll));
+private:
+  int enter(const uint32_t to_submit, const uint32_t min_complete, const uint32_t flags,
+            struct timespec *timeout, uint32_t &submitted);
+  int flush();
+  int64_t reap_events(const int64_t max_nr, struct io_event *events);
+private:
+  friend class ObLocalDevice;
+  int ring_fd_;
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  int fixed_fd_;
+  bool enable_sqpoll_;
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_ring_mask_;
+  uint32_t *sq_flags_;
+  uint32_t *sq_array_;
+  struct io_uring_sqe *sqes_;
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_ring_mask_;
+  struct io_uring_cqe *cqes_;
+  void *sq_ring_ptr_;
+  int64_t sq_ring_size_;
+  void *cq_ring_ptr_;
+  int64_t cq_ring_size_;
+  int64_t sqes_size_;
+  common::ObSpinLock sq_lock_;
+  // set by the thread which is submitting queued sqes to kernel
+  bool submitting_;
+};
+#endif
+
 class ObLocalIOEvents : public common::ObIOEvents
 {
 public:
@@ -191,6 +251,7 @@ private:
   static int pread_impl(const int64_t fd, void *buf, const int64_t size, const int64_t offset, int64_t &read_size);
   static int pwrite_impl(const int64_t fd, const void *buf, const int64_t size, const int64_t offset, int64_t &write_size);
   static int convert_sys_errno();
+  int io_uring_setup(const uint32_t max_events, common::ObIOContext *&io_context);
 private:
   static const int64_t DEFUALT_PRE_ALLOCATED_IOCB_COUNT = 32 * 512;// 32 thread * max_io_depth
 
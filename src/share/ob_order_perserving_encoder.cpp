@@ -107,6 +107,18 @@ int ObOrderPerservingEncoder::make_order_perserving_encode_from_object(ObObj &ob
       }
       break;
     }
+    // bit, enum and set are ordered by their uint64 values
+    case ObBitType:
+    case ObEnumType:
+    case ObSetType: {
+      if (to_len + sizeof(uint64_t) > max_buf_len) {
+        ret = OB_BUF_NOT_ENOUGH;
+        LOG_TRACE("no enough memory to do encoding", K(ret), K(obj.get_type()));
+      } else {
+        encode_from_uint(obj.get_uint64(), to, to_len);
+      }
+      break;
+    }
     // for float values
     case ObFloatType:
     case ObUFloatType: {
@@ -183,9 +195,6 @@ int ObOrderPerservingEncoder::make_order_perserving_encode_from_object(ObObj &ob
     case ObTextType:
     case ObMediumTextType:
     case ObLongTextType:
-    case ObBitType:
-    case ObEnumType:
-    case ObSetType:
     case ObEnumInnerType:
     case ObSetInnerType:
     case ObLobType:
@@ -286,6 +295,18 @@ int ObOrderPerservingEncoder::make_order_perserving_encode_from_object(
       }
       break;
     }
+    // bit, enum and set are ordered by their uint64 values
+    case ObBitType:
+    case ObEnumType:
+    case ObSetType: {
+      if (to_len + sizeof(uint64_t) > max_buf_len) {
+        ret = OB_BUF_NOT_ENOUGH;
+        LOG_TRACE("no enough memory to do encoding", K(ret), K(param.type_));
+      } else {
+        encode_from_uint(data.get_uint(), to, to_len);
+      }
+      break;
+    }
     // for float values
     case ObFloatType:
     case ObUFloatType: {
@@ -379,9 +400,6 @@ int ObOrderPerservingEncoder::make_order_perserving_encode_from_object(
     case ObTextType:
     case ObMediumTextType:
     case ObLongTextType:
-    case ObBitType:
-    case ObEnumType:
-    case ObSetType:
     case ObEnumInnerType:
     case ObSetInnerType:
     case ObLobType:
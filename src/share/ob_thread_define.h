@@ -52,6 +52,7 @@ TG_DEF(KVCacheWash, KVCacheWash, "", TG_STATIC, TIMER)
 TG_DEF(KVCacheRep, KVCacheRep, "", TG_STATIC, TIMER)
 TG_DEF(ObHeartbeat, ObHeartbeat, "", TG_STATIC, TIMER)
 TG_DEF(PlanCacheEvict, PlanCacheEvict, "", TG_DYNAMIC, TIMER)
+TG_DEF(PlanCacheWarmup, PlanCacheWarmup, "", TG_DYNAMIC, TIMER)
 TG_DEF(TabletStatRpt, TabletStatRpt, "", TG_STATIC, TIMER)
 TG_DEF(PsCacheEvict, PsCacheEvict, "", TG_DYNAMIC, TIMER)
 TG_DEF(MergeLoop, MergeLoop, "", TG_STATIC, TIMER)
@@ -35,7 +35,8 @@ namespace share
 {
 const uint64_t ObUpgradeChecker::UPGRADE_PATH[DATA_VERSION_NUM] = {
   CALC_VERSION(4UL, 0UL, 0UL, 0UL),  // 4.0.0.0
-  CALC_VERSION(4UL, 1UL, 0UL, 0UL)   // 4.1.0.0
+  CALC_VERSION(4UL, 1UL, 0UL, 0UL),  // 4.1.0.0
+  CALC_VERSION(4UL, 1UL, 0UL, 1UL)   // 4.1.0.1
 };
 
 int ObUpgradeChecker::get_data_version_by_cluster_version(
@@ -52,6 +53,10 @@ int ObUpgradeChecker::get_data_version_by_cluster_version(
       data_version = DATA_VERSION_4_1_0_0;
       break;
     }
+    case CLUSTER_VERSION_4_1_0_1: {
+      data_version = DATA_VERSION_4_1_0_1;
+      break;
+    }
     default: {
       ret = OB_INVALID_ARGUMENT;
       LOG_WARN("invalid cluster_version", KR(ret), K(cluster_version));
@@ -596,6 +601,7 @@ int ObUpgradeProcesserSet::init(
     // order by data version asc
     INIT_PROCESSOR_BY_VERSION(4, 0, 0, 0);
     INIT_PROCESSOR_BY_VERSION(4, 1, 0, 0);
+    INIT_PROCESSOR_BY_VERSION(4, 1, 0, 1);
 #undef INIT_PROCESSOR_BY_VERSION
     inited_ = true;
   }
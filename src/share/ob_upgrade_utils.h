@@ -169,7 +169,7 @@ public:
              const uint64_t cluster_version,
              uint64_t &data_version);
 public:
-  static const int64_t DATA_VERSION_NUM = 2;
+  static const int64_t DATA_VERSION_NUM = 3;
   static const uint64_t UPGRADE_PATH[DATA_VERSION_NUM];
 };
 
@@ -188,6 +188,7 @@ private:
   int init_rewrite_rule_version(const uint64_t tenant_id);
   static int recompile_all_views_and_synonyms(const uint64_t tenant_id);
 };
+DEF_SIMPLE_UPGRARD_PROCESSER(4, 1, 0, 1)
 /* =========== special upgrade processor end   ============= */
 
 /* =========== upgrade processor end ============= */
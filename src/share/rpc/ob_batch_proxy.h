@@ -40,6 +40,15 @@ inline int64_t get_batch_delay_us(const int batch_type)
   return (batch_type >= 0 && batch_type < BATCH_REQ_TYPE_COUNT) ? delay[batch_type]: 0;
 }
 
+// Batch types without delay are woken up by each post. Waiting a short window
+// after the wakeup coalesces messages posted concurrently to the same server,
+// e.g. 2pc messages of the participants of a distributed transaction. It is off
+// by default as it adds latency to each commit.
+inline int64_t get_batch_coalesce_us(const int batch_type)
+{
+  return TRX_BATCH_REQ_NODELAY == batch_type ? GCONF._trx_2pc_msg_batch_window : 0;
+}
+
 inline int64_t get_batch_buffer_size(const int batch_type)
 {
   int64_t batch_buffer_size_k[BATCH_REQ_TYPE_COUNT] = {256, 256, 2048, 2048, 256, 256, 256, 2048};
@@ -338,10 +338,26 @@ void ObBatchRpcBase::do_work()
     }
     if (delay_us_ > 0) {
       ob_usleep((int32_t)sleep_ts);
-    } else {
-      cond_.wait(sleep_ts);
+    } else if (cond_.wait(sleep_ts) && need_coalesce()) {
+      ob_usleep((int32_t)get_batch_coalesce_us(batch_type_));
+    }
+  }
+}
+
+// a message to a single server is sent immediately, only the fan-out to several
+// servers, e.g. 2pc of a distributed transaction, waits for the coalescing window.
+bool ObBatchRpcBase::need_coalesce()
+{
+  int64_t pending_cnt = 0;
+  if (is_inited_ && get_batch_coalesce_us(batch_type_) > 0) {
+    RpcBuffer* iter = NULL;
+    while(pending_cnt < 2 && NULL != (iter = buffer_map_->quick_next(iter))) {
+      if (!iter->is_empty()) {
+        pending_cnt++;
+      }
     }
   }
+  return pending_cnt > 1;
 }
 
 ObRpcBuffer* ObBatchRpcBase::create_buffer(const uint64_t tenant_id, const ObAddr& addr, const int64_t dst_cluster_id)
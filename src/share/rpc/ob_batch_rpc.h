@@ -326,12 +326,14 @@ public:
       }
     }
   }
+  // return true if it is signaled before timeout
   bool wait(int64_t timeout)  {
     bool ready = ATOMIC_LOAD(&futex_.val());
     if (!ready) {
       ATOMIC_FAA(&n_waiters_, 1);
       futex_.wait(0, timeout);
       ATOMIC_FAA(&n_waiters_, -1);
+      ready = ATOMIC_BCAS(&futex_.val(), 1, 0);
     } else {
       ATOMIC_STORE(&futex_.val(), 0);
     }
@@ -419,6 +421,7 @@ public:
       const uint32_t batch_type, const int16_t sub_type,
       const share::ObLSID &ls, const Req& req);
   void do_work();
+  bool need_coalesce();
   int get_dst_svr_list(common::ObIArray<share::ObCascadMember> &dst_list);
 protected:
   RpcBuffer* fetch(const uint64_t tenant_id, const common::ObAddr &server, const int64_t dst_cluster_id);
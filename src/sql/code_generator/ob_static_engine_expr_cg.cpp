@@ -19,6 +19,9 @@
 #include "sql/engine/expr/ob_expr_util.h"
 #include "sql/engine/expr/ob_expr_extra_info_factory.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_arith_fusion.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -222,6 +225,8 @@ int ObStaticEngineExprCG::cg_exprs(const ObIArray<ObRawExpr *> &raw_exprs,
     // because cg_expr_by_operator may replace rt_expr.args_
     } else if (OB_FAIL(cg_expr_parents(raw_exprs))) {
       LOG_WARN("fail to init expr parenets", K(ret), K(raw_exprs));
+    } else if (OB_FAIL(cg_fused_arith_exprs(raw_exprs))) {
+      LOG_WARN("fail to init fused arith exprs", K(ret));
       // init res_buf_len_, frame_idx_, datum_off_, res_buf_off_
     } else if (OB_FAIL(cg_all_frame_layout(raw_exprs, expr_info))) {
       LOG_WARN("fail to init expr data layout", K(ret), K(raw_exprs));
@@ -368,6 +373,27 @@ int ObStaticEngineExprCG::cg_expr_parents(const ObIArray<ObRawExpr *> &raw_exprs
   return ret;
 }
 
+int ObStaticEngineExprCG::cg_fused_arith_exprs(const ObIArray<ObRawExpr *> &raw_exprs)
+{
+  int ret = OB_SUCCESS;
+  bool enable_fusion = false;
+  ObSQLSessionInfo *session = op_cg_ctx_.session_;
+  if (batch_size_ <= 0 || OB_ISNULL(session)) {
+    // fusion is for vectorized execution only
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session->get_effective_tenant_id()));
+    enable_fusion = tenant_config.is_valid() && tenant_config->_enable_fused_arith_expr;
+  }
+  for (int64_t i = 0; enable_fusion && OB_SUCC(ret) && i < raw_exprs.count(); i++) {
+    ObExpr *rt_expr = get_rt_expr(*raw_exprs.at(i));
+    if (ObExprArithFusion::is_fused_root(*rt_expr)) {
+      rt_expr->fused_arith_root_ = true;
+      LOG_TRACE("fused arith expr", K(*raw_exprs.at(i)));
+    }
+  }
+  return ret;
+}
+
 extern int eval_question_mark_func(EVAL_FUNC_ARG_DECL);
 extern int eval_assign_question_mark_func(EVAL_FUNC_ARG_DECL);
 
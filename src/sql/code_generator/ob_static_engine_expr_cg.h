@@ -189,6 +189,9 @@ private:
   // init parent_cnt_, parents_
   int cg_expr_parents(const common::ObIArray<ObRawExpr *> &raw_exprs);
 
+  // init fused_arith_root_, must be after cg_expr_parents
+  int cg_fused_arith_exprs(const common::ObIArray<ObRawExpr *> &raw_exprs);
+
   // init eval_func_, inner_eval_func_, expr_ctx_id_, extra_
   int cg_expr_by_operator(const common::ObIArray<ObRawExpr *> &raw_exprs,
                           int64_t &total_ctx_cnt);
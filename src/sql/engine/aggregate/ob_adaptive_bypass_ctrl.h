@@ -27,6 +27,7 @@ const int64_t MAX_L3_CACHE_SIZE = 50 *1024 *1024; //50M
 const uint64_t FORCE_GPD = 0x100;
 const int64_t MAX_REBUILD_TIMES = 5;
 constexpr const double MIN_RATIO_FOR_L3 = 0.95;
+constexpr const double MAX_RATIO_FOR_RADIX_PART = 0.5;
 const int64_t DISTINCT_ITEM_SIZE = 24;
 const int64_t GROUP_BY_ITEM_SIZE = 40;
 class ObAdaptiveByPassCtrl {
@@ -65,6 +66,14 @@ public:
   {
     return 0 != small_row_cnt_ ? (row_cnt < small_row_cnt_) : (mem_size < INIT_L3_CACHE_SIZE);
   }
+  // Hash table outgrows l3 cache and most probes create new groups, it's cheaper to
+  // partition the remaining rows by hash in memory and aggregate them part by part.
+  inline bool need_radix_partition(int64_t row_cnt, int64_t mem_size,
+                                   int64_t probe_cnt, int64_t exists_cnt)
+  {
+    return probe_cnt > 0 && !in_l3_cache(row_cnt, mem_size)
+           && static_cast<double> (exists_cnt) / probe_cnt < MAX_RATIO_FOR_RADIX_PART;
+  }
   void gby_process_state(int64_t probe_cnt, int64_t row_cnt, int64_t mem_size);
   inline void inc_processed_cnt(int64_t new_processed_cnt) { processed_cnt_ += new_processed_cnt; }
   inline void inc_probe_cnt_() { ++probe_cnt_; }
@@ -4105,6 +4105,10 @@ int ObAggregateProcessor::number_accumulator(
   uint32_t fast_sum_path_counter = 0;
   int64_t sum_frag_val = 0;
   int64_t sum_int_val = 0;
+  // fixed-width sum for numbers longer than 2 digits, see ObNumber::to_scaled_int128
+  __int128_t sum_scaled_val = 0;
+  __int128_t scaled_val = 0;
+  __int128_t tmp_scaled_val = 0;
   // TODO zuojiao.hzj: add new number accumulator to avoid memory allocate
   char buf_ori_result[ObNumber::MAX_CALC_BYTE_LEN];
   ObDataBuffer allocator_ori_result(buf_ori_result, ObNumber::MAX_CALC_BYTE_LEN);
@@ -4141,6 +4145,10 @@ int ObAggregateProcessor::number_accumulator(
     } else if (src_num.d_.is_1d_negative_integer()) {
       sum_int_val -= src_num.get_digits()[0];
       ++fast_sum_path_counter;
+    } else if (src_num.to_scaled_int128(ObNumber::SCALED_INT128_FRAG_LEN, scaled_val)
+               && !__builtin_add_overflow(sum_scaled_val, scaled_val, &tmp_scaled_val)) {
+      sum_scaled_val = tmp_scaled_val;
+      ++fast_sum_path_counter;
     } else {
       if (OB_UNLIKELY(!ori_result_copied)) {
         // copy result to ori_result to fall back
@@ -4188,6 +4196,10 @@ int ObAggregateProcessor::number_accumulator(
     if (OB_SUCC(ret)) {
       result.assign(res.d_.desc_, res.get_digits());
     }
+  } else if (OB_SUCC(ret) && !all_skip
+             && OB_FAIL(merge_scaled_number_sum(sum_scaled_val, allocator1, allocator2,
+                                                normal_sum_path_counter, result))) {
+    LOG_WARN("failed to merge scaled sum", K(ret), K(result));
   } else if (OB_SUCC(ret) && !all_skip) {
     // construct sum result into number format
     const int64_t base = ObNumber::BASE;
@@ -4281,6 +4293,35 @@ int ObAggregateProcessor::number_accumulator(
   return ret;
 }
 
+int ObAggregateProcessor::merge_scaled_number_sum(
+    const __int128_t sum_scaled_val,
+    ObDataBuffer &allocator1,
+    ObDataBuffer &allocator2,
+    uint32_t &normal_sum_path_counter,
+    ObNumber &result)
+{
+  int ret = OB_SUCCESS;
+  if (0 != sum_scaled_val) {
+    ObNumber scaled_sum;
+    ObNumber res;
+    char buf_scaled_sum[ObNumber::MAX_CALC_BYTE_LEN];
+    ObDataBuffer allocator_scaled_sum(buf_scaled_sum, ObNumber::MAX_CALC_BYTE_LEN);
+    // result is kept in the other buffer, see number_accumulator
+    ObDataBuffer &allocator = (normal_sum_path_counter % 2 == 0) ? allocator1 : allocator2;
+    allocator.free();
+    if (OB_FAIL(scaled_sum.from_scaled_int128(sum_scaled_val, ObNumber::SCALED_INT128_FRAG_LEN,
+                                              allocator_scaled_sum))) {
+      LOG_WARN("failed to construct number from scaled int128", K(ret));
+    } else if (OB_FAIL(result.add_v3(scaled_sum, res, allocator, true, true))) {
+      LOG_WARN("number add failed", K(ret), K(scaled_sum), K(result));
+    } else {
+      result = res;
+      ++normal_sum_path_counter;
+    }
+  }
+  return ret;
+}
+
 int ObAggregateProcessor::init_group_extra_aggr_info(
   AggrCell &aggr_cell,
   const ObAggrInfo &aggr_info
@@ -701,6 +701,9 @@ private:
   int number_accumulator(
       const ObDatumVector &src, ObDataBuffer &allocator1, ObDataBuffer &allocator2,
       number::ObNumber &result, uint32_t *sum_digits, bool &all_skip, const T &param);
+  int merge_scaled_number_sum(
+      const __int128_t sum_scaled_val, ObDataBuffer &allocator1, ObDataBuffer &allocator2,
+      uint32_t &normal_sum_path_counter, number::ObNumber &result);
   template <typename T>
   int max_calc_batch(
       AggrCell &aggr_cell,
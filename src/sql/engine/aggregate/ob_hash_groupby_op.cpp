@@ -143,6 +143,7 @@ void ObHashGroupByOp::reset()
   use_distinct_data_ = false;
   reset_distinct_info();
   bypass_ctrl_.reset();
+  radix_part_ = false;
   by_pass_nth_group_ = 0;
   by_pass_child_brs_ = nullptr;
   by_pass_group_row_ = nullptr;
@@ -1200,6 +1201,21 @@ int64_t ObHashGroupByOp::detect_part_cnt(const int64_t rows) const
   return part_cnt;
 }
 
+int64_t ObHashGroupByOp::detect_radix_part_cnt(const int64_t rows) const
+{
+  // estimate size of the remaining groups, make hash table of each partition fit l2 cache
+  const double group_mem_avg = (double)get_data_size() / local_group_rows_.size()
+                               + GROUP_BY_ITEM_SIZE;
+  int64_t data_size = rows * ((double)agged_group_cnt_ / agged_row_cnt_) * group_mem_avg;
+  int64_t part_cnt = next_pow2((data_size + INIT_L2_CACHE_SIZE) / INIT_L2_CACHE_SIZE);
+  part_cnt = std::max(part_cnt, (int64_t)MIN_PARTITION_CNT);
+  part_cnt = std::min(part_cnt, (int64_t)MAX_PARTITION_CNT);
+  LOG_TRACE("trace detect radix partition cnt", K(data_size), K(group_mem_avg), K(rows),
+    K(agged_group_cnt_), K(agged_row_cnt_), K(local_group_rows_.size()), K(part_cnt),
+    K(INIT_L2_CACHE_SIZE));
+  return part_cnt;
+}
+
 void ObHashGroupByOp::calc_data_mem_ratio(const int64_t part_cnt, double &data_ratio)
 {
   int64_t est_extra_size = (get_mem_used_size() + part_cnt * FIX_SIZE_PER_PART);
@@ -1317,10 +1333,22 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
     LOG_WARN("invalid argument", K(ret), K(input_rows), KP(parts));
   } else {
     int64_t pre_part_cnt = 0;
-    part_cnt = pre_part_cnt = detect_part_cnt(input_rows);
+    part_cnt = pre_part_cnt = radix_part_
+                              ? detect_radix_part_cnt(input_rows) : detect_part_cnt(input_rows);
     adjust_part_cnt(part_cnt);
     MEMSET(parts, 0, sizeof(parts[0]) * part_cnt);
     part_shift_ += min(__builtin_ctz(part_cnt), 8);
+    // radix partitions stay in memory with the budget left by the main hash table,
+    // spill them as usual if no block could be kept for each partition
+    int64_t part_mem_limit = 1;
+    if (radix_part_) {
+      const int64_t remain_size = get_mem_bound_size() - get_mem_used_size();
+      if (remain_size / part_cnt < ObChunkDatumStore::BLOCK_SIZE) {
+        radix_part_ = false;
+      } else {
+        part_mem_limit = remain_size / part_cnt;
+      }
+    }
     if (OB_SUCC(ret) && NULL == bloom_filter) {
       ModulePageAllocator mod_alloc(
           ObModIds::OB_HASH_NODE_GROUP_ROWS,
@@ -1357,7 +1385,8 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
         parts[i]->part_id_ = part_id + 1;
         parts[i]->part_shift_ = part_shift_;
         const int64_t extra_size = sizeof(uint64_t); // for hash value
-        if (OB_FAIL(parts[i]->datum_store_.init(1 /* memory limit, dump immediately */,
+        // memory limit 1 means dump immediately
+        if (OB_FAIL(parts[i]->datum_store_.init(part_mem_limit,
             ctx_.get_my_session()->get_effective_tenant_id(),
             ObCtxIds::WORK_AREA,
             ObModIds::OB_HASH_NODE_GROUP_ROWS,
@@ -1379,7 +1408,33 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
     } else if (OB_FAIL(sql_mem_processor_.update_used_mem_size(get_mem_used_size()))) {
       LOG_WARN("failed to update mem size", K(ret));
     }
-    LOG_TRACE("trace setup dump", K(part_cnt), K(pre_part_cnt), K(part_id));
+    LOG_TRACE("trace setup dump", K(part_cnt), K(pre_part_cnt), K(part_id), K(radix_part_),
+              K(part_mem_limit));
+  }
+  return ret;
+}
+
+int ObHashGroupByOp::spill_radix_parts(const int64_t part_id,
+                                       DatumStoreLinkPartition **parts,
+                                       const int64_t part_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(parts)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(parts));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < part_cnt; i++) {
+    parts[i]->datum_store_.set_mem_limit(1);
+    if (parts[i]->datum_store_.get_row_cnt_in_memory() > 0
+        && OB_FAIL(parts[i]->datum_store_.dump(false, true))) {
+      LOG_WARN("failed to dump partition", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    radix_part_ = false;
+    sql_mem_processor_.set_number_pass(part_id + 1);
+    LOG_TRACE("spill radix partitions", K(part_id), K(part_cnt), K(get_mem_used_size()),
+              K(get_mem_bound_size()));
   }
   return ret;
 }
@@ -1395,9 +1450,9 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
     for (int64_t i = 0; OB_SUCC(ret) && i < part_cnt; i++) {
       DatumStoreLinkPartition *&p = parts[i];
       if (p->datum_store_.get_row_cnt() > 0) {
-        if (OB_FAIL(p->datum_store_.dump(false, true))) {
+        if (!radix_part_ && OB_FAIL(p->datum_store_.dump(false, true))) {
           LOG_WARN("failed to dump partition", K(ret), K(i));
-        } else if (OB_FAIL(p->datum_store_.finish_add_row(true /* do dump */))) {
+        } else if (OB_FAIL(p->datum_store_.finish_add_row(!radix_part_ /* do dump */))) {
           LOG_WARN("do dump failed", K(ret));
         } else {
           part_rows[i] = p->datum_store_.get_row_cnt();
@@ -1414,7 +1469,7 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
         part_file_size[i] = 0;
       }
     }
-    LOG_TRACE("hash group by dumped", K(part_id),
+    LOG_TRACE("hash group by dumped", K(part_id), K(radix_part_),
         K(local_group_rows_.size()),
         K(get_mem_used_size()),
         K(get_aggr_used_size()),
@@ -1430,6 +1485,7 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
           K(get_aggr_used_size()),
           K(get_mem_bound_size()));
 
+  radix_part_ = false;
   ObArrayWrap<DatumStoreLinkPartition *> part_array(parts, part_cnt);
   if (NULL != mem_context_) {
     FOREACH_CNT(p, part_array) {
@@ -1610,6 +1666,14 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
   const ObChunkDatumStore::StoredRow **store_rows = NULL;
   int64_t loop_cnt = 0;
   int64_t last_batch_size = 0;
+  // Radix partition the child rows in memory for high cardinality group by, only new groups
+  // are partitioned after the hash table exceeds l3 cache, then each partition is aggregated
+  // with a cache resident hash table in switch_part().
+  const bool enable_radix_part = enable_dump_
+                                 && NULL == cur_part
+                                 && !use_distinct_data_
+                                 && !MY_SPEC.by_pass_enabled_
+                                 && ObThreeStageAggrStage::NONE_STAGE == MY_SPEC.aggr_stage_;
 
   while (OB_SUCC(ret)) {
     bypass_ctrl_.gby_process_state(last_batch_size,
@@ -1619,6 +1683,25 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
       by_pass_brs_holder_.save(max_row_cnt);
       break;
     }
+    if (enable_radix_part && !radix_part_ && NULL == bloom_filter
+        && bypass_ctrl_.need_radix_partition(local_group_rows_.size(),
+                                             get_actual_mem_used_size(),
+                                             agged_row_cnt_,
+                                             agged_row_cnt_ - agged_group_cnt_)) {
+      radix_part_ = true;
+      LOG_TRACE("start radix partition", K(local_group_rows_.size()), K(agged_row_cnt_),
+                K(agged_group_cnt_), K(get_actual_mem_used_size()), K(MY_SPEC.id_));
+      // set up partitions and bloom filter now, rows are routed by bloom filter to the
+      // partitions without probing the main hash table
+      group_rows_arr_.is_valid_ = false;
+      if (OB_FAIL(setup_dump_env(part_id, max(input_rows, loop_cnt), parts, part_cnt,
+                                 bloom_filter))) {
+        LOG_WARN("setup radix partition environment failed", K(ret));
+        break;
+      } else if (!radix_part_) {
+        sql_mem_processor_.set_number_pass(part_id + 1);
+      }
+    }
     const ObBatchRows *child_brs = NULL;
     start_calc_hash_idx_ = 0;
     has_calc_base_hash_ = false;
@@ -1650,6 +1733,9 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
                                              loop_cnt, *child_brs, part_cnt, parts, est_part_cnt,
                                              bloom_filter))) {
           LOG_WARN("fail to group child batch rows", K(ret));
+        } else if (radix_part_ && need_start_dump(input_rows, est_part_cnt, false)
+                   && OB_FAIL(spill_radix_parts(part_id, parts, part_cnt))) {
+          LOG_WARN("fail to spill radix partitions", K(ret));
         } else if (no_non_distinct_aggr_) {
         } else if (OB_FAIL(aggr_processor_.eval_aggr_param_batch(*child_brs))) {
           LOG_WARN("fail to eval aggr param batch", K(ret), K(*child_brs));
@@ -1733,7 +1819,9 @@ int ObHashGroupByOp::switch_part(DatumStoreLinkPartition *&cur_part,
       input_rows = cur_part->datum_store_.get_row_cnt();
       part_id = cur_part->part_id_;
       part_shift = part_shift_ = cur_part->part_shift_;
-      input_size = cur_part->datum_store_.get_file_size();
+      // radix partitions may stay in memory
+      input_size = std::max(cur_part->datum_store_.get_file_size(),
+                            cur_part->datum_store_.get_mem_hold());
     }
   } else {
     if (is_init_distinct_data_ && !use_distinct_data_) {
@@ -2217,7 +2305,10 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
   } else {
     if (!group_rows_arr_.is_valid_ && nullptr == store_rows) {
       calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
-      local_group_rows_.prefetch(child_brs, hash_vals_);
+      if (!radix_part_) {
+        // most rows are routed to radix partitions by bloom filter, don't touch the main table
+        local_group_rows_.prefetch(child_brs, hash_vals_);
+      }
       batch_hash_calculated = true;
     }
     uint16_t new_groups = 0;
@@ -2313,7 +2404,7 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
           if (OB_FAIL(setup_dump_env(part_id, max(input_rows, loop_cnt), parts, part_cnt,
                                     bloom_filter))) {
             LOG_WARN("setup dump environment failed", K(ret));
-          } else {
+          } else if (!radix_part_) {
             sql_mem_processor_.set_number_pass(part_id + 1);
           }
         }
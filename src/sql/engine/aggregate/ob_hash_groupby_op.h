@@ -230,6 +230,7 @@ public:
       iter_end_(false),
       enable_dump_(false),
       force_dump_(false),
+      radix_part_(false),
       batch_rows_from_dump_(NULL),
       hash_vals_(NULL),
       gri_cnt_per_batch_(0),
@@ -335,6 +336,10 @@ public:
   int update_mem_status_periodically(const int64_t nth_cnt, const int64_t input_row,
                                      int64_t &est_part_cnt, bool &need_dump);
   int64_t detect_part_cnt(const int64_t rows) const;
+  int64_t detect_radix_part_cnt(const int64_t rows) const;
+  // spill in memory radix partitions when memory bound is exceeded
+  int spill_radix_parts(const int64_t part_id, DatumStoreLinkPartition **parts,
+                        const int64_t part_cnt);
   void calc_data_mem_ratio(const int64_t part_cnt, double &data_ratio);
   void adjust_part_cnt(int64_t &part_cnt);
   int calc_groupby_exprs_hash(ObIArray<ObExpr*> &groupby_exprs,
@@ -544,6 +549,8 @@ private:
   bool iter_end_;
   bool enable_dump_;
   bool force_dump_;
+  // partitions of current round are kept in memory, each one fits l2 cache after aggregation
+  bool radix_part_;
 
   // for batch
   const ObChunkDatumStore::StoredRow **batch_rows_from_dump_;
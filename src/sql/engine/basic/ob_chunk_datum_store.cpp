@@ -449,11 +449,12 @@ ObChunkDatumStore::ObChunkDatumStore(common::ObIAllocator *alloc /* = NULL */)
     default_block_size_(BLOCK_SIZE),
     n_blocks_(0), row_cnt_(0), col_count_(-1),
     enable_dump_(true), has_dumped_(false), dumped_row_cnt_(0),
-    io_event_observer_(nullptr), file_size_(0), n_block_in_file_(0),
+    io_event_observer_(nullptr), file_size_(0), raw_file_size_(0), n_block_in_file_(0),
     mem_hold_(0), mem_used_(0), max_hold_mem_(0),
     allocator_(NULL == alloc ? &inner_allocator_ : alloc),
     row_extend_size_(0), callback_(nullptr), batch_ctx_(NULL),
-    tmp_dump_blk_(nullptr)
+    tmp_dump_blk_(nullptr), compressor_(nullptr), compress_buf_(nullptr),
+    compress_buf_size_(0)
 {
   io_.fd_ = -1;
   io_.dir_id_ = -1;
@@ -484,6 +485,7 @@ int ObChunkDatumStore::init(int64_t mem_limit,
   min_blk_size_ = INT64_MAX;
   io_.fd_ = -1;
   row_extend_size_ = row_extend_size;
+  disk_blk_sizes_.set_label(label);
   return ret;
 }
 
@@ -500,7 +502,13 @@ void ObChunkDatumStore::reset()
     io_.fd_ = -1;
   }
   file_size_ = 0;
+  raw_file_size_ = 0;
   n_block_in_file_ = 0;
+  compressor_ = nullptr;
+  free_blk_mem(compress_buf_, compress_buf_size_);
+  compress_buf_ = nullptr;
+  compress_buf_size_ = 0;
+  disk_blk_sizes_.reset();
 
   while (!blocks_.is_empty()) {
     Block *item = blocks_.remove_first();
@@ -730,12 +738,13 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
                                       item->get_block()->blk_size_);
       tmp_dump_blk_->rows_ = item->get_block()->rows_;
       tmp_dump_blk_->get_buffer()->fast_advance(item->data_size() - BlockBuffer::HEAD_SIZE);
-      if (OB_FAIL(write_file(tmp_dump_blk_->get_buffer()->data(),
-                             tmp_dump_blk_->get_buffer()->capacity()))) {
+      if (OB_FAIL(write_block(tmp_dump_blk_->get_buffer()->data(),
+                              tmp_dump_blk_->get_buffer()->data_size(),
+                              tmp_dump_blk_->get_buffer()->capacity()))) {
         LOG_WARN("write block to file failed");
       }
     }
-  } else if (OB_FAIL(write_file(item->data(), item->capacity()))) {
+  } else if (OB_FAIL(write_block(item->data(), item->data_size(), item->capacity()))) {
     LOG_WARN("write block to file failed");
   }
   if (OB_SUCC(ret)) {
@@ -1872,6 +1881,8 @@ int ObChunkDatumStore::ChunkIterator::read_next_blk()
   if (OB_SUCC(ret)) {
     if (OB_FAIL(aio_wait())) {
       LOG_WARN("aio wait failed", K(ret));
+    } else if (NULL != store_->compressor_ && OB_FAIL(decompress_aio_blk())) {
+      LOG_WARN("decompress block failed", K(ret));
     }
   }
   if (OB_SUCC(ret) && !aio_blk_->magic_check()) {
@@ -1929,16 +1940,63 @@ int ObChunkDatumStore::ChunkIterator::read_next_blk()
   return ret;
 }
 
+// replace the compressed %aio_blk_ with the restored block
+int ObChunkDatumStore::ChunkIterator::decompress_aio_blk()
+{
+  int ret = OB_SUCCESS;
+  const ObCompressedBlockHeader *header = reinterpret_cast<ObCompressedBlockHeader *>(aio_blk_);
+  Block *blk = NULL;
+  if (OB_ISNULL(aio_blk_) || OB_ISNULL(store_->compressor_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null", K(ret), KP(aio_blk_), KP(store_->compressor_));
+  } else if (OB_UNLIKELY(!header->is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("read corrupt compressed block", K(ret), K(*header), K(*this), K(*store_));
+  } else if (OB_FAIL(alloc_block(blk, header->raw_size_ + sizeof(BlockBuffer)))) {
+    LOG_WARN("alloc block failed", K(ret), K(*header));
+  } else {
+    BlockBuffer *blk_buf = blk->get_buffer();
+    if (OB_FAIL(ObChunkStoreUtil::decompress_block(*store_->compressor_, *header,
+                                                   reinterpret_cast<char *>(blk),
+                                                   blk_buf->capacity()))) {
+      LOG_WARN("decompress block failed", K(ret), K(*header));
+      free_block(blk, blk_buf->mem_size());
+    } else {
+      free_block(aio_blk_, aio_blk_buf_->mem_size());
+      aio_blk_ = blk;
+      aio_blk_buf_ = blk_buf;
+    }
+  }
+  return ret;
+}
+
 int ObChunkDatumStore::ChunkIterator::prefetch_next_blk()
 {
   int ret = OB_SUCCESS;
   CK(NULL == aio_blk_);
-  const int64_t block_size = store_->min_blk_size_;
-  if (OB_FAIL(alloc_block(aio_blk_, block_size))) {
+  int64_t block_size = store_->min_blk_size_;
+  int64_t read_size = 0;
+  if (OB_FAIL(ret)) {
+  } else if (NULL != store_->compressor_) {
+    // compressed block is read exactly by its on disk size
+    const int64_t idx = cur_nth_blk_ + 1;
+    if (idx < 0 || idx >= store_->disk_blk_sizes_.count()) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected block index", K(ret), K(idx), K(store_->disk_blk_sizes_.count()));
+    } else {
+      read_size = store_->disk_blk_sizes_.at(idx);
+      block_size = read_size + sizeof(BlockBuffer);
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(alloc_block(aio_blk_, block_size))) {
     LOG_WARN("allocate block buffer failed", K(ret));
   } else {
     aio_blk_buf_ = aio_blk_->get_buffer();
-    if (OB_FAIL(aio_read((char *)aio_blk_, aio_blk_buf_->capacity()))) {
+    if (NULL == store_->compressor_) {
+      read_size = aio_blk_buf_->capacity();
+    }
+    if (OB_FAIL(aio_read((char *)aio_blk_, read_size))) {
       LOG_WARN("aio read failed", K(ret));
     }
   }
@@ -1963,7 +2021,7 @@ int ObChunkDatumStore::ChunkIterator::load_next_block()
     LOG_WARN("row should be saved", K(ret), K_(cur_nth_blk), K_(store_->n_blocks));
   } else if (store_->is_file_open() && !read_file_iter_end()) {
     uint64_t begin_io_read_time = rdtsc();
-    if (chunk_read_size_ > store_->max_blk_size_) {
+    if (chunk_read_size_ > store_->max_blk_size_ && NULL == store_->compressor_) {
       // may return OB_ITER_END when read file not end (!read_file_iter_end())
       if (OB_FAIL(store_->load_next_chunk_blocks(*this)) && OB_ITER_END != ret) {
         LOG_WARN("RowStore iter load next chunk blocks failed", K(ret));
@@ -2476,6 +2534,49 @@ int ObChunkDatumStore::alloc_dir_id()
   return ret;
 }
 
+int ObChunkDatumStore::write_block(void *buf, const int64_t used_size, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  int64_t buf_size = 0;
+  int64_t disk_size = 0;
+  const bool file_opened = is_file_open();
+  if (!file_opened && OB_FAIL(ObChunkStoreUtil::get_spill_compressor(compressor_))) {
+    LOG_WARN("get spill compressor failed", K(ret));
+  } else if (NULL == compressor_) {
+    if (OB_FAIL(write_file(buf, size))) {
+      LOG_WARN("write file failed", K(ret), K(size));
+    }
+  } else if (OB_FAIL(ObChunkStoreUtil::get_compress_buf_size(*compressor_, used_size, buf_size))) {
+    LOG_WARN("get compress buffer size failed", K(ret), K(used_size));
+  } else {
+    if (buf_size > compress_buf_size_) {
+      free_blk_mem(compress_buf_, compress_buf_size_);
+      compress_buf_size_ = 0;
+      if (OB_ISNULL(compress_buf_ = static_cast<char *>(alloc_blk_mem(buf_size, false)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc memory failed", K(ret), K(buf_size));
+      } else {
+        compress_buf_size_ = buf_size;
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(ObChunkStoreUtil::compress_block(*compressor_, static_cast<char *>(buf),
+        size, used_size, compress_buf_, compress_buf_size_, disk_size))) {
+      LOG_WARN("compress block failed", K(ret), K(size), K(used_size));
+    } else if (OB_FAIL(disk_blk_sizes_.push_back(static_cast<int32_t>(disk_size)))) {
+      LOG_WARN("push back failed", K(ret));
+    } else if (OB_FAIL(write_file(compress_buf_, disk_size))) {
+      LOG_WARN("write file failed", K(ret), K(disk_size));
+      disk_blk_sizes_.pop_back();
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // the file size is reset when the file is opened by write_file()
+    raw_file_size_ = (file_opened ? raw_file_size_ : 0) + size;
+  }
+  return ret;
+}
+
 int ObChunkDatumStore::write_file(void *buf, int64_t size)
 {
   int ret = OB_SUCCESS;
@@ -15,6 +15,7 @@
 
 #include "share/ob_define.h"
 #include "lib/container/ob_se_array.h"
+#include "lib/container/ob_array.h"
 #include "lib/allocator/page_arena.h"
 #include "lib/utility/ob_print_utils.h"
 #include "lib/list/ob_dlist.h"
@@ -28,6 +29,10 @@
 
 namespace oceanbase
 {
+namespace common
+{
+class ObCompressor;
+}
 namespace sql
 {
 
@@ -726,6 +731,7 @@ public:
      int load_next_block();
      int prefetch_next_blk();
      int read_next_blk();
+     int decompress_aio_blk();
      int aio_read(char *buf, const int64_t size);
      int aio_wait();
      int alloc_block(Block *&blk, const int64_t size);
@@ -926,7 +932,10 @@ public:
   inline int64_t get_max_hold_mem() const { return max_hold_mem_; }
   inline int64_t get_file_fd() const { return io_.fd_; }
   inline int64_t get_file_dir_id() const { return io_.dir_id_; }
-  inline int64_t get_file_size() const { return file_size_; }
+  // size of the dumped blocks before compression, used to size the reloading of dumped data
+  inline int64_t get_file_size() const { return raw_file_size_; }
+  // bytes written to the temp file, less than get_file_size() if spill compression is enabled
+  inline int64_t get_disk_file_size() const { return file_size_; }
   inline int64_t min_blk_size(const int64_t row_store_size)
   {
     int64_t size = std::max(default_block_size_, row_store_size);
@@ -952,7 +961,7 @@ public:
   void set_dir_id(int64_t dir_id) { io_.dir_id_ = dir_id; }
   int alloc_dir_id();
   TO_STRING_KV(K_(tenant_id), K_(label), K_(ctx_id),  K_(mem_limit),
-      K_(row_cnt), K_(file_size), K_(enable_dump));
+      K_(row_cnt), K_(file_size), K_(raw_file_size), K_(enable_dump));
 
   int append_datum_store(const ObChunkDatumStore &other_store);
   int assign(const ObChunkDatumStore &other_store);
@@ -1009,6 +1018,8 @@ private:
     }
   inline int dump_one_block(BlockBuffer *item);
 
+  // write block to file, compressed if spill compression is enabled
+  int write_block(void *buf, const int64_t used_size, const int64_t size);
   int write_file(void *buf, int64_t size);
   int read_file(
       void *buf, const int64_t size, const int64_t offset, blocksstable::ObTmpFileIOHandle &handle,
@@ -1089,6 +1100,7 @@ private:
   //int fd_;
   blocksstable::ObTmpFileIOInfo io_;
   int64_t file_size_;
+  int64_t raw_file_size_;
   int64_t n_block_in_file_;
 
   //BlockList blocks_;  // ASSERT: all linked blocks has at least one row stored
@@ -1103,6 +1115,13 @@ private:
   BatchCtx *batch_ctx_;
   Block *tmp_dump_blk_;
 
+  // compressor of dumped blocks, decided when the file is opened
+  common::ObCompressor *compressor_;
+  char *compress_buf_;
+  int64_t compress_buf_size_;
+  // on disk size of each compressed block in file
+  common::ObArray<int32_t> disk_blk_sizes_;
+
   DISALLOW_COPY_AND_ASSIGN(ObChunkDatumStore);
 };
 
@@ -1699,6 +1699,92 @@ int ObChunkStoreUtil::alloc_dir_id(int64_t &dir_id)
   return ret;
 }
 
+int ObChunkStoreUtil::get_spill_compressor(ObCompressor *&compressor)
+{
+  int ret = OB_SUCCESS;
+  ObCompressorType compressor_type = INVALID_COMPRESSOR;
+  compressor = NULL;
+  if (OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(
+      GCONF._sql_spill_compress_func, compressor_type))) {
+    LOG_WARN("get compressor type failed", K(ret));
+  } else if (NONE_COMPRESSOR == compressor_type) {
+    // spill compression disabled
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(
+      compressor_type, compressor))) {
+    LOG_WARN("get compressor failed", K(ret), K(compressor_type));
+  }
+  return ret;
+}
+
+int ObChunkStoreUtil::get_compress_buf_size(ObCompressor &compressor,
+                                            const int64_t used_size,
+                                            int64_t &buf_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t max_overflow_size = 0;
+  if (OB_FAIL(compressor.get_max_overflow_size(used_size, max_overflow_size))) {
+    LOG_WARN("get max overflow size failed", K(ret), K(used_size));
+  } else {
+    buf_size = sizeof(ObCompressedBlockHeader) + used_size + max_overflow_size;
+  }
+  return ret;
+}
+
+int ObChunkStoreUtil::compress_block(ObCompressor &compressor,
+                                     const char *src,
+                                     const int64_t raw_size,
+                                     const int64_t used_size,
+                                     char *dst,
+                                     const int64_t dst_size,
+                                     int64_t &disk_size)
+{
+  int ret = OB_SUCCESS;
+  const int64_t header_size = sizeof(ObCompressedBlockHeader);
+  int64_t data_size = 0;
+  if (OB_ISNULL(src) || OB_ISNULL(dst) || used_size <= 0 || used_size > raw_size
+      || raw_size > INT32_MAX || dst_size < header_size + used_size) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(src), KP(dst), K(raw_size), K(used_size), K(dst_size));
+  } else if (OB_FAIL(compressor.compress(src, used_size, dst + header_size,
+                                         dst_size - header_size, data_size))) {
+    LOG_WARN("compress block failed", K(ret), K(used_size), K(dst_size));
+  } else {
+    if (data_size >= used_size) {
+      // no benefit, keep the raw data
+      MEMCPY(dst + header_size, src, used_size);
+      data_size = used_size;
+    }
+    ObCompressedBlockHeader *header = new (dst) ObCompressedBlockHeader();
+    header->raw_size_ = static_cast<int32_t>(raw_size);
+    header->used_size_ = static_cast<int32_t>(used_size);
+    header->data_size_ = static_cast<int32_t>(data_size);
+    disk_size = header_size + data_size;
+  }
+  return ret;
+}
+
+int ObChunkStoreUtil::decompress_block(ObCompressor &compressor,
+                                       const ObCompressedBlockHeader &header,
+                                       char *dst,
+                                       const int64_t dst_size)
+{
+  int ret = OB_SUCCESS;
+  const char *data = reinterpret_cast<const char *>(&header) + sizeof(header);
+  int64_t out_size = 0;
+  if (OB_UNLIKELY(!header.is_valid()) || OB_ISNULL(dst) || dst_size < header.raw_size_) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(header), KP(dst), K(dst_size));
+  } else if (!header.is_compressed()) {
+    MEMCPY(dst, data, header.used_size_);
+  } else if (OB_FAIL(compressor.decompress(data, header.data_size_, dst, dst_size, out_size))) {
+    LOG_WARN("decompress block failed", K(ret), K(header));
+  } else if (OB_UNLIKELY(out_size != header.used_size_)) {
+    ret = OB_CHECKSUM_ERROR;
+    LOG_WARN("decompressed size mismatch", K(ret), K(out_size), K(header));
+  }
+  return ret;
+}
+
 int ObChunkRowStore::Block::gen_unswizzling_payload(char *unswizzling_payload, uint32 size)
 {
   int ret = OB_SUCCESS;
@@ -21,6 +21,7 @@
 #include "common/row/ob_row.h"
 #include "common/row/ob_row_iterator.h"
 #include "storage/blocksstable/ob_tmp_file.h"
+#include "lib/compress/ob_compressor_pool.h"
 #include "sql/engine/basic/ob_sql_mem_callback.h"
 
 namespace oceanbase
@@ -532,10 +533,47 @@ inline int ObChunkRowStore::BlockBuffer::advance(int64_t size)
   return ret;
 }
 
+// Header of compressed block in sql spill file, followed by %data_size_ bytes of
+// compressed data (stored as is if compression doesn't reduce the size).
+struct ObCompressedBlockHeader
+{
+  static const int64_t MAGIC = 0x5b1ce6a8f04d2397;
+  ObCompressedBlockHeader() : magic_(MAGIC), raw_size_(0), used_size_(0), data_size_(0), reserved_(0) {}
+  bool is_valid() const
+  {
+    return MAGIC == magic_ && used_size_ > 0 && used_size_ <= raw_size_ && data_size_ > 0;
+  }
+  bool is_compressed() const { return data_size_ != used_size_; }
+  TO_STRING_KV(K_(magic), K_(raw_size), K_(used_size), K_(data_size));
+
+  int64_t magic_;
+  int32_t raw_size_; // memory size of the restored block
+  int32_t used_size_; // leading bytes of the block which are stored
+  int32_t data_size_;
+  int32_t reserved_;
+};
+
 class ObChunkStoreUtil
 {
 public:
   static int alloc_dir_id(int64_t &dir_id);
+  // Get compressor of spilled blocks by _sql_spill_compress_func, NULL if disabled.
+  static int get_spill_compressor(common::ObCompressor *&compressor);
+  static int get_compress_buf_size(common::ObCompressor &compressor,
+                                   const int64_t used_size,
+                                   int64_t &buf_size);
+  // Compress the leading %used_size bytes of %src to %dst with ObCompressedBlockHeader ahead.
+  static int compress_block(common::ObCompressor &compressor,
+                            const char *src,
+                            const int64_t raw_size,
+                            const int64_t used_size,
+                            char *dst,
+                            const int64_t dst_size,
+                            int64_t &disk_size);
+  static int decompress_block(common::ObCompressor &compressor,
+                              const ObCompressedBlockHeader &header,
+                              char *dst,
+                              const int64_t dst_size);
 };
 
 } // end namespace sql
@@ -19,6 +19,7 @@
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "storage/blocksstable/ob_datum_row.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "share/ob_cluster_version.h"
 
 namespace oceanbase
 {
@@ -27,6 +28,33 @@ using namespace share;
 namespace sql
 {
 
+bool ObPushdownFilterUtils::is_sum_pushdown_supported(
+    const ObObjTypeClass param_tc,
+    const ObObjTypeClass result_tc)
+{
+  bool bret = false;
+  switch (param_tc) {
+    case ObIntTC:
+    case ObUIntTC:
+    case ObNumberTC: {
+      bret = ObNumberTC == result_tc;
+      break;
+    }
+    case ObFloatTC: {
+      bret = ObFloatTC == result_tc || ObDoubleTC == result_tc;
+      break;
+    }
+    case ObDoubleTC: {
+      bret = ObDoubleTC == result_tc;
+      break;
+    }
+    default: {
+      bret = false;
+    }
+  }
+  return bret;
+}
+
 ObPushdownFilterFactory::PDFilterAllocFunc ObPushdownFilterFactory::PD_FILTER_ALLOC[PushdownFilterType::MAX_FILTER_TYPE] =
 {
   ObPushdownFilterFactory::alloc<ObPushdownBlackFilterNode, BLACK_FILTER>,
@@ -105,7 +133,8 @@ const common::ObCmpOp ObPushdownWhiteFilterNode::WHITE_OP_TO_CMP_OP[] = {
   CO_MAX, // WHITE_OP_BT
   CO_MAX, // WHITE_OP_IN
   CO_MAX, // WHITE_OP_NU
-  CO_MAX  // WHITE_OP_NN
+  CO_MAX, // WHITE_OP_NN
+  CO_MAX  // WHITE_OP_LI
 };
 
 int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
@@ -139,6 +168,9 @@ int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
     case T_FUN_SYS_ISNULL:
       op_type_ = WHITE_OP_NU;
       break;
+    case T_OP_LIKE:
+      op_type_ = WHITE_OP_LI;
+      break;
     default:
       ret = OB_ERR_UNEXPECTED;
       break;
@@ -164,6 +196,13 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
     need_check = false;
   } else {
     const ObObjMeta &col_meta = child->get_result_meta();
+    const bool is_like = T_OP_LIKE == raw_expr->get_expr_type();
+    if (is_like) {
+      // pattern is checked at runtime in oracle mode, leave it to black filter,
+      // and older observers can not deserialize WHITE_OP_LI during upgrade
+      need_check = GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_1_0_1
+          && lib::is_mysql_mode() && ob_is_string_tc(col_meta.get_type());
+    }
     for (int64_t i = 1; OB_SUCC(ret) && need_check && i < raw_expr->get_param_count(); i++) {
       if (OB_ISNULL(child = raw_expr->get_param_expr(i))) {
         ret = OB_ERR_UNEXPECTED;
@@ -171,7 +210,12 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
       } else {
         const ObObjMeta &param_meta = child->get_result_meta();
         need_check = child->is_const_expr();
-        if (need_check && !param_meta.is_null()) {
+        if (!need_check) {
+        } else if (is_like) {
+          // pattern should share the collation of column, escape has its own collation
+          need_check = ob_is_string_tc(param_meta.get_type())
+              && (1 != i || param_meta.get_collation_type() == col_meta.get_collation_type());
+        } else if (!param_meta.is_null()) {
           const ObCmpOp cmp_op = sql::ObRelationalExprOperator::get_cmp_op(raw_expr->get_expr_type());
           obj_cmp_func cmp_func = nullptr;
           need_check = ObObjCmpFuncs::can_cmp_without_cast(col_meta, param_meta, cmp_op, cmp_func);
@@ -188,6 +232,7 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
       case T_OP_GE:
       case T_OP_GT:
       case T_OP_NE:
+      case T_OP_LIKE:
       case T_FUN_SYS_ISNULL:
         is_white = true;
         break;
@@ -995,6 +1040,8 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
     check_null_params();
     if (WHITE_OP_IN == filter_.get_op_type() && OB_FAIL(init_obj_set())) {
       LOG_WARN("Failed to init Object hash set in filter node", K(ret));
+    } else if (WHITE_OP_LI == filter_.get_op_type() && OB_FAIL(init_like_escape())) {
+      LOG_WARN("Failed to init escape of like filter", K(ret));
     }
   }
   return ret;
@@ -1003,7 +1050,9 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
 void ObWhiteFilterExecutor::check_null_params()
 {
   null_param_contained_ = false;
-  for (int64_t i = 0; !null_param_contained_ && i < params_.count(); i++) {
+  // null escape of LIKE means the default one, only pattern matters
+  const int64_t param_cnt = WHITE_OP_LI == filter_.get_op_type() ? 1 : params_.count();
+  for (int64_t i = 0; !null_param_contained_ && i < param_cnt; i++) {
     if ((lib::is_mysql_mode() && params_.at(i).is_null())
         || (lib::is_oracle_mode() && params_.at(i).is_null_oracle())) {
       null_param_contained_ = true;
@@ -1048,6 +1097,50 @@ int ObWhiteFilterExecutor::exist_in_obj_set(const ObObj &obj, bool &is_exist) co
   return ret;
 }
 
+int ObWhiteFilterExecutor::init_like_escape()
+{
+  int ret = OB_SUCCESS;
+  like_escape_wc_ = static_cast<int32_t>('\\');
+  if (OB_UNLIKELY(2 != params_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected param count of like filter", K(ret), K(params_));
+  } else if (!params_.at(1).is_null() && !params_.at(1).get_string().empty()) {
+    const ObString escape = params_.at(1).get_string();
+    const ObCollationType escape_coll = params_.at(1).get_collation_type();
+    if (1 != ObCharset::strlen_char(escape_coll, escape.ptr(), escape.length())
+        || OB_SUCCESS != ObCharset::mb_wc(escape_coll, escape, like_escape_wc_)) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("Invalid argument to ESCAPE", K(ret), K(escape), K(escape_coll));
+      LOG_USER_ERROR(OB_INVALID_ARGUMENT, "ESCAPE");
+    }
+  }
+  return ret;
+}
+
+int ObWhiteFilterExecutor::like_match(const ObObj &obj, bool &is_match) const
+{
+  int ret = OB_SUCCESS;
+  is_match = false;
+  if (OB_UNLIKELY(WHITE_OP_LI != filter_.get_op_type() || 2 != params_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected like filter", K(ret), K_(filter), K_(params));
+  } else if (obj.is_null() || null_param_contained_) {
+    // Result of like with null is null
+  } else {
+    const ObObj &pattern = params_.at(0);
+    const ObString text_val = obj.get_string();
+    const ObString pattern_val = pattern.get_string();
+    if (text_val.empty() && pattern_val.empty()) {
+      is_match = true;
+    } else {
+      is_match = ObCharset::wildcmp(pattern.get_collation_type(), text_val, pattern_val,
+                                    like_escape_wc_, static_cast<int32_t>('_'),
+                                    static_cast<int32_t>('%'));
+    }
+  }
+  return ret;
+}
+
 ObBlackFilterExecutor::~ObBlackFilterExecutor()
 {
   if (nullptr != eval_infos_) {
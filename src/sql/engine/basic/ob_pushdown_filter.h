@@ -89,6 +89,10 @@ public:
   { return pd_storage_flag & 0x02; }
   OB_INLINE static bool is_aggregate_pushdown_storage(int32_t pd_storage_flag)
   { return pd_storage_flag & 0x04; }
+  // storage sums numeric column without cast only, used by optimizer and ObSumAggCell
+  static bool is_sum_pushdown_supported(
+      const common::ObObjTypeClass param_tc,
+      const common::ObObjTypeClass result_tc);
 };
 
 class ObPushdownFilterNode
@@ -173,7 +177,7 @@ enum ObWhiteFilterOperatorType
   WHITE_OP_IN, // in (1, 2, 3)
   WHITE_OP_NU, // is null
   WHITE_OP_NN, // is not null
-  // WHITE_OP_LI, // like
+  WHITE_OP_LI, // like
   WHITE_OP_MAX,
 };
 class ObPushdownWhiteFilterNode : public ObPushdownFilterNode
@@ -435,7 +439,8 @@ public:
                         ObPushdownWhiteFilterNode &filter,
                         ObPushdownOperator &op)
       : ObPushdownFilterExecutor(alloc, op, PushdownExecutorType::WHITE_FILTER_EXECUTOR),
-      null_param_contained_(false), params_(alloc), filter_(filter) {}
+      null_param_contained_(false), like_escape_wc_(static_cast<int32_t>('\\')),
+      params_(alloc), filter_(filter) {}
   ~ObWhiteFilterExecutor()
   {
     params_.reset();
@@ -455,14 +460,18 @@ public:
   bool is_obj_set_created() const { return param_set_.created(); };
   OB_INLINE ObWhiteFilterOperatorType get_op_type() const
   { return filter_.get_op_type(); }
+  // Match @obj with the pattern of LIKE filter, result of null @obj is false
+  int like_match(const common::ObObj &obj, bool &is_match) const;
   INHERIT_TO_STRING_KV("ObPushdownWhiteFilterExecutor", ObPushdownFilterExecutor,
                        K_(null_param_contained), K_(params), K(param_set_.created()),
-                       K_(filter));
+                       K_(like_escape_wc), K_(filter));
 private:
   void check_null_params();
   int init_obj_set();
+  int init_like_escape();
 private:
   bool null_param_contained_;
+  int32_t like_escape_wc_;
   common::ObFixedArray<common::ObObj, common::ObIAllocator> params_;
   common::hash::ObHashSet<common::ObObj> param_set_;
   ObPushdownWhiteFilterNode &filter_;
@@ -18,6 +18,7 @@
 #include "lib/utility/ob_tracepoint.h"
 #include "share/config/ob_server_config.h"
 #include "sql/engine/basic/ob_chunk_datum_store.h"
+#include "sql/engine/basic/ob_chunk_row_store.h"
 #include "sql/engine/ob_io_event_observer.h"
 
 
@@ -350,7 +351,8 @@ ObRADatumStore::ObRADatumStore(common::ObIAllocator *alloc /* = NULL */)
   : inited_(false), tenant_id_(0), label_(nullptr), ctx_id_(0), mem_limit_(0),
     idx_blk_(NULL), save_row_cnt_(0), row_cnt_(0), fd_(-1), dir_id_(-1), file_size_(0),
     inner_reader_(*this), mem_hold_(0), allocator_(NULL == alloc ? &inner_allocator_ : alloc),
-    row_extend_size_(0), mem_stat_(NULL), io_observer_(NULL)
+    row_extend_size_(0), mem_stat_(NULL), io_observer_(NULL), compressor_(NULL),
+    compress_buf_(NULL), compress_buf_size_(0)
 {
 }
 
@@ -426,6 +428,9 @@ void ObRADatumStore::reset()
     }
   }
   blocks_.reset();
+  compressor_ = NULL;
+  compress_buf_ = NULL;
+  compress_buf_size_ = 0;
   set_mem_hold(0);
   row_extend_size_ = 0;
   inited_ = false;
@@ -462,6 +467,9 @@ void ObRADatumStore::reuse()
     set_mem_hold(blkbuf_.buf_.capacity() + sizeof(LinkNode));
   }
   blocks_.reset();
+  compressor_ = NULL;
+  compress_buf_ = NULL;
+  compress_buf_size_ = 0;
 }
 
 int ObRADatumStore::setup_block(BlockBuffer &blkbuf) const
@@ -959,14 +967,11 @@ int ObRADatumStore::load_idx_block(Reader &reader, IndexBlock *&ib, const BlockI
     if (!bi.on_disk_) {
       ib = bi.idx_blk_;
     } else {
-      if (OB_UNLIKELY(bi.length_ > IndexBlock::INDEX_BLOCK_SIZE)) {
+      if (OB_UNLIKELY(NULL == compressor_ && bi.length_ > IndexBlock::INDEX_BLOCK_SIZE)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("invalid argument", K(ret), K(bi));
-      } else if (OB_FAIL(ensure_reader_buffer(
-          reader, reader.idx_buf_, IndexBlock::INDEX_BLOCK_SIZE))) {
-        LOG_WARN("ensure reader buffer failed", K(ret));
-      } else if (OB_FAIL(read_file(
-          reader.idx_buf_.data(), bi.length_, bi.offset_))) {
+      } else if (OB_FAIL(read_block(
+          reader, reader.idx_buf_, bi, IndexBlock::INDEX_BLOCK_SIZE))) {
         LOG_WARN("read block index from file failed", K(ret), K(bi));
       } else {
         ib = reinterpret_cast<IndexBlock *>(reader.idx_buf_.data());
@@ -992,9 +997,7 @@ int ObRADatumStore::load_block(Reader &reader, const int64_t row_id)
     if (!bi.on_disk_) {
       reader.blk_ = bi.blk_;
     } else {
-      if (OB_FAIL(ensure_reader_buffer(reader, reader.buf_, bi.length_))) {
-        LOG_WARN("ensure reader buffer failed", K(ret));
-      } else if (OB_FAIL(read_file(reader.buf_.data(), bi.length_, bi.offset_))) {
+      if (OB_FAIL(read_block(reader, reader.buf_, bi, bi.length_))) {
         LOG_WARN("read block from file failed", K(ret), K(bi));
       } else {
         reader.blk_ = reinterpret_cast<Block *>(reader.buf_.data());
@@ -1125,13 +1128,31 @@ int ObRADatumStore::write_file(BlockIndex &bi, void *buf, int64_t size)
         LOG_WARN("alloc file directory failed", K(ret));
       } else if (OB_FAIL(FILE_MANAGER_INSTANCE_V2.open(fd_, dir_id_))) {
         LOG_WARN("open file failed", K(ret));
+      } else if (OB_FAIL(ObChunkStoreUtil::get_spill_compressor(compressor_))) {
+        LOG_WARN("get spill compressor failed", K(ret));
       } else {
         file_size_ = 0;
-        LOG_INFO("open file success", K_(fd), K_(dir_id));
+        LOG_INFO("open file success", K_(fd), K_(dir_id), KP_(compressor));
       }
     }
     ret = OB_E(EventTable::EN_8) ret;
   }
+  if (OB_SUCC(ret) && size > 0 && NULL != compressor_) {
+    int64_t buf_size = 0;
+    int64_t disk_size = 0;
+    if (OB_FAIL(ObChunkStoreUtil::get_compress_buf_size(*compressor_, size, buf_size))) {
+      LOG_WARN("get compress buffer size failed", K(ret), K(size));
+    } else if (OB_FAIL(ensure_compress_buf(buf_size))) {
+      LOG_WARN("ensure compress buffer failed", K(ret), K(buf_size));
+    } else if (OB_FAIL(ObChunkStoreUtil::compress_block(*compressor_, static_cast<char *>(buf),
+        size, size, compress_buf_, compress_buf_size_, disk_size))) {
+      LOG_WARN("compress block failed", K(ret), K(size));
+    } else {
+      buf = compress_buf_;
+      size = disk_size;
+      bi.length_ = static_cast<int32_t>(disk_size);
+    }
+  }
   if (OB_SUCC(ret) && size > 0) {
     if (NULL != mem_stat_) {
       mem_stat_->dumped(size);
@@ -1198,6 +1219,57 @@ int ObRADatumStore::read_file(void *buf, const int64_t size, const int64_t offse
   return ret;
 }
 
+int ObRADatumStore::read_block(Reader &reader,
+                               ShrinkBuffer &buf,
+                               const BlockIndex &bi,
+                               const int64_t buf_size)
+{
+  int ret = OB_SUCCESS;
+  if (NULL == compressor_) {
+    if (OB_FAIL(ensure_reader_buffer(reader, buf, buf_size))) {
+      LOG_WARN("ensure reader buffer failed", K(ret));
+    } else if (OB_FAIL(read_file(buf.data(), bi.length_, bi.offset_))) {
+      LOG_WARN("read file failed", K(ret), K(bi));
+    }
+  } else {
+    const ObCompressedBlockHeader *header = NULL;
+    if (OB_FAIL(ensure_compress_buf(bi.length_))) {
+      LOG_WARN("ensure compress buffer failed", K(ret), K(bi));
+    } else if (OB_FAIL(read_file(compress_buf_, bi.length_, bi.offset_))) {
+      LOG_WARN("read file failed", K(ret), K(bi));
+    } else if (FALSE_IT(header = reinterpret_cast<ObCompressedBlockHeader *>(compress_buf_))) {
+    } else if (OB_UNLIKELY(bi.length_ < static_cast<int64_t>(sizeof(*header))
+        || !header->is_valid()
+        || static_cast<int64_t>(sizeof(*header)) + header->data_size_ != bi.length_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("read corrupt compressed block", K(ret), K(bi), K(*header));
+    } else if (OB_FAIL(ensure_reader_buffer(reader, buf,
+        std::max(buf_size, static_cast<int64_t>(header->raw_size_))))) {
+      LOG_WARN("ensure reader buffer failed", K(ret));
+    } else if (OB_FAIL(ObChunkStoreUtil::decompress_block(*compressor_, *header,
+        buf.data(), buf.capacity()))) {
+      LOG_WARN("decompress block failed", K(ret), K(bi));
+    }
+  }
+  return ret;
+}
+
+int ObRADatumStore::ensure_compress_buf(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size > compress_buf_size_) {
+    free_blk_mem(compress_buf_, compress_buf_size_);
+    compress_buf_size_ = 0;
+    if (OB_ISNULL(compress_buf_ = static_cast<char *>(alloc_blk_mem(size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc memory failed", K(ret), K(size));
+    } else {
+      compress_buf_size_ = size;
+    }
+  }
+  return ret;
+}
+
 int ObRADatumStore::ensure_reader_buffer(Reader &reader, ShrinkBuffer &buf, const int64_t size)
 {
   int ret = OB_SUCCESS;
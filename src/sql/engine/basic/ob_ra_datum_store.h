@@ -25,6 +25,10 @@
 
 namespace oceanbase
 {
+namespace common
+{
+class ObCompressor;
+}
 namespace sql
 {
 
@@ -407,6 +411,9 @@ private:
 
   int write_file(BlockIndex &bi, void *buf, int64_t size);
   int read_file(void *buf, const int64_t size, const int64_t offset);
+  // read dumped block of %bi to reader buffer, decompress if spill compression is enabled
+  int read_block(Reader &reader, ShrinkBuffer &buf, const BlockIndex &bi, const int64_t buf_size);
+  int ensure_compress_buf(const int64_t size);
 
   bool need_dump();
 
@@ -441,6 +448,11 @@ private:
   ObSqlMemoryCallback *mem_stat_;
   ObIOEventObserver *io_observer_;
 
+  // compressor of dumped blocks, decided when the file is opened
+  common::ObCompressor *compressor_;
+  char *compress_buf_;
+  int64_t compress_buf_size_;
+
   DISALLOW_COPY_AND_ASSIGN(ObRADatumStore);
 };
 
@@ -20,6 +20,7 @@
 #include "sql/engine/expr/ob_expr_extra_info_factory.h"
 #include "sql/engine/expr/ob_datum_cast.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_arith_fusion.h"
 
 namespace oceanbase
 {
@@ -671,7 +672,9 @@ int ObExpr::do_eval_batch(ObEvalCtx &ctx,
     if (OB_UNLIKELY(need_stack_check_) && OB_FAIL(check_stack_overflow())) {
       SQL_LOG(WARN, "failed to check stack overflow", K(ret));
     } else {
-      ret = (*eval_batch_func_)(*this, ctx, skip, size);
+      ret = OB_UNLIKELY(fused_arith_root_)
+          ? ObExprArithFusion::eval_batch(*this, ctx, skip, size)
+          : (*eval_batch_func_)(*this, ctx, skip, size);
       if (OB_SUCC(ret)) {
         if (!info->evaluated_) {
           info->cnt_ = size;
@@ -649,6 +649,7 @@ public:
       uint64_t is_boolean_:1; // to distinguish result of this expr between and int tc
       uint64_t is_dynamic_const_:1; // is const during the subplan execution, including exec param
       uint64_t need_stack_check_:1; // the expression tree depth needs to check whether the stack overflows
+      uint64_t fused_arith_root_:1; // batch evaluated by ObExprArithFusion with its children
     };
     uint64_t flag_;
   };
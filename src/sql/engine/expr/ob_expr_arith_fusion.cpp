@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include "sql/engine/expr/ob_expr_arith_fusion.h"
+#include "sql/engine/expr/ob_expr_add.h"
+#include "sql/engine/expr/ob_expr_minus.h"
+#include "sql/engine/expr/ob_expr_mul.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+bool ObExprArithFusion::is_fusable(const ObExpr &expr)
+{
+  bool bret = false;
+  if (2 == expr.arg_cnt_
+      && expr.is_batch_result()
+      && ObDoubleType == expr.datum_meta_.type_
+      && NULL != expr.args_
+      && NULL != expr.args_[0]
+      && NULL != expr.args_[1]
+      && ObDoubleType == expr.args_[0]->datum_meta_.type_
+      && ObDoubleType == expr.args_[1]->datum_meta_.type_) {
+    switch (expr.type_) {
+      case T_OP_ADD:
+        bret = &ObExprAdd::add_double_double_batch == expr.eval_batch_func_;
+        break;
+      case T_OP_MINUS:
+        bret = &ObExprMinus::minus_double_double_batch == expr.eval_batch_func_;
+        break;
+      case T_OP_MUL:
+        bret = &ObExprMul::mul_double_batch == expr.eval_batch_func_;
+        break;
+      default:
+        break;
+    }
+  }
+  return bret;
+}
+
+bool ObExprArithFusion::is_fused_root(const ObExpr &expr)
+{
+  bool bret = is_fusable(expr) && (is_fusable(*expr.args_[0]) || is_fusable(*expr.args_[1]));
+  for (int64_t i = 0; bret && i < expr.parent_cnt_; i++) {
+    if (NULL != expr.parents_[i] && is_fusable(*expr.parents_[i])) {
+      bret = false;
+    }
+  }
+  return bret;
+}
+
+int ObExprArithFusion::eval_batch(const ObExpr &expr,
+                                  ObEvalCtx &ctx,
+                                  const ObBitVector &skip,
+                                  const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx::TempAllocGuard alloc_guard(ctx);
+  RawVector res;
+  if (OB_FAIL(eval_node(expr, ctx, skip, size, 0, alloc_guard.get_allocator(), res))) {
+    LOG_WARN("eval fused arith expr failed", K(ret), K(expr));
+  } else {
+    ObDatum *datums = expr.locate_batch_datums(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    bool has_null = false;
+    for (int64_t i = 0; i < size; i++) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        // datums evaluated before may be used by others, do not overwrite them.
+      } else if (NULL != res.nulls_ && res.nulls_->at(i)) {
+        datums[i].set_null();
+        has_null = true;
+      } else {
+        datums[i].set_double(res.vals_[i]);
+      }
+    }
+    eval_flags.bit_calculate(skip, eval_flags, size,
+                             [](const uint64_t l, const uint64_t r) { return (~l) | r; });
+    if (has_null) {
+      expr.get_eval_info(ctx).notnull_ = false;
+    }
+  }
+  return ret;
+}
+
+int ObExprArithFusion::eval_node(const ObExpr &expr,
+                                 ObEvalCtx &ctx,
+                                 const ObBitVector &skip,
+                                 const int64_t size,
+                                 const int64_t depth,
+                                 ObIAllocator &alloc,
+                                 RawVector &res)
+{
+  int ret = OB_SUCCESS;
+  RawVector left;
+  RawVector right;
+  double *vals = NULL;
+  if (depth > 0 && (depth >= MAX_FUSED_DEPTH || !is_fusable(expr))) {
+    ret = eval_leaf(expr, ctx, skip, size, alloc, res);
+  } else if (OB_FAIL(eval_node(*expr.args_[0], ctx, skip, size, depth + 1, alloc, left))) {
+    LOG_WARN("eval left operand failed", K(ret));
+  } else if (OB_FAIL(eval_node(*expr.args_[1], ctx, skip, size, depth + 1, alloc, right))) {
+    LOG_WARN("eval right operand failed", K(ret));
+  } else if (OB_ISNULL(vals = static_cast<double *>(alloc.alloc(sizeof(double) * size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(size));
+  } else {
+    // calculate all rows including skipped ones in tight loops, the values of
+    // skipped rows are never used.
+    const double *l = left.vals_;
+    const double *r = right.vals_;
+    switch (expr.type_) {
+      case T_OP_ADD:
+        for (int64_t i = 0; i < size; i++) {
+          vals[i] = l[i] + r[i];
+        }
+        break;
+      case T_OP_MINUS:
+        for (int64_t i = 0; i < size; i++) {
+          vals[i] = l[i] - r[i];
+        }
+        break;
+      case T_OP_MUL:
+        for (int64_t i = 0; i < size; i++) {
+          vals[i] = l[i] * r[i];
+        }
+        break;
+      default:
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected fused expr type", K(ret), K(expr));
+        break;
+    }
+    res.vals_ = vals;
+    if (OB_FAIL(ret)) {
+    } else if (NULL == left.nulls_ || NULL == right.nulls_) {
+      res.nulls_ = NULL == left.nulls_ ? right.nulls_ : left.nulls_;
+    } else {
+      ObBitVector *nulls = to_bit_vector(alloc.alloc(ObBitVector::memory_size(size)));
+      if (OB_ISNULL(nulls)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("allocate memory failed", K(ret), K(size));
+      } else {
+        nulls->init(size);
+        nulls->bit_calculate(*left.nulls_, *right.nulls_, size,
+                             [](const uint64_t l, const uint64_t r) { return l | r; });
+        res.nulls_ = nulls;
+      }
+    }
+    // same as ObDoubleBatch*RawWithCheck, no check in oracle mode
+    if (OB_SUCC(ret) && !lib::is_oracle_mode()
+        && OB_FAIL(check_out_of_range(expr, skip, size, left, right, res))) {
+      LOG_WARN("check double out of range failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObExprArithFusion::eval_leaf(const ObExpr &expr,
+                                 ObEvalCtx &ctx,
+                                 const ObBitVector &skip,
+                                 const int64_t size,
+                                 ObIAllocator &alloc,
+                                 RawVector &res)
+{
+  int ret = OB_SUCCESS;
+  double *vals = NULL;
+  ObBitVector *nulls = NULL;
+  if (OB_FAIL(expr.eval_batch(ctx, skip, size))) {
+    LOG_WARN("eval batch failed", K(ret), K(expr));
+  } else if (expr.is_batch_result() && expr.get_eval_info(ctx).in_frame_notnull()) {
+    // no null and datums point to the reserved buffer, use the raw values directly.
+    res.vals_ = reinterpret_cast<const double *>(expr.get_rev_buf(ctx));
+    res.nulls_ = NULL;
+  } else if (OB_ISNULL(vals = static_cast<double *>(alloc.alloc(sizeof(double) * size)))
+             || OB_ISNULL(nulls = to_bit_vector(alloc.alloc(ObBitVector::memory_size(size))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(size));
+  } else if (!expr.is_batch_result()) {
+    const ObDatum &datum = expr.locate_expr_datum(ctx);
+    const double v = datum.is_null() ? 0 : datum.get_double();
+    for (int64_t i = 0; i < size; i++) {
+      vals[i] = v;
+    }
+    if (datum.is_null()) {
+      nulls->set_all(size);
+    }
+    res.vals_ = vals;
+    res.nulls_ = datum.is_null() ? nulls : NULL;
+  } else {
+    const ObDatum *datums = expr.locate_batch_datums(ctx);
+    bool has_null = false;
+    nulls->init(size);
+    for (int64_t i = 0; i < size; i++) {
+      if (skip.at(i)) {
+        vals[i] = 0;
+      } else if (datums[i].is_null()) {
+        vals[i] = 0;
+        nulls->set(i);
+        has_null = true;
+      } else {
+        vals[i] = datums[i].get_double();
+      }
+    }
+    res.vals_ = vals;
+    res.nulls_ = has_null ? nulls : NULL;
+  }
+  return ret;
+}
+
+int ObExprArithFusion::check_out_of_range(const ObExpr &expr,
+                                          const ObBitVector &skip,
+                                          const int64_t size,
+                                          const RawVector &left,
+                                          const RawVector &right,
+                                          const RawVector &res)
+{
+  int ret = OB_SUCCESS;
+  bool maybe_out_of_range = false;
+  for (int64_t i = 0; i < size; i++) {
+    maybe_out_of_range |= ObArithExprOperator::is_double_out_of_range(res.vals_[i]);
+  }
+  // values of skipped and null rows may be out of range, check them one by one.
+  for (int64_t i = 0; maybe_out_of_range && OB_SUCC(ret) && i < size; i++) {
+    if (skip.at(i) || (NULL != res.nulls_ && res.nulls_->at(i))) {
+    } else if (OB_UNLIKELY(ObArithExprOperator::is_double_out_of_range(res.vals_[i]))) {
+      const char op = T_OP_ADD == expr.type_ ? '+' : (T_OP_MINUS == expr.type_ ? '-' : '*');
+      char expr_str[OB_MAX_TWO_OPERATOR_EXPR_LENGTH];
+      int64_t pos = 0;
+      ret = OB_OPERATE_OVERFLOW;
+      databuff_printf(expr_str,
+                      OB_MAX_TWO_OPERATOR_EXPR_LENGTH,
+                      pos,
+                      "'(%e %c %e)'", left.vals_[i], op, right.vals_[i]);
+      LOG_USER_ERROR(OB_OPERATE_OVERFLOW, "DOUBLE", expr_str);
+      LOG_WARN("double out of range", K(left.vals_[i]), K(right.vals_[i]), K(res.vals_[i]));
+    }
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_EXPR_OB_EXPR_ARITH_FUSION_H_
+#define OCEANBASE_EXPR_OB_EXPR_ARITH_FUSION_H_
+
+#include "sql/engine/expr/ob_expr.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Fused batch evaluation of double arithmetic expression trees.
+//
+// e.g.: (c1 + c2) * c3 - c4
+//   The whole tree is evaluated by the root in one pass over raw double arrays, the
+//   inner nodes are not materialized into frames. It saves the per node evaluate
+//   function dispatching, evaluated flags maintaining and per datum null checking.
+//
+// The root is marked by ObExpr::fused_arith_root_ in code generation, the inner nodes
+// keep their own evaluate functions and are evaluated as usual if referenced by others.
+class ObExprArithFusion
+{
+public:
+  // deeper sub trees are evaluated as leaves
+  static const int64_t MAX_FUSED_DEPTH = 16;
+
+  // add, minus and mul of double which generated with raw batch evaluate function.
+  static bool is_fusable(const ObExpr &expr);
+  // fusable expr with at least one fusable child, and not absorbed by fusable parent.
+  static bool is_fused_root(const ObExpr &expr);
+
+  static int eval_batch(const ObExpr &expr,
+                        ObEvalCtx &ctx,
+                        const ObBitVector &skip,
+                        const int64_t size);
+private:
+  // raw values of a fused node, %nulls_ is NULL if all values are not null.
+  struct RawVector
+  {
+    RawVector() : vals_(NULL), nulls_(NULL) {}
+    const double *vals_;
+    const ObBitVector *nulls_;
+  };
+
+  static int eval_node(const ObExpr &expr,
+                       ObEvalCtx &ctx,
+                       const ObBitVector &skip,
+                       const int64_t size,
+                       const int64_t depth,
+                       common::ObIAllocator &alloc,
+                       RawVector &res);
+  static int eval_leaf(const ObExpr &expr,
+                       ObEvalCtx &ctx,
+                       const ObBitVector &skip,
+                       const int64_t size,
+                       common::ObIAllocator &alloc,
+                       RawVector &res);
+  static int check_out_of_range(const ObExpr &expr,
+                                const ObBitVector &skip,
+                                const int64_t size,
+                                const RawVector &left,
+                                const RawVector &right,
+                                const RawVector &res);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_EXPR_OB_EXPR_ARITH_FUSION_H_
@@ -143,6 +143,29 @@ int ObHashJoinOp::PartHashJoinTable::init(ObIAllocator &alloc)
       magic_ = MAGIC_CODE;
       bit_cnt_ = __builtin_ctz(BucketArray::BLOCK_CAPACITY);
     }
+    if (OB_SUCC(ret)) {
+      void *inline_key_buf = alloc.alloc(sizeof(InlineKeyArray));
+      if (OB_ISNULL(inline_key_buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc memory", K(ret));
+      } else {
+        inline_keys_ = new (inline_key_buf) InlineKeyArray(*ht_alloc_);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHashJoinOp::PartHashJoinTable::init_buckets()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(buckets_->init(nbuckets_))) {
+    LOG_WARN("alloc bucket array failed", K(ret), K(nbuckets_));
+  } else if (inline_key_cnt_ > 0) {
+    inline_keys_->reuse();
+    if (OB_FAIL(inline_keys_->init(nbuckets_))) {
+      LOG_WARN("alloc inline key array failed", K(ret), K(nbuckets_));
+    }
   }
   return ret;
 }
@@ -242,6 +265,8 @@ ObHashJoinOp::ObHashJoinOp(ObExecContext &ctx_, const ObOpSpec &spec, ObOpInput
   right_read_from_stored_(false),
   right_hash_vals_(NULL),
   cur_tuples_(NULL),
+  probe_inline_keys_(NULL),
+  inline_key_left_idx_(),
   right_batch_traverse_cnt_(0),
   hj_part_added_rows_(NULL),
   part_selectors_(NULL),
@@ -519,14 +544,43 @@ int ObHashJoinOp::inner_open()
                   right_hj_part_stored_rows_, sizeof(*right_hj_part_stored_rows_) * batch_size,
                   right_hash_vals_, sizeof(*right_hash_vals_) * batch_size,
                   cur_tuples_, sizeof(*cur_tuples_) * batch_size,
+                  probe_inline_keys_, sizeof(*probe_inline_keys_) * batch_size,
                   child_brs_.skip_, ObBitVector::memory_size(batch_size),
                   hj_part_added_rows_, sizeof(hj_part_added_rows_) * batch_size,
                   right_selector_, sizeof(*right_selector_) * batch_size));
   }
   cur_hash_table_ = &hash_table_;
+  if (OB_SUCC(ret)) {
+    init_inline_keys();
+  }
   return ret;
 }
 
+// Join keys are inlined in hash table if there are one or two fixed width keys with the same
+// type on both sides, then probe compares them directly rather than the keys of stored rows.
+void ObHashJoinOp::init_inline_keys()
+{
+  const int64_t key_cnt = left_join_keys_.count();
+  bool enable = is_vectorized() && !is_shared_ && !MY_SPEC.is_naaj_
+                && key_cnt > 0 && key_cnt <= MAX_INLINE_KEY_CNT
+                && key_cnt == MY_SPEC.equal_join_conds_.count();
+  for (int64_t i = 0; enable && i < key_cnt; ++i) {
+    ObExpr *left_key = left_join_keys_.at(i);
+    ObExpr *right_key = right_join_keys_.at(i);
+    const ObObjType type = left_key->datum_meta_.type_;
+    const ObObjTypeClass tc = ob_obj_type_class(type);
+    int64_t idx = -1;
+    enable = type == right_key->datum_meta_.type_
+             && (ObIntTC == tc || ObUIntTC == tc || ObDateTC == tc
+                 || ObDateTimeTC == tc || ObTimeTC == tc)
+             && has_exist_in_array(right_->get_spec().output_, right_key)
+             && has_exist_in_array(left_->get_spec().output_, left_key, &idx);
+    inline_key_left_idx_[i] = idx;
+  }
+  hash_table_.inline_key_cnt_ = enable ? key_cnt : 0;
+  LOG_TRACE("trace hash join inline keys", K(enable), K(key_cnt), K(spec_.id_));
+}
+
 int ObHashJoinOp::set_shared_info()
 {
   int ret = OB_SUCCESS;
@@ -1225,7 +1279,7 @@ int ObHashJoinOp::reuse_for_next_chunk()
     }
     // set bucket to zero.
     hash_table.buckets_->reuse();
-    OZ(hash_table.buckets_->init(hash_table.nbuckets_));
+    OZ(hash_table.init_buckets());
     hash_table.collisions_ = 0;
     hash_table.used_buckets_ = 0;
 
@@ -1304,7 +1358,7 @@ int ObHashJoinOp::build_hash_table_for_nest_loop(int64_t &num_left_rows)
               __builtin_prefetch((&hash_table.buckets_->at(left_stored_rows[i]->get_hash_value() & mask)), 1 /* write */, 3 /* high temporal locality*/);
             }
             for (int64_t i = 0; OB_SUCC(ret) && i < read_size; ++i) {
-              hash_table.set(left_stored_rows[i]->get_hash_value(), const_cast<ObHashJoinStoredJoinRow *>(left_stored_rows[i]));
+              set_hash_table_row(hash_table, const_cast<ObHashJoinStoredJoinRow *>(left_stored_rows[i]));
             }
           }
         }
@@ -1792,7 +1846,7 @@ int ObHashJoinOp::build_hash_table_in_memory(int64_t &num_left_rows)
               }
             } else {
               for (int64_t i = 0; OB_SUCC(ret) && i < read_size; ++i) {
-                hash_table.set(left_stored_rows[i]->get_hash_value(), const_cast<ObHashJoinStoredJoinRow *>(left_stored_rows[i]));
+                set_hash_table_row(hash_table, const_cast<ObHashJoinStoredJoinRow *>(left_stored_rows[i]));
               }
             }
           }
@@ -2848,7 +2902,7 @@ int ObHashJoinOp::prepare_hash_table()
     if (OB_FAIL(ret)) {
     } else if (OB_FAIL(init_bloom_filter(mem_context_->get_malloc_allocator(), hash_table_.nbuckets_))) {
       LOG_WARN("failed to create bloom filter", K(ret));
-    } else if (OB_FAIL(hash_table.buckets_->init(hash_table.nbuckets_))) {
+    } else if (OB_FAIL(hash_table.init_buckets())) {
       LOG_WARN("alloc bucket array failed", K(ret), K(hash_table.nbuckets_));
     } else {
       hash_table.collisions_ = 0;
@@ -2983,7 +3037,7 @@ int ObHashJoinOp::build_hash_table_for_recursive()
                   }
                 } else {
                   for (int64_t i = 0; OB_SUCC(ret) && i < read_size; ++i) {
-                    hash_table.set(part_stored_rows[i]->get_hash_value(), const_cast<ObHashJoinStoredJoinRow *>(part_stored_rows[i]));
+                    set_hash_table_row(hash_table, const_cast<ObHashJoinStoredJoinRow *>(part_stored_rows[i]));
                   }
                 }
               }
@@ -4807,11 +4861,29 @@ int ObHashJoinOp::read_hashrow_batch()
 
       int64_t idx = 0;
       ObHashJoinStoredJoinRow *tuple = NULL;
-      for (int64_t i = 0; i < right_selector_cnt_; i++) {
-        tuple = cur_hash_table_->get(right_hash_vals_[right_selector_[i]]);
-        if (NULL != tuple) {
-          cur_tuples_[idx] = tuple;
-          right_selector_[idx++] = right_selector_[i];
+      if (cur_hash_table_->inline_key_cnt_ > 0) {
+        // inline keys are read with the buckets, prefetch them too
+        for (int64_t i = 0; i < right_selector_cnt_; i++) {
+          uint64_t mask = cur_hash_table_->nbuckets_ - 1;
+          __builtin_prefetch(&cur_hash_table_->inline_keys_->at(mask & right_hash_vals_[right_selector_[i]]),
+                             0, // for read
+                             1); // low temporal locality
+        }
+        for (int64_t i = 0; i < right_selector_cnt_; i++) {
+          const int64_t batch_idx = right_selector_[i];
+          tuple = cur_hash_table_->get(right_hash_vals_[batch_idx], probe_inline_keys_[batch_idx]);
+          if (NULL != tuple) {
+            cur_tuples_[idx] = tuple;
+            right_selector_[idx++] = batch_idx;
+          }
+        }
+      } else {
+        for (int64_t i = 0; i < right_selector_cnt_; i++) {
+          tuple = cur_hash_table_->get(right_hash_vals_[right_selector_[i]]);
+          if (NULL != tuple) {
+            cur_tuples_[idx] = tuple;
+            right_selector_[idx++] = right_selector_[i];
+          }
         }
       }
       right_selector_cnt_ = idx;
@@ -4824,6 +4896,9 @@ int ObHashJoinOp::read_hashrow_batch()
                                 right_->get_spec().output_);
       }
     }
+    if (cur_hash_table_->inline_key_cnt_ > 0) {
+      filter_by_inline_keys();
+    }
   }
 
   // prefetch store row
@@ -4856,12 +4931,15 @@ int ObHashJoinOp::read_hashrow_batch()
       batch_info_guard.set_batch_idx(batch_idx);
       bool matched = false;
       ObHashJoinStoredJoinRow *tuple = cur_tuples_[i];
+      // join keys are already matched by inline keys of the bucket
+      const bool inline_key_matched = cur_hash_table_->inline_key_cnt_ > 0
+                                      && NULL != probe_inline_keys_[batch_idx];
       while (!matched && NULL != tuple && OB_SUCC(ret)) {
         ++hash_link_cnt_;
         ++hash_equal_cnt_;
         convert_exprs_batch_one(tuple, left_->get_spec().output_);
         matched = true;
-        FOREACH_CNT_X(e, MY_SPEC.equal_join_conds_, matched) {
+        FOREACH_CNT_X(e, MY_SPEC.equal_join_conds_, matched && !inline_key_matched) {
           // we check children's output_ are consistant with join key in cg,
           // so we can locate datums without eval again
           ObDatum &l = (*e)->args_[0]->locate_batch_datums(eval_ctx_)[batch_idx];
@@ -4916,6 +4994,34 @@ int ObHashJoinOp::read_hashrow_batch()
   return ret;
 }
 
+// Decide the key match of right rows by the inline keys of the probed bucket. Rows of buckets
+// with the same keys skip the compare of equal conditions, rows of buckets with mixed or null
+// keys fall back to compare the stored rows. Buckets are matched by the full hash value, so
+// a uniform bucket with different keys (dropped here) only happens on hash collision.
+void ObHashJoinOp::filter_by_inline_keys()
+{
+  const int64_t key_cnt = cur_hash_table_->inline_key_cnt_;
+  int64_t right_keys[MAX_INLINE_KEY_CNT];
+  int64_t idx = 0;
+  for (int64_t i = 0; i < right_selector_cnt_; i++) {
+    const int64_t batch_idx = right_selector_[i];
+    const HTInlineKey *&inline_key = probe_inline_keys_[batch_idx];
+    bool keys_valid = inline_key->uniform_;
+    for (int64_t j = 0; keys_valid && j < key_cnt; ++j) {
+      keys_valid = get_inline_key(right_join_keys_.at(j)->locate_batch_datums(eval_ctx_)[batch_idx],
+                                  right_keys[j]);
+    }
+    if (!keys_valid) {
+      inline_key = NULL;
+    } else if (!inline_key->equal(right_keys, key_cnt)) {
+      continue;
+    }
+    cur_tuples_[idx] = cur_tuples_[i];
+    right_selector_[idx++] = batch_idx;
+  }
+  right_selector_cnt_ = idx;
+}
+
 int ObHashJoinOp::read_hashrow_normal()
 {
   int ret = OB_SUCCESS;
@@ -381,6 +381,24 @@ private:
     TO_STRING_KV(K_(hash_value), K_(stored_row), K_(used));
   };
 
+  static const int64_t MAX_INLINE_KEY_CNT = 2;
+  // Fixed width join keys of the bucket, kept in an array parallel to the buckets so that
+  // probe can accept or reject a bucket without touching the stored rows.
+  struct HTInlineKey
+  {
+    // keep trivial constructor make ObSegmentArray use memset to construct arrays.
+    HTInlineKey() = default;
+    int64_t keys_[MAX_INLINE_KEY_CNT];
+    // all stored rows linked in the bucket have the same keys_
+    uint64_t uniform_;
+
+    OB_INLINE bool equal(const int64_t *keys, const int64_t key_cnt) const
+    {
+      return keys_[0] == keys[0] && (1 == key_cnt || keys_[1] == keys[1]);
+    }
+    TO_STRING_KV(K_(uniform), "key0", keys_[0], "key1", keys_[1]);
+  };
+
   // Open addressing hash table implement:
   //
   //   buckets:
@@ -401,6 +419,8 @@ private:
   {
     PartHashJoinTable()
         : buckets_(nullptr),
+          inline_keys_(nullptr),
+          inline_key_cnt_(0),
           nbuckets_(0),
           row_count_(0),
           collisions_(0),
@@ -461,6 +481,34 @@ private:
       }
     }
 
+    // Same as get(), also return inline keys of the bucket.
+    inline ObHashJoinStoredJoinRow *get(const uint64_t hash_val, const HTInlineKey *&inline_key)
+    {
+      HTBucket tmp_bucket;
+      tmp_bucket.hash_value_ = hash_val;
+      uint64_t mask = nbuckets_ - 1;
+      uint64_t pos = tmp_bucket.hash_value_ & mask;
+      ObHashJoinStoredJoinRow *sr = NULL;
+      HTBucket *bucket = &buckets_->at(pos);
+      inline_key = NULL;
+      if (bucket->used_) {
+        do {
+          if (bucket->hash_value_ == tmp_bucket.hash_value_) {
+            sr = bucket->get_stored_row();
+            inline_key = &inline_keys_->at(pos);
+            break;
+          }
+          ++bucket;
+          ++pos;
+          if (OB_UNLIKELY(pos == ((pos >> bit_cnt_) << bit_cnt_) || pos == nbuckets_)) {
+            pos = (pos & mask);
+            bucket = &buckets_->at(pos);
+          }
+        } while (bucket->used_);
+      }
+      return sr;
+    }
+
     // performance critical, do not double check the parameters
     void set(const uint64_t hash_val, ObHashJoinStoredJoinRow *sr)
     {
@@ -487,6 +535,43 @@ private:
       }
     }
 
+    // set() and maintain the inline keys of the bucket,
+    // %keys_valid is false if the row has null or not fixed width keys.
+    void set(const uint64_t hash_val, ObHashJoinStoredJoinRow *sr,
+             const int64_t *keys, const bool keys_valid)
+    {
+      HTBucket tmp_bucket;
+      tmp_bucket.hash_value_ = hash_val;
+      uint64_t mask = nbuckets_ - 1;
+      uint64_t pos = tmp_bucket.hash_value_ & mask;
+      for (int64_t i = 0; i < nbuckets_; i += 1, pos = ((pos + 1) & mask)) {
+        HTBucket &bucket = buckets_->at(pos);
+        if (bucket.hash_value_ == tmp_bucket.hash_value_) {
+          HTInlineKey &inline_key = inline_keys_->at(pos);
+          if (inline_key.uniform_ && (!keys_valid || !inline_key.equal(keys, inline_key_cnt_))) {
+            inline_key.uniform_ = false;
+          }
+          sr->set_next(bucket.get_stored_row());
+          bucket.set_stored_row(sr);
+          bucket.used_ = true;
+          break;
+        } else if (!bucket.used_) {
+          HTInlineKey &inline_key = inline_keys_->at(pos);
+          used_buckets_ += 1;
+          bucket.hash_value_ = tmp_bucket.hash_value_;
+          bucket.set_stored_row(sr);
+          bucket.used_ = true;
+          sr->set_next(NULL);
+          if (keys_valid) {
+            MEMCPY(inline_key.keys_, keys, sizeof(int64_t) * inline_key_cnt_);
+          }
+          inline_key.uniform_ = keys_valid;
+          break;
+        }
+        collisions_ += 1;
+      }
+    }
+
     // lock-free hash table
     inline void atomic_set(const uint64_t hash_val, ObHashJoinStoredJoinRow *sr,
       int64_t used_buckets, int64_t collisions)
@@ -574,11 +659,15 @@ private:
       if (OB_NOT_NULL(buckets_)) {
         buckets_->reset();
       }
+      if (OB_NOT_NULL(inline_keys_)) {
+        inline_keys_->reset();
+      }
       nbuckets_ = 0;
       collisions_ = 0;
       used_buckets_ = 0;
     }
     int init(ObIAllocator &alloc);
+    int init_buckets();
     void free(ObIAllocator *alloc)
     {
       reset();
@@ -587,6 +676,11 @@ private:
         alloc->free(buckets_);
         buckets_ = nullptr;
       }
+      if (OB_NOT_NULL(inline_keys_)) {
+        inline_keys_->destroy();
+        alloc->free(inline_keys_);
+        inline_keys_ = nullptr;
+      }
       if (OB_NOT_NULL(ht_alloc_)) {
         ht_alloc_->reset();
         ht_alloc_->~ModulePageAllocator();
@@ -597,9 +691,14 @@ private:
     }
     using BucketArray =
       common::ObSegmentArray<HTBucket, OB_MALLOC_MIDDLE_BLOCK_SIZE, common::ModulePageAllocator>;
+    using InlineKeyArray =
+      common::ObSegmentArray<HTInlineKey, OB_MALLOC_MIDDLE_BLOCK_SIZE, common::ModulePageAllocator>;
 
     static const int64_t MAGIC_CODE = 0x123654abcd134;
     BucketArray *buckets_;
+    InlineKeyArray *inline_keys_;
+    // 0 if inline keys are disabled
+    int64_t inline_key_cnt_;
     int64_t nbuckets_;
     int64_t bit_cnt_;
     int64_t row_count_;
@@ -838,6 +937,34 @@ private:
   int other_join_read_hashrow_func_end();
 
   int set_hash_function(int8_t hash_join_hasher);
+  void init_inline_keys();
+  static OB_INLINE bool get_inline_key(const ObDatum &datum, int64_t &key)
+  {
+    bool valid = !datum.is_null();
+    if (!valid) {
+    } else if (sizeof(int64_t) == datum.len_) {
+      key = datum.get_int();
+    } else if (sizeof(int32_t) == datum.len_) {
+      key = datum.get_int32();
+    } else {
+      valid = false;
+    }
+    return valid;
+  }
+  OB_INLINE void set_hash_table_row(PartHashJoinTable &hash_table, ObHashJoinStoredJoinRow *sr)
+  {
+    if (hash_table.inline_key_cnt_ > 0) {
+      int64_t keys[MAX_INLINE_KEY_CNT];
+      bool keys_valid = true;
+      for (int64_t i = 0; keys_valid && i < hash_table.inline_key_cnt_; ++i) {
+        keys_valid = get_inline_key(sr->cells()[inline_key_left_idx_[i]], keys[i]);
+      }
+      hash_table.set(sr->get_hash_value(), sr, keys, keys_valid);
+    } else {
+      hash_table.set(sr->get_hash_value(), sr);
+    }
+  }
+  void filter_by_inline_keys();
 
   int next();
   int join_end_operate();
@@ -1038,7 +1165,8 @@ private:
   {
     int64_t bucket_cnt = profile_.get_bucket_size();
     const int64_t DEFAULT_EXTRA_SIZE = 2 * 1024 * 1024;
-    int64_t res = bucket_cnt * (sizeof(HTBucket));
+    int64_t res = bucket_cnt * (sizeof(HTBucket)
+                                + (hash_table_.inline_key_cnt_ > 0 ? sizeof(HTInlineKey) : 0));
     return  res < 0 ? DEFAULT_EXTRA_SIZE : res;
   }
 
@@ -1242,6 +1370,11 @@ private:
   bool right_read_from_stored_;
   uint64_t *right_hash_vals_;
   ObHashJoinStoredJoinRow **cur_tuples_;
+  // inline keys of probed bucket indexed by batch idx, not null if all stored rows of the
+  // bucket have the same join keys as the right row.
+  const HTInlineKey **probe_inline_keys_;
+  // offset of left join keys in stored row, valid if hash_table_.inline_key_cnt_ > 0
+  int64_t inline_key_left_idx_[MAX_INLINE_KEY_CNT];
   int64_t right_batch_traverse_cnt_;
   ObBatchRows child_brs_; // used for get_next_batch from datum store
   ObHashJoinStoredJoinRow **hj_part_added_rows_;
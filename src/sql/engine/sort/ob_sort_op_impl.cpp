@@ -406,13 +406,16 @@ bool ObSortOpImpl::Compare::operator()(
     LOG_WARN("not init or invalid argument", K(ret), KP(l), KP(r));
   } else if (OB_FAIL(fast_check_status())) {
     LOG_WARN("fast check failed", K(ret));
-  } else if (enable_encode_sortkey_) {
+  } else if (enable_encode_sortkey_
+             && !l->cells()[0].is_null() && !r->cells()[0].is_null()) {
     const ObDatum l_cell = l->cells()[0];
     const ObDatum r_cell = r->cells()[0];
     int cmp = 0;
     cmp = MEMCMP(l_cell.ptr_, r_cell.ptr_, min(l_cell.len_, r_cell.len_));
     less = cmp != 0 ? (cmp < 0) : (l_cell.len_ - r_cell.len_) < 0;
   } else {
+    // sort key is too long to encode (null encoded key), compare by the original columns,
+    // which gives the same order as the encoded keys.
     const ObDatum *lcells = l->cells();
     const ObDatum *rcells = r->cells();
     int cmp = 0;
@@ -1365,8 +1368,6 @@ int ObSortOpImpl::do_partition_sort(common::ObIArray<ObChunkDatumStore::StoredRo
           } else if (can_encode) {
             aqs.sort(rows_last, rows_idx);
           } else {
-            enable_encode_sortkey_ = false;
-            comp_.enable_encode_sortkey_ = false;
             std::sort(&rows.at(0) + rows_last, &rows.at(0) + rows_idx, CopyableComparer(comp_));
           }
         } else {
@@ -1662,8 +1663,8 @@ int ObSortOpImpl::sort_inmem_data()
         } else if (can_encode) {
           aqs.sort(begin, rows_->count());
         } else {
-          enable_encode_sortkey_ = false;
-          comp_.enable_encode_sortkey_ = false;
+          // rows with encoded keys are still compared by memcmp, only the others are
+          // compared column by column, keep encoding enabled for the following chunks.
           std::sort(&rows_->at(begin), &rows_->at(0) + rows_->count(), CopyableComparer(comp_));
         }
       } else {
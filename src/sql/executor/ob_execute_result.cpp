@@ -85,6 +85,38 @@ int ObExecuteResult::get_next_row(ObExecContext &ctx, const common::ObNewRow *&r
   return ret;
 }
 
+ObOperator *ObExecuteResult::get_vectorized_root(ObExecContext &ctx) const
+{
+  ObOperator *root = NULL;
+  ObPhysicalPlanCtx *plan_ctx = ctx.get_physical_plan_ctx();
+  // bind array of DML returning switches iterator in get_next_row(), and rows may
+  // already be fetched from the batch by get_next_row()
+  if (NULL != static_engine_root_
+      && static_engine_root_->get_spec().is_vectorized()
+      && NULL != plan_ctx
+      && plan_ctx->get_bind_array_count() <= 0
+      && NULL == br_it_.get_brs()) {
+    root = static_engine_root_;
+  }
+  return root;
+}
+
+int ObExecuteResult::get_next_batch(ObExecContext &ctx, const int64_t max_row_cnt,
+                                    const ObBatchRows *&brs)
+{
+  int ret = OB_SUCCESS;
+  UNUSED(ctx);
+  if (OB_ISNULL(static_engine_root_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret), KP(static_engine_root_));
+  } else if (OB_FAIL(static_engine_root_->get_next_batch(max_row_cnt, brs))) {
+    if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+      LOG_WARN("get next batch from operator failed", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObExecuteResult::close(ObExecContext &ctx)
 {
   int ret = OB_SUCCESS;
@@ -34,6 +34,20 @@ public:
   virtual int open(ObExecContext &ctx) = 0;
   virtual int get_next_row(ObExecContext &ctx, const common::ObNewRow *&row) = 0;
   virtual int close(ObExecContext &ctx) = 0;
+  // batch interface, only supported when the root operator is vectorized
+  virtual ObOperator *get_vectorized_root(ObExecContext &ctx) const
+  {
+    UNUSED(ctx);
+    return NULL;
+  }
+  virtual int get_next_batch(ObExecContext &ctx, const int64_t max_row_cnt,
+                             const ObBatchRows *&brs)
+  {
+    UNUSED(ctx);
+    UNUSED(max_row_cnt);
+    UNUSED(brs);
+    return common::OB_NOT_SUPPORTED;
+  }
 };
 
 class ObExecuteResult : public ObIExecuteResult
@@ -49,6 +63,11 @@ public:
   virtual int open(ObExecContext &ctx) override;
   virtual int get_next_row(ObExecContext &ctx, const common::ObNewRow *&row) override;
   virtual int close(ObExecContext &ctx) override;
+  // Return the root operator if the result can be fetched by get_next_batch(), rows
+  // should not be fetched by get_next_row() after get_next_batch() is called.
+  virtual ObOperator *get_vectorized_root(ObExecContext &ctx) const override;
+  virtual int get_next_batch(ObExecContext &ctx, const int64_t max_row_cnt,
+                             const ObBatchRows *&brs) override;
 
   inline int get_err_code() { return err_code_; }
 
@@ -117,6 +117,12 @@ public:
   /// get the next result row
   /// @return OB_ITER_END when no more data available
   int get_next_row(const common::ObNewRow *&row);
+  /// the root operator if rows can be fetched by get_next_batch(), NULL otherwise
+  ObOperator *get_vectorized_root();
+  /// get the next batch of result rows, should not be mixed with get_next_row()
+  /// @note the batch may be empty or with all rows skipped, end of iteration is
+  ///       indicated by brs->end_
+  int get_next_batch(const int64_t max_row_cnt, const ObBatchRows *&brs);
   /// close the result set after get all the rows
   int close();
   /// get number of rows affected by INSERT/UPDATE/DELETE
@@ -71,6 +71,7 @@
 #include "sql/optimizer/ob_log_for_update.h"
 #include "sql/rewrite/ob_transform_utils.h"
 #include "sql/ob_optimizer_trace_impl.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
 
 using namespace oceanbase;
 using namespace sql;
@@ -7004,7 +7005,8 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
       LOG_WARN("get unexpected null", K(ret));
     } else if (T_FUN_COUNT != cur_aggr->get_expr_type()
                && T_FUN_MIN != cur_aggr->get_expr_type()
-               && T_FUN_MAX != cur_aggr->get_expr_type()) {
+               && T_FUN_MAX != cur_aggr->get_expr_type()
+               && T_FUN_SUM != cur_aggr->get_expr_type()) {
       can_push = false;
     } else if (cur_aggr->is_param_distinct() || 1 < cur_aggr->get_real_param_count()) {
       /* mysql mode, support count(distinct c1, c2). if this distinct can be eliminated,
@@ -7018,6 +7020,13 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
     } else if (!first_param->is_column_ref_expr() ||
                table_item->table_id_ != static_cast<ObColumnRefRawExpr*>(first_param)->get_table_id()) {
       can_push = false;
+    } else if (T_FUN_SUM == cur_aggr->get_expr_type()) {
+      // sum is pushed down for scalar group by only, and servers of lower version could
+      // not aggregate sum in storage
+      can_push = GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_1_0_1
+                 && ObPushdownFilterUtils::is_sum_pushdown_supported(
+                        first_param->get_type_class(),
+                        cur_aggr->get_result_type().get_type_class());
     }
   }
   return ret;
@@ -169,10 +169,21 @@ int ObFastParserBase::parse(const ObString &stmt,
 inline void ObFastParserBase::process_leading_space()
 {
   int64_t space_len = 0;
-  while (!raw_sql_.search_end_ && IS_MULTI_SPACE(raw_sql_.cur_pos_, space_len)) {
-    cur_token_type_ = NORMAL_TOKEN;
-    copy_end_pos_++;
-    raw_sql_.scan(space_len);
+  while (!raw_sql_.search_end_) {
+    int64_t space_end_pos = ObFastParserSimd::skip_spaces(raw_sql_.raw_sql_,
+                                                          raw_sql_.cur_pos_,
+                                                          raw_sql_.raw_sql_len_);
+    if (space_end_pos > raw_sql_.cur_pos_) {
+      cur_token_type_ = NORMAL_TOKEN;
+      copy_end_pos_ += space_end_pos - raw_sql_.cur_pos_;
+      raw_sql_.skip_to(space_end_pos);
+    } else if (IS_MULTI_SPACE(raw_sql_.cur_pos_, space_len)) {
+      cur_token_type_ = NORMAL_TOKEN;
+      copy_end_pos_++;
+      raw_sql_.scan(space_len);
+    } else {
+      break;
+    }
   }
 }
 
@@ -1446,10 +1457,9 @@ int ObFastParserBase::process_backtick()
 {
   int ret = OB_SUCCESS;
   cur_token_type_ = NORMAL_TOKEN;
-  char ch = raw_sql_.scan();
-  while (!raw_sql_.is_search_end() && '`' != ch) {
-    ch = raw_sql_.scan();
-  }
+  char ch = raw_sql_.skip_to(ObFastParserSimd::find_char(raw_sql_.raw_sql_,
+                                                          raw_sql_.cur_pos_ + 1,
+                                                          raw_sql_.raw_sql_len_, '`'));
   if ('`' != ch) {
     ret = OB_ERR_PARSER_SYNTAX;
     LOG_WARN("parser syntax error", K(ret), K(raw_sql_.to_string()), K_(raw_sql_.cur_pos));
@@ -1464,11 +1474,10 @@ int ObFastParserBase::process_backtick()
 int ObFastParserBase::process_double_quote()
 {
   int ret = OB_SUCCESS;
-  char ch = raw_sql_.scan();
+  char ch = raw_sql_.skip_to(ObFastParserSimd::find_char(raw_sql_.raw_sql_,
+                                                          raw_sql_.cur_pos_ + 1,
+                                                          raw_sql_.raw_sql_len_, '\"'));
   cur_token_type_ = NORMAL_TOKEN;
-  while (!raw_sql_.is_search_end() && '\"' != ch) {
-    ch = raw_sql_.scan();
-  }
   if ('\"' != ch) {
     ret = OB_ERR_PARSER_SYNTAX;
     LOG_WARN("parser syntax error", K(ret), K(raw_sql_.to_string()), K_(raw_sql_.cur_pos));
@@ -1484,17 +1493,17 @@ int ObFastParserBase::process_comment_content()
   int ret = OB_SUCCESS;
   cur_token_type_ = IGNORE_TOKEN;
   bool is_match = false;
-  char ch = raw_sql_.scan();
-  while (!raw_sql_.is_search_end()) {
-    if ('*' == ch && '/' == raw_sql_.peek()) {
-      // scan '\/'
-      raw_sql_.scan();
+  int64_t pos = raw_sql_.cur_pos_ + 1;
+  while (!is_match && pos < raw_sql_.raw_sql_len_) {
+    pos = ObFastParserSimd::find_char(raw_sql_.raw_sql_, pos, raw_sql_.raw_sql_len_, '*');
+    if ('/' == raw_sql_.char_at(pos + 1)) {
       is_match = true;
-      break;;
     } else {
-      ch = raw_sql_.scan();
+      ++pos;
     }
   }
+  // stop at '\/' if matched, otherwise at the end of the sql
+  raw_sql_.skip_to(is_match ? pos + 1 : raw_sql_.raw_sql_len_);
   if (!is_match) {
     ret = OB_ERR_PARSER_SYNTAX;
     LOG_WARN("parser syntax error", K(ret), K(raw_sql_.to_string()), K_(raw_sql_.cur_pos));
@@ -1737,9 +1746,9 @@ int ObFastParserBase::process_number(bool has_minus)
   bool need_parameterized = false;
   ObItemType param_type = T_INVALID;
   char ch = raw_sql_.char_at(raw_sql_.cur_pos_);
-  while (is_digit(ch)) {
+  if (is_digit(ch)) {
     is_digit_first = true;
-    ch = raw_sql_.scan();
+    ch = skip_digits();
   }
   bool is_double = false;
   bool has_dot = false;
@@ -1747,8 +1756,8 @@ int ObFastParserBase::process_number(bool has_minus)
     is_double = true;
     has_dot = true;
     ch = raw_sql_.scan();
-    while (is_digit(ch)) {
-      ch = raw_sql_.scan();
+    if (is_digit(ch)) {
+      ch = skip_digits();
     }
   }
   // If there is no digit, the content after the character 'e' does not need to be matched,
@@ -1761,9 +1770,9 @@ int ObFastParserBase::process_number(bool has_minus)
       has_flag_after_euler = true;
       ch = raw_sql_.scan();
     }
-    while (is_digit(ch)) {
+    if (is_digit(ch)) {
       has_digit_after_euler = true;
-      ch = raw_sql_.scan();
+      ch = skip_digits();
     }
     // no digit after euler
     if (!has_digit_after_euler) {
@@ -1930,8 +1939,11 @@ int ObFastParserMysql::process_string(const char quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end()) {
+        ch = raw_sql_.skip_to(ObFastParserSimd::find_char2(raw_sql_.raw_sql_,
+                                                           raw_sql_.cur_pos_,
+                                                           raw_sql_.raw_sql_len_,
+                                                           '\\', quote));
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2205,8 +2217,8 @@ int ObFastParserMysql::parse_next_token()
           cur_token_type_ = IGNORE_TOKEN;
           // skip the second '-' and space
           raw_sql_.scan(1 + space_len);
-          while (!raw_sql_.is_search_end() && is_non_newline(ch)) {
-            ch = raw_sql_.scan();
+          if (!raw_sql_.is_search_end()) {
+            ch = skip_non_newline(raw_sql_.cur_pos_ + 1);
           }
         } else {
           OZ (process_negative());
@@ -2216,10 +2228,7 @@ int ObFastParserMysql::parse_next_token()
       case '#': {
         // sql_comment: (#{non_newline}*)
         cur_token_type_ = IGNORE_TOKEN;
-        ch = raw_sql_.scan();
-        while (is_non_newline(ch)) {
-          ch = raw_sql_.scan();
-        }
+        ch = skip_non_newline(raw_sql_.cur_pos_ + 1);
         break;
       }
       case '/': {
@@ -2349,8 +2358,11 @@ int ObFastParserOracle::process_string(const bool in_q_quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end()) {
+        ch = raw_sql_.skip_to(ObFastParserSimd::find_char2(raw_sql_.raw_sql_,
+                                                           raw_sql_.cur_pos_,
+                                                           raw_sql_.raw_sql_len_,
+                                                           '\\', '\''));
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2623,10 +2635,7 @@ int ObFastParserOracle::parse_next_token()
         if ('-' == ch) {
           // "--"{non_newline}*
           cur_token_type_ = IGNORE_TOKEN;
-          ch = raw_sql_.scan();
-          while (!raw_sql_.is_search_end() && is_non_newline(ch)) {
-            ch = raw_sql_.scan();
-          }
+          ch = skip_non_newline(raw_sql_.cur_pos_ + 1);
         } else if (OB_FAIL(process_negative())) {
           LOG_WARN("failed to handle negative", K(ret));
         }
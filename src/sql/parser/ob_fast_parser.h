@@ -18,6 +18,7 @@
 #include "lib/charset/ob_charset.h"
 #include "sql/parser/ob_parser_utils.h"
 #include "sql/parser/ob_char_type.h"
+#include "sql/parser/ob_fast_parser_simd.h"
 #include "sql/parser/parse_malloc.h"
 #include "sql/udr/ob_udr_struct.h"
 
@@ -143,6 +144,18 @@ protected:
 			return raw_sql_[cur_pos_];
 		}
 		inline char scan() { return scan(1); }
+		// Move to pos which is found by ObFastParserSimd, same as scan() when pos is
+		// beyond the end of the sql
+		inline char skip_to(const int64_t pos)
+		{
+			if (pos >= raw_sql_len_) {
+				search_end_ = true;
+				cur_pos_ = raw_sql_len_;
+				return INVALID_CHAR;
+			}
+			cur_pos_ = pos;
+			return raw_sql_[cur_pos_];
+		}
 		inline char reverse_scan()
 		{
 			if (cur_pos_ <= 0 || cur_pos_ >= raw_sql_len_ + 1) {
@@ -277,6 +290,18 @@ protected:
 	{
 		return is_valid_char(ch) && '\n' != ch && '\r' != ch;
 	}
+	// scan to the first char from pos that is not is_non_newline
+	inline char skip_non_newline(const int64_t pos)
+	{
+		return raw_sql_.skip_to(ObFastParserSimd::find_char3(
+			raw_sql_.raw_sql_, pos, raw_sql_.raw_sql_len_, '\n', '\r', INVALID_CHAR));
+	}
+	// scan to the first char from cur_pos_ that is not is_digit
+	inline char skip_digits()
+	{
+		return raw_sql_.skip_to(ObFastParserSimd::skip_digits(
+			raw_sql_.raw_sql_, raw_sql_.cur_pos_, raw_sql_.raw_sql_len_));
+	}
 	// [0-9a-fA-F]
 	inline bool is_hex(char ch)
 	{
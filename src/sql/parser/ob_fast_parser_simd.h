@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PARSER_FAST_PARSER_SIMD_
+#define OCEANBASE_SQL_PARSER_FAST_PARSER_SIMD_
+
+#include <stdint.h>
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#define OB_FAST_PARSER_USE_SSE2
+#endif
+
+namespace oceanbase
+{
+namespace sql
+{
+// Block scanners used by the fast parser to skip over the long runs of string
+// literals, comments, digits and spaces. The parser is also linked into the proxy,
+// so only SSE2 is used, which is the baseline of x86_64 and needs neither special
+// compile flags nor cpu detection. Other platforms use the scalar loops.
+//
+// All functions search in [pos, end) and return end if nothing is found.
+struct ObFastParserSimd
+{
+  static const int64_t BLOCK_SIZE = 16;
+
+  // the first position of c1, c2 or c3
+  static inline int64_t find_char3(const char *str, int64_t pos, const int64_t end,
+                                   const char c1, const char c2, const char c3)
+  {
+#ifdef OB_FAST_PARSER_USE_SSE2
+    const __m128i v1 = _mm_set1_epi8(c1);
+    const __m128i v2 = _mm_set1_epi8(c2);
+    const __m128i v3 = _mm_set1_epi8(c3);
+    for (; pos + BLOCK_SIZE <= end; pos += BLOCK_SIZE) {
+      const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + pos));
+      const __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, v1),
+                                                   _mm_cmpeq_epi8(data, v2)),
+                                      _mm_cmpeq_epi8(data, v3));
+      const int mask = _mm_movemask_epi8(eq);
+      if (0 != mask) {
+        return pos + __builtin_ctz(mask);
+      }
+    }
+#endif
+    while (pos < end && c1 != str[pos] && c2 != str[pos] && c3 != str[pos]) {
+      ++pos;
+    }
+    return pos;
+  }
+  static inline int64_t find_char2(const char *str, const int64_t pos, const int64_t end,
+                                   const char c1, const char c2)
+  {
+    return find_char3(str, pos, end, c1, c2, c2);
+  }
+  static inline int64_t find_char(const char *str, const int64_t pos, const int64_t end,
+                                  const char c)
+  {
+    return find_char3(str, pos, end, c, c, c);
+  }
+  // the first position that is not in [0-9]
+  static inline int64_t skip_digits(const char *str, int64_t pos, const int64_t end)
+  {
+#ifdef OB_FAST_PARSER_USE_SSE2
+    // bytes >= 0x80 are negative in the signed compare and never match
+    const __m128i lower = _mm_set1_epi8('0' - 1);
+    const __m128i upper = _mm_set1_epi8('9' + 1);
+    for (; pos + BLOCK_SIZE <= end; pos += BLOCK_SIZE) {
+      const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + pos));
+      const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(data, lower),
+                                             _mm_cmplt_epi8(data, upper));
+      const int mask = _mm_movemask_epi8(is_digit);
+      if (0xFFFF != mask) {
+        return pos + __builtin_ctz(~mask);
+      }
+    }
+#endif
+    while (pos < end && str[pos] >= '0' && str[pos] <= '9') {
+      ++pos;
+    }
+    return pos;
+  }
+  // the first position that is not a single byte space, [ \t\n\v\f\r]
+  static inline int64_t skip_spaces(const char *str, int64_t pos, const int64_t end)
+  {
+#ifdef OB_FAST_PARSER_USE_SSE2
+    const __m128i blank = _mm_set1_epi8(' ');
+    const __m128i lower = _mm_set1_epi8('\t' - 1);
+    const __m128i upper = _mm_set1_epi8('\r' + 1);
+    for (; pos + BLOCK_SIZE <= end; pos += BLOCK_SIZE) {
+      const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + pos));
+      const __m128i is_space = _mm_or_si128(_mm_cmpeq_epi8(data, blank),
+                                            _mm_and_si128(_mm_cmpgt_epi8(data, lower),
+                                                          _mm_cmplt_epi8(data, upper)));
+      const int mask = _mm_movemask_epi8(is_space);
+      if (0xFFFF != mask) {
+        return pos + __builtin_ctz(~mask);
+      }
+    }
+#endif
+    while (pos < end && (' ' == str[pos] || (str[pos] >= '\t' && str[pos] <= '\r'))) {
+      ++pos;
+    }
+    return pos;
+  }
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_SQL_PARSER_FAST_PARSER_SIMD_ */
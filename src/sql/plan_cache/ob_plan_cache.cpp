@@ -305,7 +305,8 @@ ObPlanCache::ObPlanCache()
    ref_handle_mgr_(),
    pcm_(NULL),
    destroy_(0),
-   tg_id_(-1)
+   tg_id_(-1),
+   warmup_tg_id_(-1)
 {
 }
 
@@ -319,6 +320,10 @@ void ObPlanCache::destroy()
   observer::ObReqTimeGuard req_timeinfo_guard;
   if (inited_) {
     TG_DESTROY(tg_id_);
+    if (-1 != warmup_tg_id_) {
+      TG_DESTROY(warmup_tg_id_);
+      warmup_tg_id_ = -1;
+    }
     if (OB_SUCCESS != (cache_evict_all_obj())) {
       SQL_PC_LOG_RET(WARN, OB_ERROR, "fail to evict all lib cache cache");
     }
@@ -326,6 +331,15 @@ void ObPlanCache::destroy()
   }
 }
 
+// called by the evict task, the warmup timer can not be destroyed by its own task
+void ObPlanCache::destroy_warmup_timer()
+{
+  if (-1 != warmup_tg_id_ && warmup_task_.is_finished()) {
+    TG_DESTROY(warmup_tg_id_);
+    warmup_tg_id_ = -1;
+  }
+}
+
 int ObPlanCache::init(int64_t hash_bucket, uint64_t tenant_id)
 {
   int ret = OB_SUCCESS;
@@ -348,6 +362,7 @@ int ObPlanCache::init(int64_t hash_bucket, uint64_t tenant_id)
       LOG_WARN("fail to set plan cache memory conf", K(ret));
     } else {
       evict_task_.plan_cache_ = this;
+      evict_task_.last_snapshot_ts_ = ObTimeUtility::current_time();
       cn_factory_.set_lib_cache(this);
       ObMemAttr attr = get_mem_attr();
       attr.tenant_id_ = tenant_id;
@@ -357,6 +372,20 @@ int ObPlanCache::init(int64_t hash_bucket, uint64_t tenant_id)
       tenant_id_ = tenant_id;
       ref_handle_mgr_.set_tenant_id(tenant_id_);
       inited_ = true;
+      // warm up is best effort, the plan cache works without it
+      int tmp_ret = OB_SUCCESS;
+      if (0 == GCONF._ob_plan_cache_snapshot_interval) {
+        warmup_task_.set_finished();
+      } else if (OB_TMP_FAIL(TG_CREATE_TENANT(lib::TGDefIDs::PlanCacheWarmup, warmup_tg_id_))) {
+        LOG_WARN("failed to create warmup tg", K(tmp_ret));
+      } else if (OB_TMP_FAIL(TG_START(warmup_tg_id_))) {
+        LOG_WARN("failed to start warmup tg", K(tmp_ret));
+      } else if (OB_TMP_FAIL(warmup_task_.init(this, warmup_tg_id_))) {
+        LOG_WARN("failed to init plan cache warmup task", K(tmp_ret));
+      }
+      if (OB_SUCCESS != tmp_ret) {
+        warmup_task_.set_finished();
+      }
     }
   }
   return ret;
@@ -1849,6 +1878,12 @@ void ObPlanCache::mtl_stop(ObPlanCache * &plan_cache)
   if (OB_LIKELY(nullptr != plan_cache)) {
     TG_CANCEL(plan_cache->tg_id_, plan_cache->evict_task_);
     TG_STOP(plan_cache->tg_id_);
+    // the evict task may destroy the warmup timer
+    TG_WAIT(plan_cache->tg_id_);
+    if (-1 != plan_cache->warmup_tg_id_) {
+      TG_CANCEL(plan_cache->warmup_tg_id_, plan_cache->warmup_task_);
+      TG_STOP(plan_cache->warmup_tg_id_);
+    }
   }
 }
 
@@ -2028,6 +2063,8 @@ void ObPlanCacheEliminationTask::runTimerTask()
     observer::ObReqTimeGuard req_timeinfo_guard;
     run_free_cache_obj_task();
   }
+  run_snapshot_task();
+  plan_cache_->destroy_warmup_timer();
   SQL_PC_LOG(INFO, "schedule next cache evict task",
              "evict_interval", (int64_t)(GCONF.plan_cache_evict_interval));
 }
@@ -2044,6 +2081,25 @@ void ObPlanCacheEliminationTask::run_plan_cache_task()
   }
 }
 
+void ObPlanCacheEliminationTask::run_snapshot_task()
+{
+  int ret = OB_SUCCESS;
+  const int64_t snapshot_interval = GCONF._ob_plan_cache_snapshot_interval;
+  const int64_t now = ObTimeUtility::current_time();
+  // do not overwrite the snapshot before it is used to warm up
+  if (0 == snapshot_interval
+      || now - last_snapshot_ts_ < snapshot_interval
+      || !plan_cache_->warmup_task_.is_finished()) {
+    // do nothing
+  } else {
+    observer::ObReqTimeGuard req_timeinfo_guard;
+    last_snapshot_ts_ = now;
+    if (OB_FAIL(ObPlanCacheSnapshot::dump(*plan_cache_))) {
+      SQL_PC_LOG(WARN, "failed to dump plan cache snapshot", K(ret));
+    }
+  }
+}
+
 void ObPlanCacheEliminationTask::run_free_cache_obj_task()
 {
   int ret = OB_SUCCESS;
@@ -24,6 +24,7 @@
 #include "sql/plan_cache/ob_lib_cache_key_creator.h"
 #include "sql/plan_cache/ob_lib_cache_node_factory.h"
 #include "sql/plan_cache/ob_lib_cache_object_manager.h"
+#include "sql/plan_cache/ob_plan_cache_snapshot.h"
 namespace oceanbase
 {
 namespace rpc
@@ -197,7 +198,8 @@ class ObPlanCacheEliminationTask : public common::ObTimerTask
 {
 public:
   ObPlanCacheEliminationTask() : plan_cache_(NULL),
-                            run_task_counter_(0)
+                            run_task_counter_(0),
+                            last_snapshot_ts_(0)
   {
   }
   void runTimerTask(void);
@@ -205,15 +207,18 @@ private:
   void run_plan_cache_task();
   //void run_ps_cache_task();
   void run_free_cache_obj_task();
+  void run_snapshot_task();
 public:
   ObPlanCache* plan_cache_;
   int64_t run_task_counter_;
+  int64_t last_snapshot_ts_;
 };
 
 class ObPlanCache
 {
 friend class ObCacheObjectFactory;
 friend class ObPlanCacheEliminationTask;
+friend class ObPlanCacheWarmupTask;
 
 public:
   static const int64_t MAX_PLAN_SIZE = 20*1024*1024; //20M
@@ -329,6 +334,8 @@ public:
   template<typename CallBack = ObKVEntryTraverseOp>
   int foreach_cache_evict(CallBack &cb);
   void destroy();
+  // release the warmup timer thread once warmup is done
+  void destroy_warmup_timer();
   common::ObAddr &get_host() { return host_; }
   void set_host(common::ObAddr &addr) { host_ = addr; }
   int64_t get_tenant_id() const { return tenant_id_; }
@@ -444,7 +451,10 @@ private:
   ObLCNodeFactory cn_factory_;
   CacheKeyNodeMap cache_key_node_map_;
   ObPlanCacheEliminationTask evict_task_;
+  ObPlanCacheWarmupTask warmup_task_;
   int tg_id_;
+  // warmup compiles sqls, which must not delay the evict task on tg_id_
+  int warmup_tg_id_;
 };
 
 template<typename _callback>
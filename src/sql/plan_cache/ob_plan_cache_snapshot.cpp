@@ -0,0 +1,770 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+#include "sql/plan_cache/ob_plan_cache_snapshot.h"
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/file/ob_file.h"
+#include "lib/thread/thread_mgr.h"
+#include "share/config/ob_server_config.h"
+#include "share/ob_get_compat_mode.h"
+#include "share/schema/ob_multi_version_schema_service.h"
+#include "share/schema/ob_schema_getter_guard.h"
+#include "observer/ob_req_time_service.h"
+#include "observer/ob_server_struct.h"
+#include "sql/ob_sql.h"
+#include "sql/ob_result_set.h"
+#include "sql/engine/ob_physical_plan.h"
+#include "sql/plan_cache/ob_plan_cache.h"
+#include "sql/session/ob_sql_session_info.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share::schema;
+namespace sql
+{
+
+OB_SERIALIZE_MEMBER(ObPlanCacheSnapshotItem,
+                    db_id_,
+                    sql_cs_type_,
+                    constructed_sql_,
+                    param_infos_,
+                    sys_vars_str_,
+                    config_str_,
+                    outline_data_,
+                    hints_info_,
+                    hit_count_,
+                    execute_times_,
+                    elapsed_time_,
+                    last_active_time_);
+
+OB_SERIALIZE_MEMBER(ObPlanCacheSnapshotHeader,
+                    magic_,
+                    item_cnt_,
+                    data_len_,
+                    data_checksum_);
+
+int ObPlanCacheSnapshotItem::assign(const ObPlanStat &stat, ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ob_write_string(allocator, stat.constructed_sql_, constructed_sql_))) {
+    LOG_WARN("failed to write constructed sql", K(ret));
+  } else if (OB_FAIL(ob_write_string(allocator, stat.param_infos_, param_infos_))) {
+    LOG_WARN("failed to write param infos", K(ret));
+  } else if (OB_FAIL(ob_write_string(allocator, stat.sys_vars_str_, sys_vars_str_))) {
+    LOG_WARN("failed to write sys vars str", K(ret));
+  } else if (OB_FAIL(ob_write_string(allocator, stat.config_str_, config_str_))) {
+    LOG_WARN("failed to write config str", K(ret));
+  } else if (OB_FAIL(ob_write_string(allocator, stat.outline_data_, outline_data_))) {
+    LOG_WARN("failed to write outline data", K(ret));
+  } else if (OB_FAIL(ob_write_string(allocator, stat.hints_info_, hints_info_))) {
+    LOG_WARN("failed to write hints info", K(ret));
+  } else {
+    db_id_ = stat.db_id_;
+    sql_cs_type_ = stat.sql_cs_type_;
+    hit_count_ = stat.hit_count_;
+    execute_times_ = stat.execute_times_;
+    elapsed_time_ = stat.elapsed_time_;
+    last_active_time_ = stat.last_active_time_;
+  }
+  return ret;
+}
+
+namespace
+{
+struct SnapshotParamInfo
+{
+  SnapshotParamInfo() : need_check_bool_(0), expected_bool_(0), scale_(0), type_(0) {}
+  TO_STRING_KV(K_(need_check_bool), K_(expected_bool), K_(scale), K_(type));
+
+  int need_check_bool_;
+  int expected_bool_;
+  int scale_;
+  int type_;
+};
+
+int parse_param_infos(const ObString &param_infos,
+                      ObIAllocator &allocator,
+                      ObIArray<SnapshotParamInfo> &params)
+{
+  int ret = OB_SUCCESS;
+  char *buf = NULL;
+  if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(param_infos.length() + 1)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc param infos buffer", K(ret), K(param_infos));
+  } else {
+    MEMCPY(buf, param_infos.ptr(), param_infos.length());
+    buf[param_infos.length()] = '\0';
+  }
+  const char *pos = buf;
+  while (OB_SUCC(ret) && NULL != pos && '\0' != *pos) {
+    SnapshotParamInfo param;
+    int need_check_type = 0;
+    int len = 0;
+    if (5 != sscanf(pos, "{%d,%d,%d,%d,%d}%n", &need_check_type, &param.need_check_bool_,
+                    &param.expected_bool_, &param.scale_, &param.type_, &len)
+        || 0 == len) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid param infos", K(ret), K(param_infos));
+    } else if (OB_FAIL(params.push_back(param))) {
+      LOG_WARN("failed to push back param info", K(ret));
+    } else {
+      pos += len;
+      pos += (',' == *pos) ? 1 : 0;
+    }
+  }
+  return ret;
+}
+
+// a literal which is resolved to the same type as the parameter, the value itself does not
+// matter except for the parameters whose bool value is checked by the plan cache.
+int print_param_literal(const SnapshotParamInfo &param, char *buf, const int64_t buf_len,
+                        int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  const char *bool_str = param.need_check_bool_ && !param.expected_bool_ ? "0" : "1";
+  switch (static_cast<ObObjType>(param.type_)) {
+    case ObNullType:
+      ret = databuff_printf(buf, buf_len, pos, "NULL");
+      break;
+    case ObIntType:
+      ret = databuff_printf(buf, buf_len, pos, "%s", bool_str);
+      break;
+    case ObUInt64Type:
+      ret = databuff_printf(buf, buf_len, pos, "%lu", UINT64_MAX);
+      break;
+    case ObDoubleType:
+      ret = databuff_printf(buf, buf_len, pos, "%se0", bool_str);
+      break;
+    case ObNumberType: {
+      // the scale of a decimal literal is the count of digits after the point
+      const int64_t scale = std::min(std::max(param.scale_, 0), 20);
+      ret = databuff_printf(buf, buf_len, pos, "%s.", bool_str);
+      for (int64_t i = 0; OB_SUCC(ret) && i < scale; i++) {
+        ret = databuff_printf(buf, buf_len, pos, "0");
+      }
+      break;
+    }
+    case ObDateTimeType:
+      ret = databuff_printf(buf, buf_len, pos, "TIMESTAMP '2000-01-01 00:00:00'");
+      break;
+    case ObDateType:
+      ret = databuff_printf(buf, buf_len, pos, "DATE '2000-01-01'");
+      break;
+    case ObTimeType:
+      ret = databuff_printf(buf, buf_len, pos, "TIME '00:00:00'");
+      break;
+    case ObVarcharType:
+    case ObCharType:
+      ret = databuff_printf(buf, buf_len, pos, "'%s'", bool_str);
+      break;
+    case ObHexStringType:
+      ret = databuff_printf(buf, buf_len, pos, "X'31'");
+      break;
+    default:
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("no literal for param type", K(ret), K(param));
+      break;
+  }
+  return ret;
+}
+}
+
+int ObPlanCacheSnapshotItem::build_sql(ObIAllocator &allocator, ObString &sql) const
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<SnapshotParamInfo, 16> params;
+  char *buf = NULL;
+  int64_t buf_len = 0;
+  int64_t pos = 0;
+  int64_t param_idx = 0;
+  if (OB_FAIL(parse_param_infos(param_infos_, allocator, params))) {
+    LOG_WARN("failed to parse param infos", K(ret), KPC(this));
+  } else if (FALSE_IT(buf_len = constructed_sql_.length()
+                                + params.count() * MAX_PARAM_LITERAL_LEN + 1)) {
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(buf_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc sql buffer", K(ret), K(buf_len));
+  }
+  // '?' in quoted strings, identifiers and comments are not parameters
+  const char *str = constructed_sql_.ptr();
+  const int64_t len = constructed_sql_.length();
+  char quote = '\0';
+  int64_t comment_end = -1;
+  for (int64_t i = 0; OB_SUCC(ret) && i < len; i++) {
+    const char c = str[i];
+    if (i < comment_end) {
+      buf[pos++] = c;
+    } else if ('\0' != quote) {
+      buf[pos++] = c;
+      if ('\\' == c && '`' != quote && i + 1 < len) {
+        buf[pos++] = str[++i];
+      } else if (quote == c) {
+        quote = '\0';
+      }
+    } else if ('\'' == c || '"' == c || '`' == c) {
+      buf[pos++] = c;
+      quote = c;
+    } else if ('/' == c && i + 1 < len && '*' == str[i + 1]) {
+      const char *end = static_cast<const char *>(memmem(str + i + 2, len - i - 2, "*/", 2));
+      comment_end = NULL == end ? len : end - str + 2;
+      buf[pos++] = c;
+    } else if ('?' != c) {
+      buf[pos++] = c;
+    } else if (param_idx >= params.count()) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("more parameters than param infos", K(ret), KPC(this));
+    } else if (OB_FAIL(print_param_literal(params.at(param_idx++), buf, buf_len, pos))) {
+      LOG_TRACE("failed to print param literal", K(ret), KPC(this));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (param_idx != params.count()) {
+    // some parameters are restored as text in constructed sql, e.g. order by 1
+    ret = OB_NOT_SUPPORTED;
+    LOG_TRACE("parameters do not match param infos", K(ret), K(param_idx), KPC(this));
+  } else {
+    sql.assign_ptr(buf, static_cast<int32_t>(pos));
+  }
+  return ret;
+}
+
+namespace
+{
+struct HotPlan
+{
+  HotPlan() : hit_count_(0), plan_id_(OB_INVALID_ID) {}
+  HotPlan(const uint64_t hit_count, const uint64_t plan_id)
+    : hit_count_(hit_count), plan_id_(plan_id) {}
+  bool operator<(const HotPlan &other) const { return hit_count_ > other.hit_count_; }
+  TO_STRING_KV(K_(hit_count), K_(plan_id));
+
+  uint64_t hit_count_;
+  uint64_t plan_id_;
+};
+
+// plans of prepared statements, temporary tables and internal sqls can not be
+// recompiled from the sql text or are not worth to.
+bool need_snapshot(const ObPhysicalPlan &plan)
+{
+  const ObPlanStat &stat = plan.stat_;
+  return ObStmt::is_dml_stmt(plan.get_stmt_type())
+         && !plan.contains_temp_table()
+         && !plan.is_contain_oracle_session_level_temporary_table()
+         && !plan.is_contain_oracle_trx_level_temporary_table()
+         && OB_INVALID_ID == static_cast<uint64_t>(stat.ps_stmt_id_)
+         && !stat.constructed_sql_.empty()
+         && !stat.param_infos_.empty()
+         && !is_oceanbase_sys_database_id(stat.db_id_)
+         && !is_information_schema_database_id(stat.db_id_)
+         && !is_mysql_database_id(stat.db_id_);
+}
+}
+
+int ObPlanCacheSnapshot::get_file_path(const uint64_t tenant_id, char *buf, const int64_t buf_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (OB_FAIL(databuff_printf(buf, buf_len, pos, "%s/plan_cache/tenant_%lu.snapshot",
+                              GCONF.data_dir.str(), tenant_id))) {
+    LOG_WARN("failed to print snapshot file path", K(ret), K(tenant_id));
+  }
+  return ret;
+}
+
+int ObPlanCacheSnapshot::collect_hot_plans(ObPlanCache &plan_cache,
+                                           ObIAllocator &allocator,
+                                           ObIArray<ObPlanCacheSnapshotItem> &items)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<uint64_t, 1024> plan_ids;
+  ObArray<HotPlan> hot_plans;
+  ObGetAllCacheIdOp get_ids_op(&plan_ids);
+  if (OB_FAIL(plan_cache.foreach_cache_obj(get_ids_op))) {
+    LOG_WARN("failed to get all cache obj ids", K(ret));
+  }
+  // take hit counts first, only the hottest plans are copied.
+  for (int64_t i = 0; OB_SUCC(ret) && i < plan_ids.count(); i++) {
+    ObCacheObjGuard guard(PC_REF_PLAN_STAT_HANDLE);
+    ObILibCacheObject *cache_obj = NULL;
+    int tmp_ret = plan_cache.ref_cache_obj(plan_ids.at(i), guard);
+    if (OB_HASH_NOT_EXIST == tmp_ret) {
+      // evicted, ignore it
+    } else if (OB_SUCCESS != tmp_ret) {
+      ret = tmp_ret;
+      LOG_WARN("failed to ref cache obj", K(ret), K(plan_ids.at(i)));
+    } else if (OB_ISNULL(cache_obj = guard.get_cache_obj())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("cache obj is null", K(ret));
+    } else if (ObLibCacheNameSpace::NS_CRSR != cache_obj->get_ns()
+               || !need_snapshot(*static_cast<ObPhysicalPlan *>(cache_obj))) {
+      // skip
+    } else if (OB_FAIL(hot_plans.push_back(HotPlan(
+                static_cast<ObPhysicalPlan *>(cache_obj)->stat_.hit_count_,
+                plan_ids.at(i))))) {
+      LOG_WARN("failed to push back hot plan", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    std::sort(hot_plans.begin(), hot_plans.end());
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < hot_plans.count()
+       && items.count() < MAX_SNAPSHOT_PLAN_CNT; i++) {
+    ObCacheObjGuard guard(PC_REF_PLAN_STAT_HANDLE);
+    ObPlanCacheSnapshotItem item;
+    int tmp_ret = plan_cache.ref_cache_obj(hot_plans.at(i).plan_id_, guard);
+    if (OB_HASH_NOT_EXIST == tmp_ret) {
+      // evicted, ignore it
+    } else if (OB_SUCCESS != tmp_ret) {
+      ret = tmp_ret;
+      LOG_WARN("failed to ref cache obj", K(ret), K(hot_plans.at(i)));
+    } else if (OB_ISNULL(guard.get_cache_obj())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("cache obj is null", K(ret));
+    } else if (OB_FAIL(item.assign(static_cast<ObPhysicalPlan *>(guard.get_cache_obj())->stat_,
+                                   allocator))) {
+      LOG_WARN("failed to assign snapshot item", K(ret));
+    } else if (OB_FAIL(items.push_back(item))) {
+      LOG_WARN("failed to push back snapshot item", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObPlanCacheSnapshot::write_file(const char *path, const char *buf, const int64_t len)
+{
+  int ret = OB_SUCCESS;
+  int fd = -1;
+  char tmp_path[MAX_PATH_SIZE] = {0};
+  int64_t pos = 0;
+  if (OB_FAIL(databuff_printf(tmp_path, MAX_PATH_SIZE, pos, "%s.tmp", path))) {
+    LOG_WARN("failed to print tmp path", K(ret), K(path));
+  } else if ((fd = ::open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC,
+                          S_IRUSR | S_IWUSR | S_IRGRP)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to create snapshot file", K(ret), K(tmp_path), KERRMSG);
+  } else {
+    if (len != unintr_write(fd, buf, len)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("failed to write snapshot file", K(ret), K(tmp_path), K(len), KERRMSG);
+    } else if (0 != ::fsync(fd)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("failed to sync snapshot file", K(ret), K(tmp_path), KERRMSG);
+    }
+    if (0 != ::close(fd)) {
+      ret = OB_SUCC(ret) ? OB_IO_ERROR : ret;
+      LOG_WARN("failed to close snapshot file", K(ret), K(tmp_path), KERRMSG);
+    }
+    if (OB_SUCC(ret) && 0 != ::rename(tmp_path, path)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("failed to rename snapshot file", K(ret), K(tmp_path), K(path), KERRMSG);
+    }
+  }
+  return ret;
+}
+
+int ObPlanCacheSnapshot::dump(ObPlanCache &plan_cache)
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  const uint64_t tenant_id = plan_cache.get_tenant_id();
+  ObArenaAllocator allocator(ObMemAttr(tenant_id, "PCSnapshot"));
+  ObArray<ObPlanCacheSnapshotItem> items;
+  if (OB_FAIL(collect_hot_plans(plan_cache, allocator, items))) {
+    LOG_WARN("failed to collect hot plans", K(ret), K(tenant_id));
+  } else if (items.empty()) {
+    // keep the previous snapshot if there is no hot plan, e.g. just after flush
+  } else if (OB_FAIL(write(tenant_id, items))) {
+    LOG_WARN("failed to write plan cache snapshot", K(ret), K(tenant_id));
+  } else {
+    LOG_INFO("dump plan cache snapshot", K(tenant_id), "item_cnt", items.count(),
+             "cost_us", ObTimeUtility::current_time() - start_ts);
+  }
+  return ret;
+}
+
+int ObPlanCacheSnapshot::write(const uint64_t tenant_id,
+                               const ObIArray<ObPlanCacheSnapshotItem> &items)
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator allocator(ObMemAttr(tenant_id, "PCSnapshot"));
+  ObPlanCacheSnapshotHeader header;
+  char path[MAX_PATH_SIZE] = {0};
+  char dir[MAX_PATH_SIZE] = {0};
+  char *buf = NULL;
+  char *data_buf = NULL;
+  int64_t buf_len = 0;
+  int64_t pos = 0;
+  int64_t data_pos = 0;
+  int64_t dir_pos = 0;
+  for (int64_t i = 0; i < items.count(); i++) {
+    header.data_len_ += items.at(i).get_serialize_size();
+  }
+  header.item_cnt_ = items.count();
+  if (header.data_len_ > MAX_SNAPSHOT_FILE_SIZE) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("plan cache snapshot is too large", K(ret), K(header));
+  } else if (OB_ISNULL(data_buf = static_cast<char *>(allocator.alloc(header.data_len_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc snapshot buffer", K(ret), K(header));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < items.count(); i++) {
+    if (OB_FAIL(items.at(i).serialize(data_buf, header.data_len_, data_pos))) {
+      LOG_WARN("failed to serialize snapshot item", K(ret), K(i));
+    }
+  }
+  // the header is serialized after the checksum is known, its size depends on the values.
+  if (OB_SUCC(ret)) {
+    header.data_len_ = data_pos;
+    header.data_checksum_ = static_cast<int64_t>(ob_crc64(data_buf, data_pos));
+    buf_len = header.get_serialize_size() + data_pos;
+    if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(buf_len)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc snapshot buffer", K(ret), K(buf_len));
+    } else if (OB_FAIL(header.serialize(buf, buf_len, pos))) {
+      LOG_WARN("failed to serialize snapshot header", K(ret), K(header));
+    } else {
+      MEMCPY(buf + pos, data_buf, data_pos);
+      pos += data_pos;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(get_file_path(tenant_id, path, MAX_PATH_SIZE))) {
+    LOG_WARN("failed to get snapshot file path", K(ret));
+  } else if (OB_FAIL(databuff_printf(dir, MAX_PATH_SIZE, dir_pos, "%s/plan_cache",
+                                     GCONF.data_dir.str()))) {
+    LOG_WARN("failed to print snapshot dir", K(ret));
+  } else if (OB_FAIL(FileDirectoryUtils::create_full_path(dir))) {
+    LOG_WARN("failed to create snapshot dir", K(ret), K(dir));
+  } else if (OB_FAIL(write_file(path, buf, pos))) {
+    LOG_WARN("failed to write snapshot file", K(ret), K(path));
+  } else {
+    LOG_INFO("write plan cache snapshot", K(tenant_id), K(path), K(header));
+  }
+  return ret;
+}
+
+int ObPlanCacheSnapshot::remove(const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  char path[MAX_PATH_SIZE] = {0};
+  bool is_exist = false;
+  if (OB_FAIL(get_file_path(tenant_id, path, MAX_PATH_SIZE))) {
+    LOG_WARN("failed to get snapshot file path", K(ret));
+  } else if (OB_FAIL(FileDirectoryUtils::is_exists(path, is_exist))) {
+    LOG_WARN("failed to check snapshot file", K(ret), K(path));
+  } else if (!is_exist) {
+    // no snapshot
+  } else if (OB_FAIL(FileDirectoryUtils::delete_file(path))) {
+    LOG_WARN("failed to delete snapshot file", K(ret), K(path));
+  } else {
+    LOG_INFO("remove plan cache snapshot", K(tenant_id), K(path));
+  }
+  return ret;
+}
+
+int ObPlanCacheSnapshot::load(const uint64_t tenant_id,
+                              ObIAllocator &allocator,
+                              ObIArray<ObPlanCacheSnapshotItem> &items)
+{
+  int ret = OB_SUCCESS;
+  char path[MAX_PATH_SIZE] = {0};
+  bool is_exist = false;
+  int64_t file_size = 0;
+  int fd = -1;
+  char *buf = NULL;
+  int64_t pos = 0;
+  ObPlanCacheSnapshotHeader header;
+  if (OB_FAIL(get_file_path(tenant_id, path, MAX_PATH_SIZE))) {
+    LOG_WARN("failed to get snapshot file path", K(ret));
+  } else if (OB_FAIL(FileDirectoryUtils::is_exists(path, is_exist))) {
+    LOG_WARN("failed to check snapshot file", K(ret), K(path));
+  } else if (!is_exist) {
+    // no snapshot
+  } else if (OB_FAIL(FileDirectoryUtils::get_file_size(path, file_size))) {
+    LOG_WARN("failed to get snapshot file size", K(ret), K(path));
+  } else if (file_size <= 0 || file_size > MAX_SNAPSHOT_FILE_SIZE) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid snapshot file size", K(ret), K(path), K(file_size));
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(file_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc snapshot buffer", K(ret), K(file_size));
+  } else if ((fd = ::open(path, O_RDONLY)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to open snapshot file", K(ret), K(path), KERRMSG);
+  } else {
+    if (file_size != unintr_pread(fd, buf, file_size, 0)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("failed to read snapshot file", K(ret), K(path), K(file_size), KERRMSG);
+    }
+    if (0 != ::close(fd)) {
+      LOG_WARN("failed to close snapshot file", K(path), KERRMSG);
+    }
+  }
+  // the items point to the file buffer, which lives as long as the allocator.
+  if (OB_FAIL(ret) || !is_exist) {
+  } else if (OB_FAIL(header.deserialize(buf, file_size, pos))) {
+    LOG_WARN("failed to deserialize snapshot header", K(ret), K(path));
+  } else if (!header.is_valid() || pos + header.data_len_ != file_size) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid snapshot header", K(ret), K(header), K(pos), K(file_size));
+  } else if (header.data_checksum_
+             != static_cast<int64_t>(ob_crc64(buf + pos, header.data_len_))) {
+    ret = OB_CHECKSUM_ERROR;
+    LOG_WARN("snapshot checksum mismatch", K(ret), K(header), K(path));
+  } else if (OB_FAIL(items.reserve(header.item_cnt_))) {
+    LOG_WARN("failed to reserve snapshot items", K(ret), K(header));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < header.item_cnt_; i++) {
+      ObPlanCacheSnapshotItem item;
+      if (OB_FAIL(item.deserialize(buf, file_size, pos))) {
+        LOG_WARN("failed to deserialize snapshot item", K(ret), K(i), K(header));
+      } else if (OB_FAIL(items.push_back(item))) {
+        LOG_WARN("failed to push back snapshot item", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+ObPlanCacheWarmupTask::ObPlanCacheWarmupTask()
+  : plan_cache_(NULL),
+    tg_id_(-1),
+    start_ts_(0),
+    is_loaded_(false),
+    is_finished_(false),
+    allocator_("PCWarmup"),
+    items_(),
+    next_idx_(0),
+    compile_cnt_(0),
+    changed_cnt_(0),
+    skip_cnt_(0),
+    fail_cnt_(0)
+{
+}
+
+int ObPlanCacheWarmupTask::init(ObPlanCache *plan_cache, const int tg_id)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(plan_cache) || tg_id < 0) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(plan_cache), K(tg_id));
+  } else {
+    plan_cache_ = plan_cache;
+    tg_id_ = tg_id;
+    start_ts_ = ObTimeUtility::current_time();
+    allocator_.set_tenant_id(plan_cache->get_tenant_id());
+    items_.set_block_allocator(ModulePageAllocator(allocator_));
+    if (OB_FAIL(TG_SCHEDULE(tg_id_, *this, SCHEMA_WAIT_INTERVAL, false))) {
+      LOG_WARN("failed to schedule plan cache warmup task", K(ret));
+    }
+  }
+  return ret;
+}
+
+void ObPlanCacheWarmupTask::schedule(const int64_t delay)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(TG_SCHEDULE(tg_id_, *this, delay, false))) {
+    LOG_WARN("failed to schedule plan cache warmup task", K(ret));
+    finish();
+  }
+}
+
+void ObPlanCacheWarmupTask::finish()
+{
+  LOG_INFO("finish plan cache warmup", "tenant_id", plan_cache_->get_tenant_id(), KPC(this),
+           "cost_us", ObTimeUtility::current_time() - start_ts_);
+  items_.reset();
+  allocator_.reset();
+  ATOMIC_STORE(&is_finished_, true);
+}
+
+void ObPlanCacheWarmupTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  bool is_end = false;
+  const uint64_t tenant_id = plan_cache_->get_tenant_id();
+  if (is_finished()) {
+    // do nothing
+  } else if (OB_ISNULL(GCTX.schema_service_) || OB_ISNULL(GCTX.sql_engine_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("schema service or sql engine is null", K(ret));
+  } else if (!GCTX.schema_service_->is_tenant_full_schema(tenant_id)) {
+    if (ObTimeUtility::current_time() - start_ts_ > MAX_SCHEMA_WAIT_TIME) {
+      ret = OB_TIMEOUT;
+      LOG_WARN("wait tenant schema timeout, skip plan cache warmup", K(ret), K(tenant_id));
+    } else {
+      schedule(SCHEMA_WAIT_INTERVAL);
+    }
+  } else if (!is_loaded_) {
+    is_loaded_ = true;
+    if (OB_FAIL(ObPlanCacheSnapshot::load(tenant_id, allocator_, items_))) {
+      LOG_WARN("failed to load plan cache snapshot", K(ret), K(tenant_id));
+    } else if (items_.empty()) {
+      is_end = true;
+    } else {
+      LOG_INFO("start plan cache warmup", K(tenant_id), "item_cnt", items_.count());
+      schedule(0);
+    }
+  } else if (OB_FAIL(warmup_slice(is_end))) {
+    LOG_WARN("failed to warmup plan cache", K(ret), K(tenant_id), KPC(this));
+  } else if (!is_end) {
+    schedule(WARMUP_SLICE_INTERVAL);
+  }
+  if (!is_finished() && (OB_FAIL(ret) || is_end)) {
+    finish();
+  }
+}
+
+int ObPlanCacheWarmupTask::init_session(ObSchemaGetterGuard &schema_guard,
+                                        ObSQLSessionInfo &session)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = plan_cache_->get_tenant_id();
+  const ObTenantSchema *tenant_schema = NULL;
+  const ObUserInfo *user_info = NULL;
+  bool is_oracle_mode = false;
+  if (OB_FAIL(ObCompatModeGetter::check_is_oracle_mode_with_tenant_id(tenant_id, is_oracle_mode))) {
+    LOG_WARN("failed to get tenant compat mode", K(ret), K(tenant_id));
+  } else if (OB_FAIL(schema_guard.get_tenant_info(tenant_id, tenant_schema))) {
+    LOG_WARN("failed to get tenant schema", K(ret), K(tenant_id));
+  } else if (OB_FAIL(schema_guard.get_user_info(tenant_id,
+                                                is_oracle_mode ? OB_ORA_SYS_USER_ID : OB_SYS_USER_ID,
+                                                user_info))) {
+    LOG_WARN("failed to get user info", K(ret), K(tenant_id));
+  } else if (OB_ISNULL(tenant_schema) || OB_ISNULL(user_info)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tenant schema or user info is null", K(ret), KP(tenant_schema), KP(user_info));
+  } else if (OB_FAIL(session.init(0, 0, NULL))) {
+    LOG_WARN("failed to init session", K(ret));
+  } else {
+    session.set_inner_session();
+    if (OB_FAIL(session.load_default_sys_variable(false, true))) {
+      LOG_WARN("failed to load default sys variable", K(ret));
+    } else if (OB_FAIL(session.init_tenant(tenant_schema->get_tenant_name_str(), tenant_id))) {
+      LOG_WARN("failed to init tenant", K(ret), K(tenant_id));
+    } else if (OB_FAIL(session.load_all_sys_vars(schema_guard))) {
+      LOG_WARN("failed to load all sys vars", K(ret));
+    } else if (OB_FAIL(session.gen_sys_var_in_pc_str())) {
+      LOG_WARN("failed to gen sys var in pc str", K(ret));
+    } else if (OB_FAIL(session.gen_configs_in_pc_str())) {
+      LOG_WARN("failed to gen configs in pc str", K(ret));
+    } else if (OB_FAIL(session.set_user(user_info->get_user_name(),
+                                        user_info->get_host_name_str(),
+                                        user_info->get_user_id()))) {
+      LOG_WARN("failed to set user", K(ret));
+    } else {
+      session.set_user_priv_set(OB_PRIV_ALL | OB_PRIV_GRANT);
+    }
+  }
+  return ret;
+}
+
+int ObPlanCacheWarmupTask::compile(const ObPlanCacheSnapshotItem &item,
+                                   ObSchemaGetterGuard &schema_guard,
+                                   ObSQLSessionInfo &session)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = plan_cache_->get_tenant_id();
+  const ObDatabaseSchema *database_schema = NULL;
+  ObArenaAllocator allocator(ObMemAttr(tenant_id, "PCWarmupSql"));
+  ObString sql;
+  if (OB_FAIL(item.build_sql(allocator, sql))) {
+    if (OB_NOT_SUPPORTED == ret) {
+      // the plan can not be rebuilt without the literal values
+      ret = OB_SUCCESS;
+      skip_cnt_++;
+    } else {
+      LOG_WARN("failed to build sql", K(ret), K(item));
+    }
+  } else if (OB_FAIL(schema_guard.get_database_schema(tenant_id, item.db_id_, database_schema))) {
+    LOG_WARN("failed to get database schema", K(ret), K(item));
+  } else if (OB_ISNULL(database_schema)) {
+    // database dropped
+    skip_cnt_++;
+  } else if (item.sys_vars_str_ != session.get_sys_var_in_pc_str()
+             || item.config_str_ != session.get_config_in_pc_str()) {
+    // compiled plan would never be hit by the sessions which generated it
+    skip_cnt_++;
+  } else if (OB_FAIL(session.set_default_database(database_schema->get_database_name_str()))) {
+    LOG_WARN("failed to set default database", K(ret), K(item));
+  } else {
+    observer::ObReqTimeGuard req_timeinfo_guard;
+    const int64_t now = ObTimeUtility::current_time();
+    const int64_t origin_timeout_ts = THIS_WORKER.get_timeout_ts();
+    ObSqlCtx ctx;
+    ctx.session_info_ = &session;
+    ctx.schema_guard_ = &schema_guard;
+    ctx.disable_privilege_check_ = PRIV_CHECK_FLAG_DISABLE;
+    session.set_database_id(item.db_id_);
+    session.set_query_start_time(now);
+    THIS_WORKER.set_timeout_ts(now + COMPILE_TIMEOUT);
+    // only generate the plan and add it to plan cache, the result set is not opened
+    // and the plan is released with the result set.
+    HEAP_VAR(ObResultSet, result, session, allocator) {
+      result.get_exec_context().get_task_exec_ctx().set_min_cluster_version(GET_MIN_CLUSTER_VERSION());
+      if (OB_FAIL(result.init())) {
+        LOG_WARN("failed to init result set", K(ret));
+      } else if (OB_FAIL(GCTX.sql_engine_->stmt_query(sql, ctx, result))) {
+        LOG_WARN("failed to compile sql", K(ret), K(item));
+      } else {
+        const ObPhysicalPlan *plan = result.get_physical_plan();
+        compile_cnt_++;
+        if (NULL != plan && plan->stat_.outline_data_ != item.outline_data_) {
+          changed_cnt_++;
+          LOG_INFO("plan changed after warmup", K(item),
+                   "old_outline", item.outline_data_,
+                   "new_outline", plan->stat_.outline_data_);
+        }
+      }
+    }
+    THIS_WORKER.set_timeout_ts(origin_timeout_ts);
+  }
+  return ret;
+}
+
+int ObPlanCacheWarmupTask::warmup_slice(bool &is_end)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = plan_cache_->get_tenant_id();
+  ObSchemaGetterGuard schema_guard;
+  lib::Worker::CompatMode compat_mode = lib::Worker::CompatMode::MYSQL;
+  is_end = false;
+  if (OB_FAIL(GCTX.schema_service_->get_tenant_schema_guard(tenant_id, schema_guard))) {
+    LOG_WARN("failed to get schema guard", K(ret), K(tenant_id));
+  } else if (OB_FAIL(ObCompatModeGetter::get_tenant_mode(tenant_id, compat_mode))) {
+    LOG_WARN("failed to get tenant compat mode", K(ret), K(tenant_id));
+  } else {
+    lib::CompatModeGuard g(compat_mode);
+    SMART_VAR(ObSQLSessionInfo, session) {
+      if (OB_FAIL(init_session(schema_guard, session))) {
+        LOG_WARN("failed to init warmup session", K(ret), K(tenant_id));
+      }
+      const int64_t end_idx = std::min(next_idx_ + WARMUP_SLICE_CNT, items_.count());
+      for (; OB_SUCC(ret) && next_idx_ < end_idx; next_idx_++) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_TMP_FAIL(compile(items_.at(next_idx_), schema_guard, session))) {
+          // tables or columns may be changed, ignore the failure.
+          fail_cnt_++;
+        }
+      }
+    }
+    is_end = next_idx_ >= items_.count();
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_PLAN_CACHE_SNAPSHOT_H_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_PLAN_CACHE_SNAPSHOT_H_
+
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_array.h"
+#include "lib/string/ob_string.h"
+#include "lib/task/ob_timer.h"
+#include "lib/utility/ob_print_utils.h"
+#include "lib/utility/ob_unify_serialize.h"
+
+namespace oceanbase
+{
+namespace share
+{
+namespace schema
+{
+class ObSchemaGetterGuard;
+}
+}
+namespace sql
+{
+class ObPlanCache;
+class ObSQLSessionInfo;
+struct ObPlanStat;
+
+// A hot plan in the snapshot. Only the parameterized sql, the parameter types and the
+// usage stats are persisted, literal values of user queries never reach the disk. The plan
+// is recompiled from build_sql() when the tenant restarts.
+struct ObPlanCacheSnapshotItem
+{
+  OB_UNIS_VERSION(2);
+public:
+  static const int64_t MAX_PARAM_LITERAL_LEN = 32;
+  ObPlanCacheSnapshotItem()
+    : db_id_(common::OB_INVALID_ID),
+      sql_cs_type_(common::CS_TYPE_INVALID),
+      constructed_sql_(),
+      param_infos_(),
+      sys_vars_str_(),
+      config_str_(),
+      outline_data_(),
+      hints_info_(),
+      hit_count_(0),
+      execute_times_(0),
+      elapsed_time_(0),
+      last_active_time_(0)
+  {
+  }
+  int assign(const ObPlanStat &stat, common::ObIAllocator &allocator);
+  // replace each '?' of %constructed_sql_ by a literal of the type in %param_infos_,
+  // OB_NOT_SUPPORTED if a parameter type has no literal.
+  int build_sql(common::ObIAllocator &allocator, common::ObString &sql) const;
+  TO_STRING_KV(K_(db_id), K_(sql_cs_type), K_(constructed_sql), K_(param_infos), K_(hit_count),
+               K_(execute_times), K_(elapsed_time), K_(last_active_time));
+
+  uint64_t db_id_;
+  common::ObCollationType sql_cs_type_;
+  // parameterized sql and the {need_to_check_type, need_to_check_bool_value,
+  // expected_bool_value, scale, type} of each parameter, see ObPhysicalPlan::init_params_info_str
+  common::ObString constructed_sql_;
+  common::ObString param_infos_;
+  // the plan is not hit by sessions with different plan affecting variables or configs
+  common::ObString sys_vars_str_;
+  common::ObString config_str_;
+  // used to tell whether the recompiled plan is the same as before
+  common::ObString outline_data_;
+  common::ObString hints_info_;
+  uint64_t hit_count_;
+  int64_t execute_times_;
+  int64_t elapsed_time_;
+  int64_t last_active_time_;
+};
+
+struct ObPlanCacheSnapshotHeader
+{
+  OB_UNIS_VERSION(1);
+public:
+  static const int64_t MAGIC = 0x50435348; // "PCSH"
+  ObPlanCacheSnapshotHeader() : magic_(MAGIC), item_cnt_(0), data_len_(0), data_checksum_(0) {}
+  bool is_valid() const { return MAGIC == magic_ && item_cnt_ >= 0 && data_len_ >= 0; }
+  TO_STRING_KV(K_(magic), K_(item_cnt), K_(data_len), K_(data_checksum));
+
+  int64_t magic_;
+  int64_t item_cnt_;
+  int64_t data_len_;
+  int64_t data_checksum_;
+};
+
+// Snapshot file of the hottest plans of a tenant plan cache, written to
+// ${data_dir}/plan_cache/tenant_${tenant_id}.snapshot:
+//
+//   | header | item 0 | item 1 | ... | item n-1 |
+//
+// The header records the item count, length and checksum of the items.
+class ObPlanCacheSnapshot
+{
+public:
+  static const int64_t MAX_SNAPSHOT_PLAN_CNT = 1024;
+  static const int64_t MAX_SNAPSHOT_FILE_SIZE = 64L << 20; // 64M
+
+  static int dump(ObPlanCache &plan_cache);
+  static int write(const uint64_t tenant_id,
+                   const common::ObIArray<ObPlanCacheSnapshotItem> &items);
+  static int load(const uint64_t tenant_id,
+                  common::ObIAllocator &allocator,
+                  common::ObIArray<ObPlanCacheSnapshotItem> &items);
+  // called when the tenant is dropped
+  static int remove(const uint64_t tenant_id);
+private:
+  static int get_file_path(const uint64_t tenant_id, char *buf, const int64_t buf_len);
+  static int collect_hot_plans(ObPlanCache &plan_cache,
+                               common::ObIAllocator &allocator,
+                               common::ObIArray<ObPlanCacheSnapshotItem> &items);
+  static int write_file(const char *path, const char *buf, const int64_t len);
+};
+
+// Recompiles the plans in the snapshot after the tenant plan cache is created, so
+// that hot queries do not have to hard parse after restart. It runs in slices on
+// its own timer, so the plan cache eviction is not blocked by compiling, and
+// reschedules itself until all plans are compiled.
+class ObPlanCacheWarmupTask : public common::ObTimerTask
+{
+public:
+  static const int64_t WARMUP_SLICE_CNT = 32;
+  static const int64_t WARMUP_SLICE_INTERVAL = 10 * 1000L; // 10ms
+  static const int64_t SCHEMA_WAIT_INTERVAL = 1000 * 1000L; // 1s
+  static const int64_t MAX_SCHEMA_WAIT_TIME = 10 * 60 * 1000 * 1000L; // 10min
+  static const int64_t COMPILE_TIMEOUT = 10 * 1000 * 1000L; // 10s
+
+  ObPlanCacheWarmupTask();
+  virtual ~ObPlanCacheWarmupTask() {}
+  int init(ObPlanCache *plan_cache, const int tg_id);
+  bool is_finished() const { return ATOMIC_LOAD(&is_finished_); }
+  // warmup is disabled or can not be scheduled
+  void set_finished() { ATOMIC_STORE(&is_finished_, true); }
+  void runTimerTask(void);
+  TO_STRING_KV(K_(next_idx), K_(compile_cnt), K_(changed_cnt), K_(skip_cnt), K_(fail_cnt),
+               "item_cnt", items_.count());
+private:
+  int warmup_slice(bool &is_end);
+  int init_session(share::schema::ObSchemaGetterGuard &schema_guard,
+                   ObSQLSessionInfo &session);
+  int compile(const ObPlanCacheSnapshotItem &item,
+              share::schema::ObSchemaGetterGuard &schema_guard,
+              ObSQLSessionInfo &session);
+  void schedule(const int64_t delay);
+  void finish();
+private:
+  ObPlanCache *plan_cache_;
+  int tg_id_;
+  int64_t start_ts_;
+  bool is_loaded_;
+  bool is_finished_;
+  common::ObArenaAllocator allocator_;
+  common::ObArray<ObPlanCacheSnapshotItem> items_;
+  int64_t next_idx_;
+  int64_t compile_cnt_;
+  int64_t changed_cnt_;
+  int64_t skip_cnt_;
+  int64_t fail_cnt_;
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SQL_PLAN_CACHE_OB_PLAN_CACHE_SNAPSHOT_H_
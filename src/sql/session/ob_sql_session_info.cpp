@@ -2320,6 +2320,8 @@ void ObSQLSessionInfo::ObCachedTenantConfigInfo::refresh()
       px_join_skew_minfreq_ = tenant_config->_px_join_skew_minfreq;
       // 7. print_sample_ppm_ for flt
       ATOMIC_STORE(&print_sample_ppm_, tenant_config->_print_sample_ppm);
+      // 8. batch encoding of result rows
+      enable_batch_result_encoding_ = tenant_config->_enable_batch_result_encoding;
     }
     //timezone的更新频率非常低，放到后台驱动
     (void)session_->update_timezone_info();
@@ -492,6 +492,7 @@ public:
                                  at_type_(ObAuditTrailType::NONE),
                                  sort_area_size_(128*1024*1024),
                                  print_sample_ppm_(0),
+                                 enable_batch_result_encoding_(true),
                                  last_check_ec_ts_(0),
                                  session_(session)
     {
@@ -507,6 +508,7 @@ public:
     int64_t get_print_sample_ppm() const { return ATOMIC_LOAD(&print_sample_ppm_); }
     bool get_px_join_skew_handling() const { return px_join_skew_handling_; }
     int64_t get_px_join_skew_minfreq() const { return px_join_skew_minfreq_; }
+    bool get_enable_batch_result_encoding() const { return enable_batch_result_encoding_; }
   private:
     //租户级别配置项缓存session 上，避免每次获取都需要刷新
     bool is_external_consistent_;
@@ -520,6 +522,7 @@ public:
     int64_t sort_area_size_;
     // for record sys config print_sample_ppm
     int64_t print_sample_ppm_;
+    bool enable_batch_result_encoding_;
     int64_t last_check_ec_ts_;
     ObSQLSessionInfo *session_;
   };
@@ -958,6 +961,11 @@ public:
     return cached_tenant_config_info_.get_px_join_skew_handling();
   }
 
+  bool is_enable_batch_result_encoding()
+  {
+    cached_tenant_config_info_.refresh();
+    return cached_tenant_config_info_.get_enable_batch_result_encoding();
+  }
   bool is_enable_sql_extension()
   {
     cached_tenant_config_info_.refresh();
@@ -15,6 +15,9 @@
 #include "lib/oblog/ob_log_module.h"
 #include "lib/number/ob_number_v2.h"
 #include "common/sql_mode/ob_sql_mode_utils.h"
+#include "sql/engine/expr/ob_expr_add.h"
+#include "sql/engine/expr/ob_expr_mul.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
@@ -53,6 +56,14 @@ void ObAggCell::reuse()
 {
 }
 
+int ObAggCell::eval(const common::ObDatum &datum, const int64_t row_count)
+{
+  UNUSEDx(datum, row_count);
+  int ret = OB_NOT_SUPPORTED;
+  LOG_WARN("Eval datum is not supported", K(ret), K(*this));
+  return ret;
+}
+
 int ObAggCell::fill_result(sql::ObEvalCtx &ctx,bool need_padding)
 {
   int ret = OB_SUCCESS;
@@ -463,6 +474,306 @@ int ObMinMaxAggCell::deep_copy_datum(const blocksstable::ObStorageDatum &src)
   return ret;
 }
 
+ObSumAggCell::ObSumAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      obj_tc_(ObMaxTC),
+      result_tc_(ObMaxTC),
+      has_value_(false),
+      sum_int_(0),
+      sum_uint_(0),
+      sum_float_(0),
+      sum_double_(0),
+      sum_num_(),
+      agg_datum_buf_(allocator),
+      cell_data_ptrs_(nullptr)
+{
+  sum_num_.set_zero();
+}
+
+void ObSumAggCell::reset()
+{
+  agg_datum_buf_.reset();
+  if (nullptr != cell_data_ptrs_) {
+    allocator_.free(cell_data_ptrs_);
+    cell_data_ptrs_ = nullptr;
+  }
+  reuse();
+  obj_tc_ = ObMaxTC;
+  result_tc_ = ObMaxTC;
+  ObAggCell::reset();
+}
+
+void ObSumAggCell::reuse()
+{
+  has_value_ = false;
+  sum_int_ = 0;
+  sum_uint_ = 0;
+  sum_float_ = 0;
+  sum_double_ = 0;
+  sum_num_.set_zero();
+  ObAggCell::reuse();
+}
+
+int ObSumAggCell::init(const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_ISNULL(col_param_) || OB_ISNULL(expr_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null col param or expr", K(ret), KP(col_param_), KP(expr_));
+  } else {
+    obj_tc_ = col_param_->get_meta_type().get_type_class();
+    result_tc_ = ob_obj_type_class(expr_->datum_meta_.type_);
+    if (OB_UNLIKELY(!sql::ObPushdownFilterUtils::is_sum_pushdown_supported(obj_tc_, result_tc_))) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Sum type is not supported", K(ret), K_(obj_tc), K_(result_tc));
+    } else if (OB_FAIL(agg_datum_buf_.init(batch_size))) {
+      LOG_WARN("Failed to init agg datum buf", K(ret));
+    } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(char*) * batch_size))) {
+      ret = common::OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Failed to alloc cell data ptrs", K(ret), K(batch_size));
+    } else {
+      cell_data_ptrs_ = static_cast<const char**> (buf);
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::process(blocksstable::ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum &storage_datum = row.storage_datums_[col_idx_];
+  if (OB_FAIL(fill_default_if_need(storage_datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(storage_datum), K(*this));
+  } else if (OB_FAIL(eval(storage_datum))) {
+    LOG_WARN("Failed to eval datum", K(ret), K(storage_datum), K(*this));
+  }
+  LOG_DEBUG("after process single row", K(storage_datum), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(reader) || OB_ISNULL(row_ids)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Uexpected, reader or row_ids is null", K(ret), KP(reader), KP(row_ids), K(row_count));
+  } else if (blocksstable::ObIMicroBlockReader::Reader == reader->get_type()) {
+    blocksstable::ObMicroBlockReader *block_reader = static_cast<blocksstable::ObMicroBlockReader*>(reader);
+    if (OB_FAIL(block_reader->get_aggregate_result(col_idx_, col_param_, row_ids, row_count, *this))) {
+      LOG_WARN("Failed to get aggregate result", K(ret), K(row_count), KPC(this));
+    }
+  } else {
+    blocksstable::ObMicroBlockDecoder *block_decoder = static_cast<blocksstable::ObMicroBlockDecoder*>(reader);
+    if (OB_FAIL(block_decoder->get_aggregate_result(col_idx_, row_ids, cell_data_ptrs_, row_count,
+                                                    agg_datum_buf_.get_datums(), *this))) {
+      LOG_WARN("Failed to get aggregate result", K(ret), K(row_count), KPC(this));
+    }
+  }
+  LOG_DEBUG("after process batch rows", K(ret), K(row_count), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  UNUSED(index_info);
+  int ret = OB_NOT_SUPPORTED;
+  LOG_WARN("Sum on index info is not supported", K(ret), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::eval(const common::ObDatum &datum, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+  } else if (OB_UNLIKELY(datum.is_nop() || row_count <= 0 ||
+                         (row_count > 1 && !support_weighted_eval()))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(datum), K(row_count));
+  } else {
+    switch (obj_tc_) {
+      case ObIntTC: {
+        ret = add_int(datum.get_int(), row_count);
+        break;
+      }
+      case ObUIntTC: {
+        ret = add_uint(datum.get_uint(), row_count);
+        break;
+      }
+      case ObFloatTC: {
+        if (ObFloatTC == result_tc_) {
+          sum_float_ += datum.get_float();
+        } else {
+          sum_double_ += static_cast<double>(datum.get_float());
+        }
+        break;
+      }
+      case ObDoubleTC: {
+        sum_double_ += datum.get_double();
+        break;
+      }
+      case ObNumberTC: {
+        ret = add_number(common::number::ObNumber(datum.get_number()), row_count);
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected sum type", K(ret), K_(obj_tc));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("Failed to add datum", K(ret), K(datum), K(row_count), KPC(this));
+    } else {
+      has_value_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_int(const int64_t value, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  int64_t delta = 0;
+  int64_t sum = 0;
+  if (!sql::ObExprMul::is_mul_out_of_range(value, row_count, delta) &&
+      !sql::ObExprAdd::is_add_out_of_range(sum_int_, delta, sum)) {
+    sum_int_ = sum;
+  } else {
+    char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    common::number::ObNumber nmb;
+    if (OB_FAIL(nmb.from(value, allocator))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K(value));
+    } else if (OB_FAIL(add_number(nmb, row_count))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb), K(row_count));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_uint(const uint64_t value, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  uint64_t delta = 0;
+  uint64_t sum = 0;
+  if (!sql::ObExprMul::is_mul_out_of_range(value, static_cast<uint64_t>(row_count), delta) &&
+      !sql::ObExprAdd::is_add_out_of_range(sum_uint_, delta, sum)) {
+    sum_uint_ = sum;
+  } else {
+    char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    common::number::ObNumber nmb;
+    if (OB_FAIL(nmb.from(value, allocator))) {
+      LOG_WARN("Failed to cons number from uint", K(ret), K(value));
+    } else if (OB_FAIL(add_number(nmb, row_count))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb), K(row_count));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_number(const common::number::ObNumber &nmb, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (1 == row_count) {
+    ret = add_to_sum_num(nmb);
+  } else {
+    char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN * 2];
+    common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN * 2);
+    common::number::ObNumber count_nmb;
+    common::number::ObNumber product_nmb;
+    if (OB_FAIL(count_nmb.from(row_count, allocator))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K(row_count));
+    } else if (OB_FAIL(nmb.mul_v3(count_nmb, product_nmb, allocator))) {
+      LOG_WARN("Failed to mul number", K(ret), K(nmb), K(count_nmb));
+    } else {
+      ret = add_to_sum_num(product_nmb);
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_to_sum_num(const common::number::ObNumber &nmb)
+{
+  int ret = OB_SUCCESS;
+  char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+  common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+  common::number::ObNumber result_nmb;
+  if (sum_num_.is_zero()) {
+    result_nmb.shadow_copy(nmb);
+  } else if (OB_FAIL(sum_num_.add_v3(nmb, result_nmb, allocator))) {
+    LOG_WARN("Failed to add number", K(ret), K_(sum_num), K(nmb));
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_UNLIKELY(result_nmb.get_length() > common::number::ObNumber::OB_CALC_BUFFER_SIZE)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected number length", K(ret), K(result_nmb));
+  } else {
+    MEMCPY(sum_num_digits_, result_nmb.get_digits(), result_nmb.get_length() * sizeof(uint32_t));
+    sum_num_.assign(result_nmb.get_desc_value(), sum_num_digits_);
+  }
+  return ret;
+}
+
+int ObSumAggCell::get_result_number(common::number::ObNumber &result, common::ObIAllocator &allocator) const
+{
+  int ret = OB_SUCCESS;
+  common::number::ObNumber native_nmb;
+  if (ObIntTC == obj_tc_) {
+    ret = native_nmb.from(sum_int_, allocator);
+  } else if (ObUIntTC == obj_tc_) {
+    ret = native_nmb.from(sum_uint_, allocator);
+  } else {
+    native_nmb.set_zero();
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("Failed to cons number from native sum", K(ret), KPC(this));
+  } else if (sum_num_.is_zero()) {
+    result.shadow_copy(native_nmb);
+  } else if (native_nmb.is_zero()) {
+    result.shadow_copy(sum_num_);
+  } else if (OB_FAIL(sum_num_.add_v3(native_nmb, result, allocator))) {
+    LOG_WARN("Failed to add number", K(ret), K_(sum_num), K(native_nmb));
+  }
+  return ret;
+}
+
+int ObSumAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
+{
+  UNUSED(need_padding);
+  int ret = OB_SUCCESS;
+  ObDatum &result = expr_->locate_datum_for_write(ctx);
+  sql::ObEvalInfo &eval_info = expr_->get_eval_info(ctx);
+  if (!has_value_) {
+    result.set_null();
+  } else if (ObNumberTC == result_tc_) {
+    char local_buff[common::number::ObNumber::MAX_CALC_BYTE_LEN * 2];
+    common::ObDataBuffer local_alloc(local_buff, common::number::ObNumber::MAX_CALC_BYTE_LEN * 2);
+    common::number::ObNumber result_num;
+    if (OB_FAIL(get_result_number(result_num, local_alloc))) {
+      LOG_WARN("Failed to get result number", K(ret), KPC(this));
+    } else {
+      result.set_number(result_num);
+    }
+  } else if (ObFloatTC == result_tc_) {
+    result.set_float(sum_float_);
+  } else {
+    result.set_double(sum_double_);
+  }
+  if (OB_SUCC(ret)) {
+    eval_info.evaluated_ = true;
+  }
+  LOG_DEBUG("fill result", K(result), KPC(this));
+  return ret;
+}
+
 ObAggRow::ObAggRow(common::ObIAllocator &allocator) :
     agg_cells_(allocator),
     need_exclude_null_(false),
@@ -572,6 +883,18 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
           } else if (OB_FAIL(agg_cells_.push_back(cell))) {
             LOG_WARN("Failed to push back agg cell", K(ret), K(i));
           }
+        } else if (T_FUN_SUM == expr->type_) {
+          need_exclude_null_ = true;
+          const share::schema::ObColumnParam *col_param = out_cols_param->at(col_idx);
+          if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObSumAggCell))) ||
+              OB_ISNULL(cell = new(buf) ObSumAggCell(col_idx, col_param, expr, allocator_))) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+          } else if (OB_FAIL(static_cast<ObSumAggCell*>(cell)->init(batch_size))) {
+            LOG_WARN("Failed to init ObSumAggCell", K(ret), KPC(cell));
+          } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+            LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+          }
         } else {
           ret = OB_NOT_SUPPORTED;
           LOG_WARN("Agg is not supported", K(ret), K(expr->type_));
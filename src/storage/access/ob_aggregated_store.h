@@ -40,6 +40,7 @@ public:
     COUNT,
     MINMAX,
     FIRST_ROW,
+    SUM,
   };
   ObAggCell(
       const int32_t col_idx,
@@ -56,6 +57,10 @@ public:
       int64_t *row_ids,
       const int64_t row_count) = 0;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) = 0;
+  // aggregate @datum which appears @row_count times, used by micro block readers
+  virtual int eval(const common::ObDatum &datum, const int64_t row_count = 1);
+  // whether eval() accepts @row_count greater than 1
+  virtual bool support_weighted_eval() const { return false; }
   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding);
   OB_INLINE bool is_lob_col() const { return is_lob_col_; }
   OB_INLINE int32_t get_col_idx() const { return col_idx_; }
@@ -169,7 +174,54 @@ private:
   common::ObArenaAllocator datum_allocator_;
 };
 
-// TODO sum
+// AVG is rewritten into SUM and COUNT by optimizer, so only SUM is aggregated in storage
+class ObSumAggCell : public ObAggCell
+{
+public:
+  ObSumAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator);
+  virtual ~ObSumAggCell() { reset(); };
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual ObAggCellType get_type() const override { return SUM; }
+  int init(const int64_t batch_size);
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual int eval(const common::ObDatum &datum, const int64_t row_count = 1) override;
+  // float and double are summed row by row, the result depends on the adding order
+  virtual bool support_weighted_eval() const override
+  {
+    return common::ObFloatTC != obj_tc_ && common::ObDoubleTC != obj_tc_;
+  }
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(obj_tc), K_(result_tc), K_(has_value),
+      K_(sum_int), K_(sum_uint), K_(sum_float), K_(sum_double), K_(sum_num));
+private:
+  int add_int(const int64_t value, const int64_t row_count);
+  int add_uint(const uint64_t value, const int64_t row_count);
+  int add_number(const common::number::ObNumber &nmb, const int64_t row_count);
+  int add_to_sum_num(const common::number::ObNumber &nmb);
+  int get_result_number(common::number::ObNumber &result, common::ObIAllocator &allocator) const;
+  common::ObObjTypeClass obj_tc_;
+  common::ObObjTypeClass result_tc_;
+  bool has_value_;
+  // int/uint are summed in native type until overflow, then flushed into sum_num_
+  int64_t sum_int_;
+  uint64_t sum_uint_;
+  float sum_float_;
+  double sum_double_;
+  common::number::ObNumber sum_num_;
+  uint32_t sum_num_digits_[common::number::ObNumber::OB_CALC_BUFFER_SIZE];
+  ObAggDatumBuf agg_datum_buf_;
+  const char **cell_data_ptrs_;
+};
 
 class ObAggRow
 {
@@ -16,6 +16,7 @@
 #include "share/rc/ob_tenant_base.h"
 #include "ob_index_tree_prefetcher.h"
 #include "ob_aggregated_store.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
 
 namespace oceanbase
@@ -1011,6 +1012,7 @@ int ObIndexTreeMultiPassPrefetcher::prefetch_micro_data()
         break;
       } else {
         // read index leaf and prefetch micro data
+        bool can_skip = false;
         while (OB_SUCC(ret) && prefetched_cnt < prefetch_depth) {
           prefetch_micro_idx = micro_data_prefetch_idx_ % max_micro_handle_cnt_;
           ObMicroIndexInfo &block_info = micro_data_infos_[prefetch_micro_idx];
@@ -1022,6 +1024,11 @@ int ObIndexTreeMultiPassPrefetcher::prefetch_micro_data()
               ret = OB_SUCCESS;
               break;
             }
+          } else if (OB_FAIL(check_skip_by_skip_index(block_info, can_skip))) {
+            LOG_WARN("Fail to check skip index", K(ret), K(block_info));
+          } else if (can_skip) {
+            // no row in this micro block could pass the pushdown filter
+            continue;
           } else if (nullptr != agg_row_store_ && agg_row_store_->can_agg_index_info(block_info)) {
             if (OB_FAIL(agg_row_store_->fill_index_info(block_info))) {
               LOG_WARN("Fail to agg index info", K(ret), K(block_info), KPC(this));
@@ -1396,6 +1403,33 @@ int ObIndexTreeMultiPassPrefetcher::check_row_lock(
   return ret;
 }
 
+int ObIndexTreeMultiPassPrefetcher::check_skip_by_skip_index(
+    const blocksstable::ObMicroIndexInfo &index_info,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  // border blocks are always read so that every range keeps at least one prefetched micro block,
+  // and only blocks which can be block scanned are skipped, otherwise rows of this block may be
+  // fused with the incremental rows from memtable or minor sstable
+  if (!index_info.has_skip_index()
+      || index_info.is_get()
+      || index_info.is_left_border()
+      || index_info.is_right_border()
+      || !index_info.can_blockscan(iter_param_->has_lob_column_out())
+      || ObStoreRowIterator::IteratorRowLockCheck == iter_type_
+      || !iter_param_->enable_pd_filter()
+      || nullptr == iter_param_->pushdown_filter_
+      || nullptr == iter_param_->get_read_info()) {
+  } else if (OB_FAIL(ObSkipIndexFilterChecker::check_can_skip(
+              *iter_param_->pushdown_filter_, *iter_param_->get_read_info(), index_info, can_skip))) {
+    LOG_WARN("Fail to check skip index with pushdown filter", K(ret), K(index_info));
+  } else if (can_skip) {
+    LOG_DEBUG("[INDEX BLOCK] skip micro block by skip index", K(index_info));
+  }
+  return ret;
+}
+
 //////////////////////////////////////// ObIndexTreeLevelHandle //////////////////////////////////////////////
 
 int ObIndexTreeMultiPassPrefetcher::ObIndexTreeLevelHandle::prefetch(
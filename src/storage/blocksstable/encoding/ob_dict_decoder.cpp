@@ -539,6 +539,40 @@ int ObDictDecoder::batch_decode_dict(
   return ret;
 }
 
+int ObDictDecoder::batch_get_ref_cnts(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t *ref_cnts) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Dict decoder not inited", K(ret));
+  } else if (OB_UNLIKELY(nullptr == row_ids || nullptr == ref_cnts || row_cap < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(row_ids), KP(ref_cnts), K(row_cap));
+  } else {
+    const int64_t dict_count = meta_header_->count_;
+    const unsigned char *col_data = reinterpret_cast<unsigned char *>(
+        const_cast<ObDictMetaHeader *>(meta_header_)) + ctx.col_header_->length_;
+    const bool is_bit_packing = ctx.is_bit_packing();
+    int64_t ref = 0;
+    MEMSET(ref_cnts, 0, sizeof(int64_t) * (dict_count + 2));
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      if (OB_FAIL(read_ref(row_ids[i], is_bit_packing, col_data, ref))) {
+        LOG_WARN("Failed to read dict ref", K(ret), K(i), K(row_ids[i]));
+      } else if (OB_UNLIKELY(ref < 0 || ref > dict_count + 1)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected dict ref", K(ret), K(ref), K(dict_count));
+      } else {
+        ++ref_cnts[ref];
+      }
+    }
+  }
+  return ret;
+}
+
 bool ObDictDecoder::fast_decode_valid(const ObColumnDecoderCtx &ctx) const
 {
   bool valid = false;
@@ -681,6 +715,12 @@ int ObDictDecoder::pushdown_operator(
       }
       break;
     }
+    case sql::WHITE_OP_LI: {
+      if (OB_FAIL(like_operator(parent, col_ctx, col_data, filter, result_bitmap))) {
+        LOG_WARN("Failed to run LIKE operator", K(ret), K(col_ctx));
+      }
+      break;
+    }
     default: {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
@@ -1026,6 +1066,53 @@ int ObDictDecoder::in_operator(
   return ret;
 }
 
+// Pattern is matched once for each dictionary entry, then rows are set by reference.
+int ObDictDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || filter.get_objs().count() != 2
+                  || filter.get_op_type() != sql::WHITE_OP_LI
+                  || filter.null_param_contained())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret),
+             K(col_data), K(result_bitmap.size()), K(filter));
+  } else {
+    const int64_t count = meta_header_->count_;
+    if (count > 0) {
+      bool found = false;
+      ObDictDecoderIterator traverse_it = begin(&col_ctx, col_ctx.col_header_->length_);
+      ObDictDecoderIterator end_it = end(&col_ctx, col_ctx.col_header_->length_);
+      const int64_t ref_bitset_size = meta_header_->count_ + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      int64_t dict_ref = 0;
+      bool is_match = false;
+      while (OB_SUCC(ret) && traverse_it != end_it) {
+        if (OB_FAIL(filter.like_match(*traverse_it, is_match))) {
+          LOG_WARN("Failed to match dictionary entry with like pattern", K(ret), K(*traverse_it));
+        } else if (is_match) {
+          found = true;
+          ref_bitset->set(dict_ref);
+        }
+        ++traverse_it;
+        ++dict_ref;
+      }
+      if (OB_SUCC(ret) && found
+          && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDictDecoder::load_data_to_obj_cell(
     const ObObjMeta cell_meta,
     const char *cell_data,
@@ -94,6 +94,14 @@ public:
       const int64_t meta_length,
       common::ObDatum *datums) const;
 
+  // count rows on each dictionary reference, size of @ref_cnts should be dict count + 2,
+  // the last two slots are row count of null and nop
+  int batch_get_ref_cnts(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      int64_t *ref_cnts) const;
+
   void reset() { this->~ObDictDecoder(); new (this) ObDictDecoder(); }
   OB_INLINE void reuse();
   virtual ObColumnHeader::Type get_type() const override { return type_; }
@@ -163,6 +171,13 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int like_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   int load_data_to_obj_cell(const ObObjMeta cell_meta, const char *cell_data, int64_t cell_len, ObObj &load_obj) const;
 
   int cmp_ref_and_set_res(
@@ -17,6 +17,7 @@
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "ob_bit_stream.h"
 #include "ob_integer_array.h"
+#include "ob_raw_decoder.h"
 
 namespace oceanbase
 {
@@ -25,6 +26,36 @@ namespace blocksstable
 using namespace common;
 const ObColumnHeader::Type ObIntegerBaseDiffDecoder::type_;
 
+ObMultiDimArray_T<int_diff_fix_batch_decode_func, 4, 4> int_diff_fix_batch_decode_funcs;
+
+bool init_int_diff_fix_simd_batch_decode_funcs();
+
+template <int32_t STORE_LEN_TAG, int32_t DATUM_LEN_TAG>
+struct IntDiffFixDecoderArrayInit
+{
+  bool operator()()
+  {
+    int_diff_fix_batch_decode_funcs[STORE_LEN_TAG][DATUM_LEN_TAG]
+        = &(IntDiffFixBatchDecodeFunc_T<STORE_LEN_TAG, DATUM_LEN_TAG>::int_diff_fix_batch_decode_func);
+    return true;
+  }
+};
+
+bool init_int_diff_fix_batch_decode_funcs()
+{
+  bool res = false;
+  res = ObNDArrayIniter<IntDiffFixDecoderArrayInit, 4, 4>::apply();
+  // Dispatch simd version decode funcs
+#if defined ( __x86_64__ )
+  if (is_avx512_valid()) {
+    res = init_int_diff_fix_simd_batch_decode_funcs();
+  }
+#endif
+  return res;
+}
+
+bool int_diff_fix_batch_decode_funcs_inited = init_int_diff_fix_batch_decode_funcs();
+
 int ObIntegerBaseDiffDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
     const ObBitStream &bs, const char *data, const int64_t len) const
 {
@@ -193,6 +224,12 @@ int ObIntegerBaseDiffDecoder::batch_decode(
           ctx, row_ids, row_cap, datum_len, data_offset, datums))) {
         LOG_WARN("Failed to batch unpack delta values", K(ret), K(ctx));
       }
+    } else if (fast_fix_data_valid(ctx) && int_diff_fix_batch_decode_funcs_inited) {
+      // No extend value, so data_offset is zero
+      int_diff_fix_batch_decode_func decode_func = int_diff_fix_batch_decode_funcs
+          [get_value_len_tag_map()[header_->length_]]
+          [get_value_len_tag_map()[datum_len]];
+      decode_func(col_data, base_, row_ids, row_cap, datums);
     } else {
       // Fixed store data
       data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
@@ -215,6 +252,14 @@ int ObIntegerBaseDiffDecoder::batch_decode(
   return ret;
 }
 
+bool ObIntegerBaseDiffDecoder::fast_fix_data_valid(const ObColumnDecoderCtx &ctx) const
+{
+  const int64_t cell_len = header_->length_;
+  return !ctx.has_extend_value()
+      && !ctx.is_bit_packing()
+      && (1 == cell_len || 2 == cell_len || 4 == cell_len || 8 == cell_len);
+}
+
 int ObIntegerBaseDiffDecoder::pushdown_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -396,25 +441,23 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
 
       if (OB_FAIL(ret)) {
       } else if (col_ctx.is_bit_packing()) {
-        for (int64_t row_id = 0;
-            OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-            ++row_id) {
-          if (exist_parent_filter && parent->can_skip_filter(row_id)) {
-          } else if (null_value_contained && result_bitmap.test(row_id)) {
-            if (OB_FAIL(result_bitmap.set(row_id, false))) {
-              LOG_WARN("Failed to set row with null object to false", K(ret));
-            }
-          } else if (OB_FAIL(ObBitStream::get(
-                col_data, data_offset + row_id * cell_len, cell_len, delta_value))) {
-              LOG_WARN("Failed to get bit packing value", K(ret), K_(header));
-          } else {
-            bool cmp_result = fp_int_cmp<uint64_t>(delta_value, param_delta_value, cmp_op_type);
-            if (cmp_result) {
-              if (OB_FAIL(result_bitmap.set(row_id))) {
-                LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
-              }
-            }
-          }
+        if (cell_len < 10) {
+          ret = bitpacked_comparison_operator<ObBitStream::PACKED_LEN_LESS_THAN_10>(
+              parent, col_ctx, col_data, data_offset, cmp_op_type, param_delta_value, result_bitmap);
+        } else if (cell_len < 26) {
+          ret = bitpacked_comparison_operator<ObBitStream::PACKED_LEN_LESS_THAN_26>(
+              parent, col_ctx, col_data, data_offset, cmp_op_type, param_delta_value, result_bitmap);
+        } else {
+          ret = bitpacked_comparison_operator<ObBitStream::DEFAULT>(
+              parent, col_ctx, col_data, data_offset, cmp_op_type, param_delta_value, result_bitmap);
+        }
+        if (OB_FAIL(ret)) {
+          LOG_WARN("Failed to compare bit packed delta values", K(ret), K_(header));
+        }
+      } else if (fast_fix_data_valid(col_ctx) && raw_fix_fast_filter_funcs_inited) {
+        if (OB_FAIL(fast_comparison_operator(
+            col_ctx, col_data, filter.get_op_type(), param_delta_value, result_bitmap))) {
+          LOG_WARN("Failed on fast comparison operator", K(ret), K(col_ctx));
         }
       } else {
         data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
@@ -442,6 +485,86 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
   return ret;
 }
 
+// Compare all fixed length deltas with the simd dispatched filter functions of raw decoder,
+// column should not contain extend value here.
+int ObIntegerBaseDiffDecoder::fast_comparison_operator(
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const sql::ObWhiteFilterOperatorType op_type,
+    const uint64_t param_delta_value,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const uint64_t cell_len = header_->length_;
+  if (cell_len < sizeof(uint64_t) && (param_delta_value >> (cell_len * CHAR_BIT)) > 0) {
+    // Delta in filter is larger than all stored deltas
+    if (sql::WHITE_OP_LT == op_type || sql::WHITE_OP_LE == op_type
+        || sql::WHITE_OP_NE == op_type) {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to set result bitmap to all true", K(ret));
+      }
+    } else {
+      result_bitmap.reuse();
+    }
+  } else {
+    const int64_t cnt = col_ctx.micro_block_header_->row_count_;
+    const int64_t size = sql::ObBitVector::memory_size(cnt);
+    // Use BitVector to set the result of filter here because the memory of ObBitMap is not continuous
+    char buf[size];
+    sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+    bit_vec->reset(cnt);
+
+    // Deltas are always compared as unsigned integer
+    fix_filter_func fast_filter_func = raw_fix_fast_filter_funcs
+        [0]
+        [get_value_len_tag_map()[cell_len]]
+        [op_type];
+    fast_filter_func(cnt, col_data, param_delta_value, *bit_vec);
+
+    // convert bit vector to bitmap
+    if (OB_FAIL(result_bitmap.load_blocks_from_array(reinterpret_cast<uint64_t *>(buf), cnt))) {
+      LOG_WARN("Failed to load bitmap from array on stack", K(ret), KP(buf), K(cnt));
+    }
+  }
+  return ret;
+}
+
+template <ObBitStream::ObBitStreamUnpackType UNPACK_TYPE>
+int ObIntegerBaseDiffDecoder::bitpacked_comparison_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const int64_t data_offset,
+    const ObFPIntCmpOpType cmp_op_type,
+    const uint64_t param_delta_value,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t cell_len = header_->length_;
+  const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+  const int64_t bs_len = cell_len * row_count;
+  const bool null_value_contained = result_bitmap.popcnt() > 0;
+  const bool exist_parent_filter = nullptr != parent;
+  int64_t delta_value = 0;
+  for (int64_t row_id = 0; OB_SUCC(ret) && row_id < row_count; ++row_id) {
+    if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+    } else if (null_value_contained && result_bitmap.test(row_id)) {
+      if (OB_FAIL(result_bitmap.set(row_id, false))) {
+        LOG_WARN("Failed to set row with null object to false", K(ret));
+      }
+    } else if (OB_FAIL(ObBitStream::get<UNPACK_TYPE>(
+        col_data, data_offset + row_id * cell_len, cell_len, bs_len, delta_value))) {
+      LOG_WARN("Failed to get bit packing value", K(ret), K_(header));
+    } else if (fp_int_cmp<uint64_t>(
+        static_cast<uint64_t>(delta_value), param_delta_value, cmp_op_type)) {
+      if (OB_FAIL(result_bitmap.set(row_id))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObIntegerBaseDiffDecoder::bt_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
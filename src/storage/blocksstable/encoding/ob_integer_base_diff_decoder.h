@@ -16,6 +16,7 @@
 
 #include "ob_icolumn_decoder.h"
 #include "ob_encoding_util.h"
+#include "ob_encoding_query_util.h"
 #include "ob_integer_base_diff_encoder.h"
 #include "ob_bit_stream.h"
 
@@ -27,6 +28,13 @@ namespace blocksstable
 struct ObColumnHeader;
 struct ObIntegerBaseDiffHeader;
 
+typedef void (*int_diff_fix_batch_decode_func)(
+            const unsigned char *col_data,
+            const uint64_t base,
+            const int64_t *row_ids,
+            const int64_t row_cap,
+            common::ObDatum *datums);
+
 class ObIntegerBaseDiffDecoder : public ObIColumnDecoder
 {
 public:
@@ -81,6 +89,8 @@ private:
       const int64_t data_offset,
       common::ObDatum *datums) const;
 
+  bool fast_fix_data_valid(const ObColumnDecoderCtx &ctx) const;
+
   template <typename T>
   inline int get_delta(const common::ObObj &cell, uint64_t &delta) const
   {
@@ -97,6 +107,23 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int fast_comparison_operator(
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const sql::ObWhiteFilterOperatorType op_type,
+      const uint64_t param_delta_value,
+      ObBitmap &result_bitmap) const;
+
+  template <ObBitStream::ObBitStreamUnpackType UNPACK_TYPE>
+  int bitpacked_comparison_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const int64_t data_offset,
+      const ObFPIntCmpOpType cmp_op_type,
+      const uint64_t param_delta_value,
+      ObBitmap &result_bitmap) const;
+
   int bt_operator(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
@@ -168,6 +195,33 @@ OB_INLINE void ObIntegerBaseDiffDecoder::reuse()
   base_ = 0;
   */
 }
+
+// Decode fixed length delta values and add @base to them.
+// STORE_LEN_TAG / DATUM_LEN_TAG: {0: 1 byte, 1: 2 bytes, 2: 4 bytes, 3: 8 bytes}
+template <int32_t STORE_LEN_TAG, int32_t DATUM_LEN_TAG>
+struct IntDiffFixBatchDecodeFunc_T
+{
+  static void int_diff_fix_batch_decode_func(
+      const unsigned char *col_data,
+      const uint64_t base,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums)
+  {
+    typedef typename ObEncodingTypeInference<0, STORE_LEN_TAG>::Type StoreType;
+    typedef typename ObEncodingTypeInference<0, DATUM_LEN_TAG>::Type DatumType;
+    const StoreType *deltas = reinterpret_cast<const StoreType *>(col_data);
+    for (int64_t i = 0; i < row_cap; ++i) {
+      *reinterpret_cast<DatumType *>(const_cast<char *>(datums[i].ptr_))
+          = static_cast<DatumType>(base + deltas[row_ids[i]]);
+      datums[i].pack_ = sizeof(DatumType);
+    }
+  }
+};
+
+extern ObMultiDimArray_T<int_diff_fix_batch_decode_func, 4, 4> int_diff_fix_batch_decode_funcs;
+extern bool int_diff_fix_batch_decode_funcs_inited;
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
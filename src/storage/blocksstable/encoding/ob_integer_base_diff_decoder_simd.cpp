@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_query_util.h"
+#include "ob_integer_base_diff_decoder.h"
+
+namespace oceanbase {
+namespace blocksstable {
+
+template <int32_t STORE_LEN_TAG, int32_t DATUM_LEN_TAG>
+struct IntDiffFixBatchDecodeAVX512Func_T
+    : public IntDiffFixBatchDecodeFunc_T<STORE_LEN_TAG, DATUM_LEN_TAG>
+{};
+
+// There is no AVX2 variant: the datums hold independent pointers and AVX2 has no
+// scatter, so it would be the scalar store loop behind a gather.
+#if defined ( __AVX512BW__ )
+// ObDatum is packed, ptr_ and pack_ of 8 continuous datums are addressed by byte offsets.
+OB_INLINE static __m512i get_datum_offsets()
+{
+  const int64_t size = sizeof(common::ObDatum);
+  return _mm512_setr_epi64(0, size, 2 * size, 3 * size, 4 * size, 5 * size, 6 * size, 7 * size);
+}
+
+OB_INLINE static __mmask8 get_row_mask(const int64_t row_cnt)
+{
+  return row_cnt >= 8 ? 0xFF : static_cast<__mmask8>((1 << row_cnt) - 1);
+}
+
+// Gather ptr_ of datums and set pack_ to @datum_len, returns the data pointers
+OB_INLINE static __m512i prepare_datums(
+    const __mmask8 mask,
+    const __m512i offset_vec,
+    const uint32_t datum_len,
+    common::ObDatum *datums)
+{
+  char *datum_base = reinterpret_cast<char *>(datums);
+  _mm512_mask_i64scatter_epi32(datum_base + sizeof(common::ObDatumPtr), mask, offset_vec,
+      _mm256_set1_epi32(datum_len), 1);
+  return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask, offset_vec, datum_base, 1);
+}
+
+template <>
+struct IntDiffFixBatchDecodeAVX512Func_T<3, 3>
+{
+  // Gather 8 byte deltas by row ids, add base and scatter to datums
+  static void int_diff_fix_batch_decode_func(
+      const unsigned char *col_data,
+      const uint64_t base,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums)
+  {
+    const __m512i base_vec = _mm512_set1_epi64(base);
+    const __m512i offset_vec = get_datum_offsets();
+    for (int64_t i = 0; i < row_cap; i += 8) {
+      const __mmask8 mask = get_row_mask(row_cap - i);
+      const __m512i idx_vec = _mm512_maskz_loadu_epi64(mask, row_ids + i);
+      __m512i value_vec = _mm512_mask_i64gather_epi64(
+          _mm512_setzero_si512(), mask, idx_vec, col_data, sizeof(uint64_t));
+      value_vec = _mm512_add_epi64(value_vec, base_vec);
+      const __m512i ptr_vec = prepare_datums(mask, offset_vec, sizeof(uint64_t), datums + i);
+      _mm512_mask_i64scatter_epi64(nullptr, mask, ptr_vec, value_vec, 1);
+    }
+  }
+};
+
+template <>
+struct IntDiffFixBatchDecodeAVX512Func_T<2, 3>
+{
+  // Gather 4 byte deltas by row ids, widen to 8 bytes, add base and scatter to datums
+  static void int_diff_fix_batch_decode_func(
+      const unsigned char *col_data,
+      const uint64_t base,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums)
+  {
+    const __m512i base_vec = _mm512_set1_epi64(base);
+    const __m512i offset_vec = get_datum_offsets();
+    for (int64_t i = 0; i < row_cap; i += 8) {
+      const __mmask8 mask = get_row_mask(row_cap - i);
+      const __m512i idx_vec = _mm512_maskz_loadu_epi64(mask, row_ids + i);
+      const __m256i delta_vec = _mm512_mask_i64gather_epi32(
+          _mm256_setzero_si256(), mask, idx_vec, col_data, sizeof(uint32_t));
+      const __m512i value_vec = _mm512_add_epi64(_mm512_cvtepu32_epi64(delta_vec), base_vec);
+      const __m512i ptr_vec = prepare_datums(mask, offset_vec, sizeof(uint64_t), datums + i);
+      _mm512_mask_i64scatter_epi64(nullptr, mask, ptr_vec, value_vec, 1);
+    }
+  }
+};
+
+template <>
+struct IntDiffFixBatchDecodeAVX512Func_T<2, 2>
+{
+  // Gather 4 byte deltas by row ids, add base and scatter to 4 byte datums
+  static void int_diff_fix_batch_decode_func(
+      const unsigned char *col_data,
+      const uint64_t base,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums)
+  {
+    const __m256i base_vec = _mm256_set1_epi32(static_cast<uint32_t>(base));
+    const __m512i offset_vec = get_datum_offsets();
+    for (int64_t i = 0; i < row_cap; i += 8) {
+      const __mmask8 mask = get_row_mask(row_cap - i);
+      const __m512i idx_vec = _mm512_maskz_loadu_epi64(mask, row_ids + i);
+      __m256i value_vec = _mm512_mask_i64gather_epi32(
+          _mm256_setzero_si256(), mask, idx_vec, col_data, sizeof(uint32_t));
+      value_vec = _mm256_add_epi32(value_vec, base_vec);
+      const __m512i ptr_vec = prepare_datums(mask, offset_vec, sizeof(uint32_t), datums + i);
+      _mm512_mask_i64scatter_epi32(nullptr, mask, ptr_vec, value_vec, 1);
+    }
+  }
+};
+#endif
+
+template <int32_t STORE_LEN_TAG, int32_t DATUM_LEN_TAG>
+struct IntDiffFixDecoderAVX512ArrayInit
+{
+  bool operator()()
+  {
+    int_diff_fix_batch_decode_funcs[STORE_LEN_TAG][DATUM_LEN_TAG]
+        = &(IntDiffFixBatchDecodeAVX512Func_T<STORE_LEN_TAG, DATUM_LEN_TAG>::int_diff_fix_batch_decode_func);
+    return true;
+  }
+};
+
+bool init_int_diff_fix_simd_batch_decode_funcs()
+{
+  return ObNDArrayIniter<IntDiffFixDecoderAVX512ArrayInit, 4, 4>::apply();
+}
+
+} // end of namespace blocksstable
+} // end of namespace oceanbase
@@ -14,6 +14,7 @@
 #include "ob_micro_block_decoder.h"
 #include "share/rc/ob_tenant_base.h"
 #include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_aggregated_store.h"
 
 namespace oceanbase
 {
@@ -2108,6 +2109,77 @@ int ObMicroBlockDecoder::get_min_or_max(
   return ret;
 }
 
+int ObMicroBlockDecoder::get_aggregate_result(
+    const int32_t col_id,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    ObDatum *datum_buf,
+    storage::ObAggCell &agg_cell)
+{
+  int ret = OB_SUCCESS;
+  decoder_allocator_.reuse();
+  // col_id is checked by get_col_datums the same as get_min_or_max
+  if (agg_cell.support_weighted_eval() &&
+      col_id < header_->column_count_ &&
+      ObColumnHeader::DICT == decoders_[col_id].decoder_->get_type() &&
+      static_cast<const ObDictDecoder *>(decoders_[col_id].decoder_)->get_dict_header()->count_ < row_cap) {
+    if (OB_FAIL(get_dict_aggregate_result(col_id, row_ids, row_cap, agg_cell))) {
+      LOG_WARN("Failed to aggregate on dict", K(ret), K(col_id), K(row_cap));
+    }
+  } else if (OB_FAIL(get_col_datums(col_id, row_ids, cell_datas, row_cap, datum_buf))) {
+    LOG_WARN("Failed to get col datums", K(ret), K(col_id), K(row_cap));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      if (datum_buf[i].is_nop()) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected datum, can not process in batch", K(ret), K(i));
+      } else if (OB_FAIL(agg_cell.eval(datum_buf[i]))) {
+        LOG_WARN("Failed to eval agg cell", K(ret), K(i), K(datum_buf[i]), K(agg_cell));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockDecoder::get_dict_aggregate_result(
+    const int32_t col_id,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    storage::ObAggCell &agg_cell)
+{
+  int ret = OB_SUCCESS;
+  const ObDictDecoder *dict_decoder = static_cast<const ObDictDecoder *>(decoders_[col_id].decoder_);
+  const ObColumnDecoderCtx &ctx = *decoders_[col_id].ctx_;
+  const int64_t dict_count = dict_decoder->get_dict_header()->count_;
+  int64_t *ref_cnts = nullptr;
+  if (OB_ISNULL(ref_cnts = static_cast<int64_t *>(decoder_allocator_.alloc(sizeof(int64_t) * (dict_count + 2))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc ref cnts", K(ret), K(dict_count));
+  } else if (OB_FAIL(dict_decoder->batch_get_ref_cnts(ctx, row_ids, row_cap, ref_cnts))) {
+    LOG_WARN("Failed to get dict ref cnts", K(ret), K(col_id), K(row_cap));
+  } else if (OB_UNLIKELY(0 != ref_cnts[dict_count + 1])) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected nop datum, can not process in batch", K(ret), K(col_id), K(ref_cnts[dict_count + 1]));
+  } else {
+    // null rows are counted in the slot of dict count
+    common::ObObj cell;
+    ObStorageDatum datum;
+    for (int64_t ref = 0; OB_SUCC(ret) && ref <= dict_count; ++ref) {
+      if (0 == ref_cnts[ref]) {
+      } else if (OB_FAIL(dict_decoder->decode(ctx.obj_meta_, cell, ref, ctx.col_header_->length_))) {
+        LOG_WARN("Failed to decode dict value", K(ret), K(ref), K(dict_count));
+      } else if (OB_FAIL(datum.from_obj_enhance(cell))) {
+        LOG_WARN("Failed to convert obj to datum", K(ret), K(cell));
+      } else if (OB_FAIL(agg_cell.eval(datum, ref_cnts[ref]))) {
+        LOG_WARN("Failed to eval agg cell", K(ret), K(ref), K(datum), K(ref_cnts[ref]), K(agg_cell));
+      }
+    }
+  }
+  LOG_DEBUG("aggregate on dict", K(ret), K(col_id), K(row_cap), K(dict_count));
+  return ret;
+}
+
 int ObMicroBlockDecoder::get_col_datums(
     int32_t col_id,
     const int64_t *row_ids,
@@ -26,6 +26,7 @@ namespace oceanbase
 {
 namespace storage {
 struct PushdownFilterInfo;
+class ObAggCell;
 }
 namespace blocksstable
 {
@@ -266,6 +267,15 @@ public:
       const int64_t row_cap,
       ObDatum *datum_buf,
       ObMicroBlockAggInfo<ObDatum> &agg_info);
+  // aggregate column of @row_ids into @agg_cell, dictionary encoded column is aggregated
+  // on each distinct dictionary value instead of each row
+  int get_aggregate_result(
+      const int32_t col_id,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      ObDatum *datum_buf,
+      storage::ObAggCell &agg_cell);
   virtual int64_t get_column_count() const override
   {
     OB_ASSERT(nullptr != header_);
@@ -306,6 +316,11 @@ private:
                      const char **cell_datas,
                      const int64_t row_cap,
                      common::ObDatum *col_datums);
+  int get_dict_aggregate_result(
+      const int32_t col_id,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      storage::ObAggCell &agg_cell);
   //TODO @hanhui deleted after change rowkey to datum
   int decode_cells(const uint64_t row_id,
                    const int64_t row_len,
@@ -166,6 +166,14 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int like_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   int load_data_to_obj_cell(const ObObjMeta cell_meta, const char *cell_data, int64_t cell_len, ObObj &load_obj) const;
 
   int traverse_all_data(
@@ -65,56 +65,23 @@ int ObStringPrefixDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell,
           LOG_WARN("locate cell data failed", K(ret), K(len),
               K(ctx), "header", *meta_header_);
         } else {
-          // get prefix
-          const ObStringPrefixCellHeader *cell_header =
-              reinterpret_cast<const ObStringPrefixCellHeader *>(cell_data);
           ObIntegerArrayGenerator meta_gen;
           const char *var_data = meta_data_
             + (meta_header_->count_ - 1) * meta_header_->prefix_index_byte_;
-          const char *prefix_str = NULL;
+          char *buf = NULL;
+          int64_t str_len = 0;
+          const static uint32_t min_buf_size = 128;
+          const int64_t buf_size = std::max(meta_header_->max_string_size_, min_buf_size);
           if (OB_FAIL(meta_gen.init(meta_data_, meta_header_->prefix_index_byte_))) {
             LOG_WARN("failed to init integer array generator", K(ret),
                 KP_(meta_data), "prefix index byte", meta_header_->prefix_index_byte_);
+          } else if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_size)))) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_WARN("fail to allocate memory", K(ret), K(buf_size));
           } else {
-            int64_t offset = 0;
-            if (0 != cell_header->get_ref()) {
-              offset = meta_gen.get_array().at(cell_header->get_ref() - 1);
-            }
-            prefix_str = var_data + offset;
-          }
-
-          char *buf = NULL;
-          if (OB_SUCC(ret)) {
-            const static uint32_t min_buf_size = 128;
-            const int64_t buf_size = std::max(meta_header_->max_string_size_, min_buf_size);
-            if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_size)))) {
-              ret = OB_ALLOCATE_MEMORY_FAILED;
-              LOG_WARN("fail to allocate memory", K(ret), K(buf_size));
-            }
-          }
-
-          // fill data
-          if (OB_SUCC(ret)) {
-            char *string = buf;
-            cell_data += sizeof(ObStringPrefixCellHeader);
-            cell_len -= sizeof(ObStringPrefixCellHeader);
-            MEMCPY(string, prefix_str, cell_header->len_);
-            if (meta_header_->is_hex_packing()) {
-              int64_t str_len = cell_len * 2 - cell_header->get_odd();
-              ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
-                  reinterpret_cast<const unsigned char *>(cell_data));
-              for (int64_t i = cell_header->len_; i < str_len + cell_header->len_; ++i) {
-                string[i] = static_cast<char>(unpacker.unpack());
-              }
-              cell.val_len_ = static_cast<int32_t>(cell_header->len_ + str_len);
-              cell.v_.string_ = string;
-              //LOG_DEBUG("debug: fill hex data", K(cell_header->len_), K(cell_len), K(str_len));
-            } else {
-              MEMCPY(string + cell_header->len_, cell_data, cell_len);
-              cell.val_len_ = static_cast<int32_t>(cell_header->len_ + cell_len);
-              cell.v_.string_ = string;
-              //LOG_DEBUG("debug: fill data", K(cell_header->len_), K(cell_len));
-            }
+            fill_string(cell_data, cell_len, var_data, meta_gen, buf, str_len);
+            cell.val_len_ = static_cast<int32_t>(str_len);
+            cell.v_.string_ = buf;
           }
         }
       }
@@ -123,6 +90,37 @@ int ObStringPrefixDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell,
   return ret;
 }
 
+void ObStringPrefixDecoder::fill_string(
+    const char *cell_data,
+    const int64_t cell_len,
+    const char *var_data,
+    const ObIntegerArrayGenerator &meta_gen,
+    char *buf,
+    int64_t &str_len) const
+{
+  const ObStringPrefixCellHeader *cell_header =
+      reinterpret_cast<const ObStringPrefixCellHeader *>(cell_data);
+  const char *suffix = cell_data + sizeof(ObStringPrefixCellHeader);
+  const int64_t suffix_len = cell_len - sizeof(ObStringPrefixCellHeader);
+  int64_t offset = 0;
+  if (0 != cell_header->get_ref()) {
+    offset = meta_gen.get_array().at(cell_header->get_ref() - 1);
+  }
+  MEMCPY(buf, var_data + offset, cell_header->len_);
+  if (meta_header_->is_hex_packing()) {
+    str_len = suffix_len * 2 - cell_header->get_odd();
+    ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
+        reinterpret_cast<const unsigned char *>(suffix));
+    for (int64_t i = cell_header->len_; i < str_len + cell_header->len_; ++i) {
+      buf[i] = static_cast<char>(unpacker.unpack());
+    }
+  } else {
+    str_len = suffix_len;
+    MEMCPY(buf + cell_header->len_, suffix, suffix_len);
+  }
+  str_len += cell_header->len_;
+}
+
 int ObStringPrefixDecoder::update_pointer(const char *old_block, const char *cur_block)
 {
   int ret = OB_SUCCESS;
@@ -174,14 +172,13 @@ int ObStringPrefixDecoder::batch_decode(
         LOG_WARN("Failed to init integer array generator", K(ret), KP_(meta_data),
             "Prefix index byte", meta_header_->prefix_index_byte_);
       } else {
-        const ObStringPrefixCellHeader *cell_header = nullptr;
         const char *var_data = meta_data_
             + (meta_header_->count_ - 1) * meta_header_->prefix_index_byte_;
-        const char *prefix_str = nullptr;
         char *string = nullptr;
         int64_t row_id = 0;
         const char *cell_data = nullptr;
         int64_t cell_len = 0;
+        int64_t str_len = 0;
         for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
           row_id = row_ids[i];
           string = buf + i * buf_size;
@@ -193,29 +190,9 @@ int ObStringPrefixDecoder::batch_decode(
               *ctx.micro_block_header_, *ctx.col_header_, *meta_header_))) {
             LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(ctx));
           } else {
-            cell_header = reinterpret_cast<const ObStringPrefixCellHeader *>(cell_data);
-            int64_t offset = 0;
-            if (0 != cell_header->get_ref()) {
-              offset = meta_gen.get_array().at(cell_header->get_ref() - 1);
-            }
-            prefix_str = var_data + offset;
-            cell_data += sizeof(ObStringPrefixCellHeader);
-            cell_len -= sizeof(ObStringPrefixCellHeader);
-            MEMCPY(string, prefix_str, cell_header->len_);
-            if (meta_header_->is_hex_packing()) {
-              int64_t str_len = cell_len * 2 - cell_header->get_odd();
-              ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
-                  reinterpret_cast<const unsigned char *>(cell_data));
-              for (int64_t j = cell_header->len_; j < str_len + cell_header->len_; ++j) {
-                string[j] = static_cast<char>(unpacker.unpack());
-              }
-              datums[i].pack_ = static_cast<int32_t>(cell_header->len_ + str_len);
-              datums[i].ptr_ = string;
-            } else {
-              MEMCPY(string + cell_header->len_, cell_data, cell_len);
-              datums[i].pack_ = static_cast<uint32_t>(cell_header->len_ + cell_len);
-              datums[i].ptr_ = string;
-            }
+            fill_string(cell_data, cell_len, var_data, meta_gen, string, str_len);
+            datums[i].pack_ = static_cast<uint32_t>(str_len);
+            datums[i].ptr_ = string;
           }
         }
       }
@@ -247,5 +224,110 @@ int ObStringPrefixDecoder::get_null_count(
   return ret;
 }
 
+/**
+ * Filter push down operator for string prefix encoding.
+ * Only LIKE is evaluated natively: rows are rebuilt from prefix and suffix into one reused
+ * buffer and matched one by one, other operators go through the retrograde path.
+ */
+int ObStringPrefixDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("StringPrefix decoder is not inited", K(ret));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid op type for pushed down white filter", K(ret), K(op_type));
+  } else if (sql::WHITE_OP_LI == op_type) {
+    if (OB_FAIL(like_operator(parent, col_ctx, row_index, filter, result_bitmap))) {
+      LOG_WARN("Failed to run LIKE operator", K(ret), K(col_ctx));
+    }
+  } else {
+    ret = OB_NOT_SUPPORTED;
+    LOG_TRACE("Pushed down filter operator type not supported", K(ret), K(op_type));
+  }
+  return ret;
+}
+
+int ObStringPrefixDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  ObIntegerArrayGenerator meta_gen;
+  char *buf = nullptr;
+  const static uint32_t min_buf_size = 128;
+  const int64_t buf_size = std::max(meta_header_->max_string_size_, min_buf_size);
+  if (OB_UNLIKELY(NULL == row_index
+                  || filter.get_objs().count() != 2
+                  || result_bitmap.size() != col_ctx.micro_block_header_->row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret), KP(row_index),
+             K(result_bitmap.size()), K(filter));
+  } else if (OB_FAIL(get_is_null_bitmap_from_var_column(col_ctx, row_index, result_bitmap))) {
+    LOG_WARN("Failed to get isnull bitmap from variable column", K(ret), K(col_ctx));
+  } else if (OB_ISNULL(buf = static_cast<char *>(col_ctx.allocator_->alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), K(buf_size));
+  } else if (OB_FAIL(meta_gen.init(meta_data_, meta_header_->prefix_index_byte_))) {
+    LOG_WARN("Failed to init integer array generator", K(ret), KP_(meta_data),
+        "Prefix index byte", meta_header_->prefix_index_byte_);
+  } else {
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    const char *var_data = meta_data_
+        + (meta_header_->count_ - 1) * meta_header_->prefix_index_byte_;
+    const char *row_data = nullptr;
+    int64_t row_len = 0;
+    const char *cell_data = nullptr;
+    int64_t cell_len = 0;
+    int64_t str_len = 0;
+    ObObj cur_obj;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        // object in this row is null
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+        LOG_WARN("Failed to locate row data", K(ret), K(row_id));
+      } else if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len, row_data, row_len,
+          *col_ctx.micro_block_header_, *col_ctx.col_header_, *meta_header_))) {
+        LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(col_ctx));
+      } else {
+        fill_string(cell_data, cell_len, var_data, meta_gen, buf, str_len);
+        cur_obj.set_meta_type(col_ctx.obj_meta_);
+        cur_obj.val_len_ = static_cast<int32_t>(str_len);
+        cur_obj.v_.string_ = buf;
+        bool is_match = false;
+        if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_
+            && OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                           *col_ctx.allocator_, cur_obj))) {
+          LOG_WARN("Failed to pad column", K(ret), K(row_id));
+        } else if (OB_FAIL(filter.like_match(cur_obj, is_match))) {
+          LOG_WARN("Failed to match object with like pattern", K(ret), K(row_id), K(cur_obj));
+        } else if (is_match && OB_FAIL(result_bitmap.set(row_id))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
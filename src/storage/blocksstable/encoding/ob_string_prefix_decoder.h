@@ -26,6 +26,7 @@ namespace blocksstable
 struct ObColumnHeader;
 struct ObStringPrefixMetaHeader;
 struct ObStringPrefixCellHeader;
+class ObIntegerArrayGenerator;
 
 class ObStringPrefixDecoder : public ObIColumnDecoder
 {
@@ -62,6 +63,29 @@ public:
       const int64_t *row_ids,
       const int64_t row_cap,
       int64_t &null_count) const override;
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+private:
+  int like_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+  // rebuild string of cell (prefix in meta + suffix in cell) into buf
+  void fill_string(
+      const char *cell_data,
+      const int64_t cell_len,
+      const char *var_data,
+      const ObIntegerArrayGenerator &meta_gen,
+      char *buf,
+      int64_t &str_len) const;
 private:
   const ObStringPrefixMetaHeader *meta_header_;
   const char *meta_data_;
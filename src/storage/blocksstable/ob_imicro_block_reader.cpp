@@ -192,6 +192,15 @@ int ObIMicroBlockReader::filter_white_filter(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        bool is_match = false;
+        if (OB_FAIL(filter.like_match(obj, is_match))) {
+          LOG_WARN("Failed to match object with like pattern", K(ret), K(obj));
+        } else if (is_match) {
+          filtered = false;
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
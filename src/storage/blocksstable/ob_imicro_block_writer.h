@@ -27,6 +27,7 @@ namespace oceanbase
 {
 namespace blocksstable
 {
+class ObSkipIndexAggregator;
 struct ObMicroBlockDesc
 {
   ObDatumRowkey last_rowkey_;
@@ -48,6 +49,7 @@ struct ObMicroBlockDesc
   bool has_string_out_row_;
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
+  const ObSkipIndexAggregator *aggregator_; // skip index of data block, null if not collected
 
   ObMicroBlockDesc() { reset(); }
   bool is_valid() const;
@@ -72,6 +74,7 @@ struct ObMicroBlockDesc
       K_(has_string_out_row),
       K_(has_lob_out_row),
       K_(is_last_row_last_flag),
+      KP_(aggregator),
       K_(original_size));
 };
 enum MICRO_BLOCK_MERGE_VERIFY_LEVEL
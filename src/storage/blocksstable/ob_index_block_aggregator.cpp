@@ -0,0 +1,394 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_index_block_aggregator.h"
+#include "common/object/ob_obj_compare.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+#include "storage/access/ob_table_read_info.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+namespace blocksstable
+{
+
+ObSkipIndexAggregator::ObSkipIndexAggregator()
+  : col_metas_(), cmp_funcs_(), fixed_lens_(), col_valids_(),
+    col_cnt_(0), row_count_(0), is_inited_(false)
+{
+}
+
+void ObSkipIndexAggregator::reset()
+{
+  for (int64_t i = 0; i < MAX_SKIP_INDEX_COL_CNT; ++i) {
+    col_metas_[i].reset();
+    cmp_funcs_[i] = nullptr;
+    fixed_lens_[i] = 0;
+    col_valids_[i] = false;
+  }
+  col_cnt_ = 0;
+  row_count_ = 0;
+  is_inited_ = false;
+}
+
+void ObSkipIndexAggregator::reuse()
+{
+  for (int64_t i = 0; i < col_cnt_; ++i) {
+    ObSkipIndexColMeta &col_meta = col_metas_[i];
+    col_meta.datum_len_ = 0;
+    col_meta.null_count_ = 0;
+    col_valids_[i] = true;
+  }
+  row_count_ = 0;
+}
+
+int ObSkipIndexAggregator::init(const ObDataStoreDesc &data_store_desc)
+{
+  int ret = OB_SUCCESS;
+  const ObStoreCmpFuncs &cmp_funcs = data_store_desc.datum_utils_.get_cmp_funcs();
+  const ObIArray<share::schema::ObColDesc> &col_descs = data_store_desc.col_desc_array_;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Init twice", K(ret));
+  } else if (OB_UNLIKELY(!data_store_desc.is_valid()
+      || !data_store_desc.datum_utils_.is_valid()
+      || cmp_funcs.count() != col_descs.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid data store desc to init skip index aggregator", K(ret), K(data_store_desc),
+        "cmp_func_cnt", cmp_funcs.count(), "col_desc_cnt", col_descs.count());
+  } else {
+    reset();
+    const int64_t extra_rowkey_start = data_store_desc.schema_rowkey_col_cnt_;
+    const int64_t extra_rowkey_end = data_store_desc.rowkey_column_count_;
+    for (int64_t i = 0; i < col_descs.count() && col_cnt_ < MAX_SKIP_INDEX_COL_CNT; ++i) {
+      const ObObjType obj_type = col_descs.at(i).col_type_.get_type();
+      const ObObjDatumMapType map_type = ObDatum::get_obj_datum_map_type(obj_type);
+      if (i >= extra_rowkey_start && i < extra_rowkey_end) {
+        // skip multi-version columns
+      } else if (OBJ_DATUM_8BYTE_DATA == map_type
+          || OBJ_DATUM_4BYTE_DATA == map_type
+          || OBJ_DATUM_1BYTE_DATA == map_type) {
+        ObSkipIndexColMeta &col_meta = col_metas_[col_cnt_];
+        col_meta.col_idx_ = static_cast<uint16_t>(i);
+        col_meta.obj_type_ = static_cast<uint8_t>(obj_type);
+        cmp_funcs_[col_cnt_] = &cmp_funcs.at(i);
+        fixed_lens_[col_cnt_] = static_cast<uint8_t>(ObDatum::get_reserved_size(map_type));
+        ++col_cnt_;
+      }
+    }
+    reuse();
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval(const ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      ObSkipIndexColMeta &col_meta = col_metas_[i];
+      if (!col_valids_[i]) {
+      } else if (OB_UNLIKELY(col_meta.col_idx_ >= row.get_column_count())) {
+        col_valids_[i] = false;
+      } else {
+        const ObStorageDatum &datum = row.storage_datums_[col_meta.col_idx_];
+        if (datum.is_null()) {
+          ++col_meta.null_count_;
+        } else if (datum.is_ext() || datum.len_ != fixed_lens_[i]) {
+          col_valids_[i] = false;
+        } else if (OB_FAIL(update_min_max(i, datum))) {
+          LOG_WARN("Fail to update min max of skip index", K(ret), K(i), K(datum), K(col_meta));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ++row_count_;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::update_min_max(const int64_t idx, const ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  ObSkipIndexColMeta &col_meta = col_metas_[idx];
+  if (!col_meta.has_min_max()) {
+    MEMCPY(col_meta.min_, datum.ptr_, datum.len_);
+    MEMCPY(col_meta.max_, datum.ptr_, datum.len_);
+    col_meta.datum_len_ = static_cast<uint8_t>(datum.len_);
+  } else {
+    int cmp_ret = 0;
+    ObStorageDatum bound;
+    col_meta.get_min_datum(bound);
+    if (OB_FAIL(cmp_funcs_[idx]->compare(datum, bound, cmp_ret))) {
+      LOG_WARN("Fail to compare with min datum", K(ret), K(datum), K(bound));
+    } else if (cmp_ret < 0) {
+      MEMCPY(col_meta.min_, datum.ptr_, datum.len_);
+    } else {
+      col_meta.get_max_datum(bound);
+      if (OB_FAIL(cmp_funcs_[idx]->compare(datum, bound, cmp_ret))) {
+        LOG_WARN("Fail to compare with max datum", K(ret), K(datum), K(bound));
+      } else if (cmp_ret > 0) {
+        MEMCPY(col_meta.max_, datum.ptr_, datum.len_);
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObSkipIndexAggregator::get_serialize_size() const
+{
+  int64_t valid_col_cnt = 0;
+  for (int64_t i = 0; i < col_cnt_; ++i) {
+    if (col_valids_[i]) {
+      ++valid_col_cnt;
+    }
+  }
+  return (0 == row_count_ || 0 == valid_col_cnt)
+      ? 0 : sizeof(ObSkipIndexHeader) + valid_col_cnt * sizeof(ObSkipIndexColMeta);
+}
+
+int ObSkipIndexAggregator::serialize(char *buf, const int64_t buf_len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t serialize_size = get_serialize_size();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (OB_ISNULL(buf) || OB_UNLIKELY(0 == serialize_size || pos + serialize_size > buf_len)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument to serialize skip index", K(ret), KP(buf), K(buf_len), K(pos), K(serialize_size));
+  } else {
+    ObSkipIndexHeader *header = reinterpret_cast<ObSkipIndexHeader *>(buf + pos);
+    header->version_ = ObSkipIndexHeader::SKIP_INDEX_VERSION_V1;
+    header->col_cnt_ = 0;
+    header->reserved_ = 0;
+    pos += sizeof(ObSkipIndexHeader);
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      if (col_valids_[i]) {
+        MEMCPY(buf + pos, &col_metas_[i], sizeof(ObSkipIndexColMeta));
+        pos += sizeof(ObSkipIndexColMeta);
+        ++header->col_cnt_;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterChecker::check_can_skip(
+    const sql::ObPushdownFilterExecutor &filter,
+    const ObTableReadInfo &read_info,
+    const ObMicroIndexInfo &index_info,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  if (!index_info.has_skip_index()) {
+  } else if (filter.is_filter_white_node()) {
+    if (OB_FAIL(check_white_filter(static_cast<const sql::ObWhiteFilterExecutor &>(filter),
+                                   read_info, index_info, can_skip))) {
+      LOG_WARN("Fail to check white filter", K(ret), K(filter));
+    }
+  } else if (filter.is_logic_op_node()) {
+    const bool is_and = filter.is_logic_and_node();
+    sql::ObPushdownFilterExecutor **childs = filter.get_childs();
+    if (OB_UNLIKELY(0 == filter.get_child_count() || nullptr == childs)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected logic filter without child", K(ret), K(filter));
+    } else {
+      // AND: skip if any child could skip, OR: skip only if all children could skip
+      can_skip = !is_and;
+      for (uint32_t i = 0; OB_SUCC(ret) && i < filter.get_child_count(); ++i) {
+        bool child_can_skip = false;
+        if (OB_ISNULL(childs[i])) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("Unexpected null child filter", K(ret), K(i));
+        } else if (OB_FAIL(check_can_skip(*childs[i], read_info, index_info, child_can_skip))) {
+          LOG_WARN("Fail to check child filter", K(ret), K(i));
+        } else if (is_and && child_can_skip) {
+          can_skip = true;
+          break;
+        } else if (!is_and && !child_can_skip) {
+          can_skip = false;
+          break;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterChecker::check_white_filter(
+    const sql::ObWhiteFilterExecutor &filter,
+    const ObTableReadInfo &read_info,
+    const ObMicroIndexInfo &index_info,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  const ObIArray<int32_t> &col_offsets = filter.get_col_offsets();
+  const ObIArray<int32_t> &cols_index = read_info.get_columns_index();
+  const ObColDescIArray &cols_desc = read_info.get_columns_desc();
+  const ObSkipIndexColMeta *col_meta = nullptr;
+  int64_t col_offset = 0;
+  int64_t col_idx = 0;
+  if (1 != col_offsets.count()) {
+  } else if (FALSE_IT(col_offset = col_offsets.at(0))) {
+  } else if (col_offset < 0 || col_offset >= cols_index.count() || col_offset >= cols_desc.count()) {
+  } else if ((col_idx = cols_index.at(col_offset)) < 0) {
+    // column not stored in sstable
+  } else if (OB_ISNULL(col_meta = index_info.skip_index_->get_col_meta(col_idx))) {
+  } else if (col_meta->obj_type_ != static_cast<uint8_t>(cols_desc.at(col_offset).col_type_.get_type())) {
+    // column type changed after the block was built
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    switch (op_type) {
+      case sql::WHITE_OP_NU: {
+        can_skip = 0 == col_meta->null_count_;
+        break;
+      }
+      case sql::WHITE_OP_NN: {
+        can_skip = col_meta->null_count_ == index_info.get_row_count();
+        break;
+      }
+      case sql::WHITE_OP_EQ:
+      case sql::WHITE_OP_NE:
+      case sql::WHITE_OP_GT:
+      case sql::WHITE_OP_GE:
+      case sql::WHITE_OP_LT:
+      case sql::WHITE_OP_LE:
+      case sql::WHITE_OP_BT:
+      case sql::WHITE_OP_IN: {
+        if (sql::WHITE_OP_IN == op_type && filter.null_param_contained()) {
+          // null value may be matched by null param in set
+        } else if (!col_meta->has_min_max()) {
+          // compare with null is always null
+          can_skip = true;
+        } else {
+          const ObObjMeta &col_type = cols_desc.at(col_offset).col_type_;
+          ObStorageDatum min_datum;
+          ObStorageDatum max_datum;
+          ObObj min_obj;
+          ObObj max_obj;
+          col_meta->get_min_datum(min_datum);
+          col_meta->get_max_datum(max_datum);
+          if (OB_FAIL(min_datum.to_obj_enhance(min_obj, col_type))) {
+            LOG_WARN("Fail to transfer min datum to obj", K(ret), K(min_datum), K(col_type));
+          } else if (OB_FAIL(max_datum.to_obj_enhance(max_obj, col_type))) {
+            LOG_WARN("Fail to transfer max datum to obj", K(ret), K(max_datum), K(col_type));
+          } else if (OB_FAIL(check_by_min_max(filter, min_obj, max_obj, can_skip))) {
+            LOG_WARN("Fail to check filter by min max", K(ret), K(min_obj), K(max_obj));
+          }
+        }
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterChecker::check_by_min_max(
+    const sql::ObWhiteFilterExecutor &filter,
+    const ObObj &min_obj,
+    const ObObj &max_obj,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  const ObIArray<ObObj> &ref_objs = filter.get_objs();
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const ObCollationType cs_type = min_obj.get_collation_type();
+  int min_cmp = 0;
+  int max_cmp = 0;
+  switch (op_type) {
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE:
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT:
+    case sql::WHITE_OP_LE: {
+      if (OB_UNLIKELY(ref_objs.count() != 1)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("Invalid argument for comparison operator", K(ret), K(ref_objs));
+      } else if ((lib::is_mysql_mode() && ref_objs.at(0).is_null())
+                  || (lib::is_oracle_mode() && ref_objs.at(0).is_null_oracle())) {
+        can_skip = true;
+      } else if (OB_FAIL(ObObjCmpFuncs::compare(min_obj, ref_objs.at(0), cs_type, min_cmp))) {
+        LOG_WARN("Fail to compare min obj", K(ret), K(min_obj), K(ref_objs));
+      } else if (OB_FAIL(ObObjCmpFuncs::compare(max_obj, ref_objs.at(0), cs_type, max_cmp))) {
+        LOG_WARN("Fail to compare max obj", K(ret), K(max_obj), K(ref_objs));
+      } else if (sql::WHITE_OP_EQ == op_type) {
+        can_skip = min_cmp > 0 || max_cmp < 0;
+      } else if (sql::WHITE_OP_NE == op_type) {
+        can_skip = 0 == min_cmp && 0 == max_cmp;
+      } else if (sql::WHITE_OP_GT == op_type) {
+        can_skip = max_cmp <= 0;
+      } else if (sql::WHITE_OP_GE == op_type) {
+        can_skip = max_cmp < 0;
+      } else if (sql::WHITE_OP_LT == op_type) {
+        can_skip = min_cmp >= 0;
+      } else {
+        can_skip = min_cmp > 0;
+      }
+      break;
+    }
+    case sql::WHITE_OP_BT: {
+      if (OB_UNLIKELY(ref_objs.count() != 2)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("Invalid argument for between operators", K(ret), K(ref_objs));
+      } else if (ref_objs.at(0).is_null() || ref_objs.at(1).is_null()) {
+      } else if (OB_FAIL(ObObjCmpFuncs::compare(max_obj, ref_objs.at(0), cs_type, max_cmp))) {
+        LOG_WARN("Fail to compare max obj", K(ret), K(max_obj), K(ref_objs));
+      } else if (OB_FAIL(ObObjCmpFuncs::compare(min_obj, ref_objs.at(1), cs_type, min_cmp))) {
+        LOG_WARN("Fail to compare min obj", K(ret), K(min_obj), K(ref_objs));
+      } else {
+        can_skip = max_cmp < 0 || min_cmp > 0;
+      }
+      break;
+    }
+    case sql::WHITE_OP_IN: {
+      can_skip = true;
+      for (int64_t i = 0; OB_SUCC(ret) && can_skip && i < ref_objs.count(); ++i) {
+        const ObObj &ref_obj = ref_objs.at(i);
+        if (ref_obj.is_null()) {
+        } else if (OB_FAIL(ObObjCmpFuncs::compare(min_obj, ref_obj, cs_type, min_cmp))) {
+          LOG_WARN("Fail to compare min obj", K(ret), K(min_obj), K(ref_obj));
+        } else if (OB_FAIL(ObObjCmpFuncs::compare(max_obj, ref_obj, cs_type, max_cmp))) {
+          LOG_WARN("Fail to compare max obj", K(ret), K(max_obj), K(ref_obj));
+        } else if (min_cmp <= 0 && max_cmp >= 0) {
+          can_skip = false;
+        }
+      }
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    can_skip = false;
+  }
+  return ret;
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+
+#include "ob_index_block_row_struct.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+class ObPushdownFilterExecutor;
+class ObWhiteFilterExecutor;
+}
+namespace storage
+{
+class ObTableReadInfo;
+}
+namespace blocksstable
+{
+
+// Collect skip index (min / max / null count) of the rows appended into current data micro block,
+// serialized into the index row of the micro block by ObIndexBlockRowBuilder.
+class ObSkipIndexAggregator
+{
+public:
+  static const int64_t MAX_SKIP_INDEX_COL_CNT = 16;
+  ObSkipIndexAggregator();
+  ~ObSkipIndexAggregator() = default;
+  int init(const ObDataStoreDesc &data_store_desc);
+  void reset();
+  // reuse for next micro block
+  void reuse();
+  int eval(const ObDatumRow &row);
+  int64_t get_serialize_size() const;
+  int serialize(char *buf, const int64_t buf_len, int64_t &pos) const;
+  OB_INLINE bool is_valid() const { return is_inited_ && col_cnt_ > 0; }
+  TO_STRING_KV(K_(col_cnt), K_(row_count), K_(is_inited));
+
+private:
+  int update_min_max(const int64_t idx, const ObStorageDatum &datum);
+
+private:
+  ObSkipIndexColMeta col_metas_[MAX_SKIP_INDEX_COL_CNT];
+  const ObStorageDatumCmpFunc *cmp_funcs_[MAX_SKIP_INDEX_COL_CNT];
+  uint8_t fixed_lens_[MAX_SKIP_INDEX_COL_CNT];
+  // column is invalid in current block once a nop or unexpected datum appended
+  bool col_valids_[MAX_SKIP_INDEX_COL_CNT];
+  int64_t col_cnt_;
+  int64_t row_count_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObSkipIndexAggregator);
+};
+
+// Decide whether a block could be skipped by pushdown filter with skip index of its index row.
+// Only white filters (and logic combinations of them) are checked, black filters never skip.
+class ObSkipIndexFilterChecker
+{
+public:
+  static int check_can_skip(
+      const sql::ObPushdownFilterExecutor &filter,
+      const storage::ObTableReadInfo &read_info,
+      const ObMicroIndexInfo &index_info,
+      bool &can_skip);
+private:
+  static int check_white_filter(
+      const sql::ObWhiteFilterExecutor &filter,
+      const storage::ObTableReadInfo &read_info,
+      const ObMicroIndexInfo &index_info,
+      bool &can_skip);
+  static int check_by_min_max(
+      const sql::ObWhiteFilterExecutor &filter,
+      const common::ObObj &min_obj,
+      const common::ObObj &max_obj,
+      bool &can_skip);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
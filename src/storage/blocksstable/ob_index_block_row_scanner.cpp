@@ -359,6 +359,7 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
   const ObDatumRowkey *endkey = nullptr;
   const ObIndexBlockRowHeader *idx_row_header = nullptr;
   const ObIndexBlockRowMinorMetaInfo *idx_minor_info = nullptr;
+  const ObSkipIndexHeader *skip_index = nullptr;
   const char *idx_data_buf = nullptr;
   int ret = OB_SUCCESS;
   if (IS_NOT_INIT) {
@@ -376,6 +377,10 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
     if (OB_FAIL(idx_row_parser_.get_minor_meta(idx_minor_info))) {
       LOG_WARN("Fail to get minor meta info", K(ret));
     }
+  } else if (idx_row_header->is_pre_aggregated()) {
+    if (OB_FAIL(idx_row_parser_.get_skip_index(skip_index))) {
+      LOG_WARN("Fail to get skip index", K(ret));
+    }
   }
 
   if (OB_SUCC(ret)) {
@@ -383,6 +388,7 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
     idx_block_row.endkey_ = endkey;
     idx_block_row.row_header_ = idx_row_header;
     idx_block_row.minor_meta_info_ = idx_minor_info;
+    idx_block_row.skip_index_ = skip_index;
     idx_block_row.is_get_ = is_get_;
     idx_block_row.is_left_border_ = is_left_border_ && current_ == start_;
     idx_block_row.is_right_border_ = is_right_border_ && current_ == end_;
@@ -14,6 +14,7 @@
 
 #include "common/row/ob_row.h"
 #include "ob_index_block_row_struct.h"
+#include "ob_index_block_aggregator.h"
 #include "ob_block_sstable_struct.h"
 
 namespace oceanbase
@@ -24,7 +25,7 @@ namespace blocksstable
 {
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc()
-  : data_store_desc_(nullptr), row_key_(), macro_id_(), block_offset_(0),
+  : aggregator_(nullptr), data_store_desc_(nullptr), row_key_(), macro_id_(), block_offset_(0),
     row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
@@ -32,7 +33,7 @@ ObIndexBlockRowDesc::ObIndexBlockRowDesc()
     is_last_row_last_flag_(false) {}
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
-  : data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
+  : aggregator_(nullptr), data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
     row_count_(0), row_count_delta_(0), max_merged_trans_version_(0), block_size_(0),
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
@@ -164,7 +165,7 @@ int ObIndexBlockRowBuilder::build_row(const ObIndexBlockRowDesc &desc, const ObD
   } else if (FALSE_IT(MEMSET(data_buf_, 0, data_size))) {
   } else if (OB_FAIL(append_header_and_meta(desc))) {
     LOG_WARN("Fail to append header and meta to buffer", K(ret), K_(write_pos));
-  } else if (OB_FAIL(append_aggregate_data(desc))) {
+  } else if (OB_FAIL(append_aggregate_data(desc, data_size))) {
     LOG_WARN("Fail to append aggregated data to buffer", K(ret), K_(write_pos));
   } else {
     ObString str(data_size, data_buf_);
@@ -246,11 +247,7 @@ int ObIndexBlockRowBuilder::calc_data_size(const ObIndexBlockRowDesc &desc, int6
   } else if (desc.is_secondary_meta_) {
     size = sizeof(ObIndexBlockRowHeader);
   } else if (MAJOR_MERGE == desc.data_store_desc_->merge_type_) {
-    size = sizeof(ObIndexBlockRowHeader);
-    // if (desc.is_pre_aggregated_) {
-      // TODO: @saitong.zst Calculate aggregate size here
-      // size += aggregate_size;
-    // }
+    size = sizeof(ObIndexBlockRowHeader) + calc_aggregate_size(desc);
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -270,12 +267,32 @@ int ObIndexBlockRowBuilder::calc_data_size(
     size = sizeof(ObIndexBlockRowHeader);
   } else if (idx_row_header.is_major_node()) {
     size = sizeof(ObIndexBlockRowHeader);
+    if (idx_row_header.is_pre_aggregated()) {
+      const ObSkipIndexHeader *skip_index = reinterpret_cast<const ObSkipIndexHeader *>(
+          reinterpret_cast<const char *>(&idx_row_header) + sizeof(ObIndexBlockRowHeader));
+      if (OB_UNLIKELY(!skip_index->is_valid())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Invalid skip index in pre-aggregated index row", K(ret), KPC(skip_index));
+      } else {
+        size += skip_index->get_size();
+      }
+    }
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
   return ret;
 }
 
+int64_t ObIndexBlockRowBuilder::calc_aggregate_size(const ObIndexBlockRowDesc &desc)
+{
+  // Only rows pointing to data micro blocks of major sstable carry skip index
+  int64_t size = 0;
+  if (desc.is_data_block_ && nullptr != desc.aggregator_ && desc.aggregator_->is_valid()) {
+    size = desc.aggregator_->get_serialize_size();
+  }
+  return size;
+}
+
 int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &desc)
 {
   int ret = OB_SUCCESS;
@@ -295,7 +312,7 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
     header_->is_major_node_ = desc.data_store_desc_->merge_type_ == MAJOR_MERGE;
     header_->has_string_out_row_ = desc.has_string_out_row_;
     header_->all_lob_in_row_ = !desc.has_lob_out_row_;
-    // header_->is_pre_aggregated_ =
+    header_->is_pre_aggregated_ = header_->is_major_node_ && calc_aggregate_size(desc) > 0;
     header_->is_deleted_ = desc.is_deleted_;
     header_->macro_id_ =(desc.is_data_block_ && is_data_mid_micro_block)
         ? ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID : desc.macro_id_;
@@ -326,23 +343,25 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
   return ret;
 }
 
-int ObIndexBlockRowBuilder::append_aggregate_data(const ObIndexBlockRowDesc &desc)
+int ObIndexBlockRowBuilder::append_aggregate_data(const ObIndexBlockRowDesc &desc, const int64_t buf_size)
 {
   int ret = OB_SUCCESS;
-  UNUSED(desc);
   if (OB_ISNULL(header_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Fail to append aggregation data to buffer", K(ret), KP_(header));
   } else if (!header_->is_pre_aggregated()) {
-  } else {
-    // TODO: @saitong.zst Write aggregate data here
+  } else if (OB_ISNULL(desc.aggregator_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null aggregator for pre-aggregated index row", K(ret), K(desc));
+  } else if (OB_FAIL(desc.aggregator_->serialize(data_buf_, buf_size, write_pos_))) {
+    LOG_WARN("Fail to serialize skip index", K(ret), K(buf_size), K_(write_pos), KPC(desc.aggregator_));
   }
   return ret;
 }
 
 
 ObIndexBlockRowParser::ObIndexBlockRowParser()
-  : header_(nullptr), minor_meta_info_(nullptr), is_inited_(false) {}
+  : header_(nullptr), minor_meta_info_(nullptr), skip_index_(nullptr), is_inited_(false) {}
 
 int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatumRow &row)
 {
@@ -368,6 +387,8 @@ int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatum
 int ObIndexBlockRowParser::init(const char *data_buf)
 {
   int ret = OB_SUCCESS;
+  minor_meta_info_ = nullptr;
+  skip_index_ = nullptr;
   if (OB_ISNULL(data_buf)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Unexpected null data buffer for index block row data", K(ret));
@@ -382,10 +403,16 @@ int ObIndexBlockRowParser::init(const char *data_buf)
     const int64_t minor_meta_offset = sizeof(ObIndexBlockRowHeader);
     minor_meta_info_ = reinterpret_cast<const ObIndexBlockRowMinorMetaInfo *>(
       data_buf + minor_meta_offset);
+  } else if (header_->is_pre_aggregated()) {
+    const int64_t skip_index_offset = sizeof(ObIndexBlockRowHeader);
+    skip_index_ = reinterpret_cast<const ObSkipIndexHeader *>(data_buf + skip_index_offset);
+    if (OB_UNLIKELY(!skip_index_->is_valid())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("Invalid skip index parsed from data", K(ret), KPC(skip_index_), KPC(header_));
+      skip_index_ = nullptr;
+    }
   }
 
-  // TODO: @saitong.zst locate aggregated data logic here
-
   if (OB_SUCC(ret)) {
     is_inited_ = true;
   }
@@ -419,6 +446,19 @@ int ObIndexBlockRowParser::get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&m
   return ret;
 }
 
+int ObIndexBlockRowParser::get_skip_index(const ObSkipIndexHeader *&skip_index) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    // null if this row is not pre-aggregated
+    skip_index = skip_index_;
+  }
+  return ret;
+}
+
 int ObIndexBlockRowParser::is_macro_node(bool &is_macro_node) const
 {
   int ret = OB_SUCCESS;
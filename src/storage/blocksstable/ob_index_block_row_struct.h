@@ -31,6 +31,7 @@ class ObStoreRow;
 }
 namespace blocksstable
 {
+class ObSkipIndexAggregator;
 
 struct ObIndexBlockRowDesc
 {
@@ -49,7 +50,7 @@ struct ObIndexBlockRowDesc
     return ret;
   }
 
-  // const ObSSTablePreAggreator *aggregator_;
+  const ObSkipIndexAggregator *aggregator_;
   const ObDataStoreDesc *data_store_desc_;
   ObDatumRowkey row_key_;
   MacroBlockId macro_id_;
@@ -69,7 +70,7 @@ struct ObIndexBlockRowDesc
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
 
-  TO_STRING_KV(KP_(data_store_desc), K_(row_key), K_(macro_id),
+  TO_STRING_KV(KP_(aggregator), KP_(data_store_desc), K_(row_key), K_(macro_id),
       K_(block_offset), K_(row_count), K_(row_count_delta),
       K_(max_merged_trans_version), K_(block_size),
       K_(macro_block_count), K_(micro_block_count),
@@ -194,6 +195,64 @@ struct ObIndexBlockRowMinorMetaInfo
   TO_STRING_KV(K_(snapshot_version), K_(max_merged_trans_version), K_(row_count_delta));
 };
 
+// Min / max / null count of one column in the blocks pointed by a pre-aggregated index row.
+// Only columns with fixed length datum (no more than 8 bytes) are collected, so min and max
+// are stored inline and the size of skip index is decided by column count only.
+struct ObSkipIndexColMeta
+{
+  static const int64_t MAX_INLINE_DATUM_LEN = 8;
+  void reset() { MEMSET(this, 0, sizeof(*this)); }
+  OB_INLINE bool has_min_max() const { return 0 != datum_len_; }
+  OB_INLINE void get_min_datum(ObStorageDatum &datum) const { get_datum(min_, datum); }
+  OB_INLINE void get_max_datum(ObStorageDatum &datum) const { get_datum(max_, datum); }
+  OB_INLINE void get_datum(const char *buf, ObStorageDatum &datum) const
+  {
+    datum.reuse();
+    datum.ptr_ = buf;
+    datum.pack_ = datum_len_;
+  }
+  uint16_t col_idx_;                       // Stored column index in data block
+  uint8_t obj_type_;                       // ObObjType of the column when the block was built
+  uint8_t datum_len_;                      // Length of min / max datum, 0 if all values are null
+  uint32_t null_count_;                    // Null value count of the column
+  char min_[MAX_INLINE_DATUM_LEN];
+  char max_[MAX_INLINE_DATUM_LEN];
+  TO_STRING_KV(K_(col_idx), K_(obj_type), K_(datum_len), K_(null_count),
+      KPHEX_(min, datum_len_), KPHEX_(max, datum_len_));
+};
+
+// Skip index laid after the header (and minor meta) of a pre-aggregated index block row,
+// followed by col_cnt_ ObSkipIndexColMeta sorted by column index.
+struct ObSkipIndexHeader
+{
+  static const uint16_t SKIP_INDEX_VERSION_V1 = 1;
+  OB_INLINE bool is_valid() const { return SKIP_INDEX_VERSION_V1 == version_ && col_cnt_ > 0; }
+  OB_INLINE int64_t get_size() const
+  {
+    return sizeof(ObSkipIndexHeader) + col_cnt_ * sizeof(ObSkipIndexColMeta);
+  }
+  OB_INLINE const ObSkipIndexColMeta *get_col_metas() const
+  {
+    return reinterpret_cast<const ObSkipIndexColMeta *>(reinterpret_cast<const char *>(this) + sizeof(*this));
+  }
+  OB_INLINE const ObSkipIndexColMeta *get_col_meta(const int64_t col_idx) const
+  {
+    const ObSkipIndexColMeta *col_meta = nullptr;
+    const ObSkipIndexColMeta *col_metas = get_col_metas();
+    for (int64_t i = 0; i < col_cnt_ && col_metas[i].col_idx_ <= col_idx; ++i) {
+      if (col_metas[i].col_idx_ == col_idx) {
+        col_meta = &col_metas[i];
+        break;
+      }
+    }
+    return col_meta;
+  }
+  uint16_t version_;
+  uint16_t col_cnt_;
+  uint32_t reserved_;
+  TO_STRING_KV(K_(version), K_(col_cnt));
+};
+
 struct ObMicroIndexInfo
 {
 public:
@@ -201,6 +260,7 @@ public:
     : row_header_(nullptr),
       minor_meta_info_(nullptr),
       endkey_(nullptr),
+      skip_index_(nullptr),
       query_range_(nullptr),
       flag_(0),
       range_idx_(-1),
@@ -213,6 +273,7 @@ public:
     row_header_ = nullptr;
     minor_meta_info_ = nullptr;
     endkey_ = nullptr;
+    skip_index_ = nullptr;
     query_range_ = nullptr;
     flag_ = 0;
     range_idx_ = -1;
@@ -356,15 +417,19 @@ public:
   {
     return is_filter_applied_ && !is_left_border_ && !is_right_border_;
   }
+  OB_INLINE bool has_skip_index() const
+  {
+    return nullptr != skip_index_;
+  }
 
   TO_STRING_KV(KP_(query_range), KPC_(row_header), KPC_(minor_meta_info), KPC_(endkey),
-      K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
+      KPC_(skip_index), K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
 
 public:
   const ObIndexBlockRowHeader *row_header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
   const ObDatumRowkey *endkey_;
-  // ObPreAggDataStore *pre_agg_data_;
+  const ObSkipIndexHeader *skip_index_;
   union {
     const ObDatumRowkey *rowkey_;
     const ObDatumRange *range_;
@@ -403,8 +468,9 @@ private:
   int set_rowkey(const ObIndexBlockRowDesc &desc);
   int set_rowkey(const ObDatumRowkey &rowkey);
   int append_header_and_meta(const ObIndexBlockRowDesc &desc);
-  int append_aggregate_data(const ObIndexBlockRowDesc &desc);
+  int append_aggregate_data(const ObIndexBlockRowDesc &desc, const int64_t buf_size);
   static int calc_data_size(const ObIndexBlockRowDesc &desc, int64_t &size);
+  static int64_t calc_aggregate_size(const ObIndexBlockRowDesc &desc);
   int calc_data_size(const ObIndexBlockRowHeader &idx_row_header, int64_t &size);
 
 private:
@@ -433,6 +499,7 @@ public:
   int init(const char *data_buf);
   int get_header(const ObIndexBlockRowHeader *&header) const;
   int get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&meta) const;
+  int get_skip_index(const ObSkipIndexHeader *&skip_index) const;
   int is_macro_node(bool &is_macro_node) const;
   int64_t get_snapshot_version() const;
   int64_t get_max_merged_trans_version() const;
@@ -442,7 +509,7 @@ public:
 private:
   const ObIndexBlockRowHeader *header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
-  // Aggregate data read struct
+  const ObSkipIndexHeader *skip_index_;
   bool is_inited_;
 };
 
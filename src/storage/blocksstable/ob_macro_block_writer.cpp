@@ -374,7 +374,8 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    check_datum_row_(),
    callback_(nullptr),
    builder_(NULL),
-   data_block_pre_warmer_()
+   data_block_pre_warmer_(),
+   skip_index_aggregator_()
 {
   //macro_blocks_, macro_handles_
 }
@@ -419,6 +420,7 @@ void ObMacroBlockWriter::reset()
   allocator_.reset();
   rowkey_allocator_.reset();
   data_block_pre_warmer_.reset();
+  skip_index_aggregator_.reset();
 }
 
 
@@ -487,6 +489,11 @@ int ObMacroBlockWriter::open(
     } else if (OB_NOT_NULL(sstable_index_builder)) {
       if (OB_FAIL(sstable_index_builder->new_index_builder(builder_, data_store_desc, allocator_))) {
         STORAGE_LOG(WARN, "fail to alloc index builder", K(ret));
+      } else if (MAJOR_MERGE == data_store_desc.merge_type_
+          // skip index changes the index row layout, which old observers can not parse
+          && data_store_desc.major_working_cluster_version_ >= DATA_VERSION_4_1_0_1
+          && OB_FAIL(skip_index_aggregator_.init(data_store_desc))) {
+        STORAGE_LOG(WARN, "fail to init skip index aggregator", K(ret));
       } else if (data_store_desc.need_pre_warm_) {
         data_block_pre_warmer_.init(read_info_);
       }
@@ -866,6 +873,8 @@ int ObMacroBlockWriter::append_row_and_hash_index(const ObDatumRow &row)
     if (ret != OB_BUF_NOT_ENOUGH) {
       STORAGE_LOG(WARN, "Failed to append row in micro writer", K(ret), K(row));
     }
+  } else if (skip_index_aggregator_.is_valid() && OB_FAIL(skip_index_aggregator_.eval(row))) {
+    STORAGE_LOG(WARN, "Failed to aggregate skip index", K(ret), K(row));
   } else if (hash_index_builder_.is_valid()) {
     if (OB_UNLIKELY(FLAT_ROW_STORE != data_store_desc_->row_store_type_)) {
       ret = OB_ERR_UNEXPECTED;
@@ -922,6 +931,7 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "Failed to build hash index block", K(ret));
   } else {
     micro_block_desc.last_rowkey_ = last_key_;
+    micro_block_desc.aggregator_ = skip_index_aggregator_.is_valid() ? &skip_index_aggregator_ : nullptr;
     block_size = micro_block_desc.buf_size_;
     if (data_block_pre_warmer_.is_valid()
         && OB_TMP_FAIL(data_block_pre_warmer_.reserve_kvpair(micro_block_desc))) {
@@ -949,6 +959,7 @@ int ObMacroBlockWriter::build_micro_block()
   }
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
+    skip_index_aggregator_.reuse();
     if (data_store_desc_->need_build_hash_index_for_micro_block_) {
       hash_index_builder_.reuse();
     }
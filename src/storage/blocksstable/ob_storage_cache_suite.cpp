@@ -24,6 +24,8 @@ ObStorageCacheSuite::ObStorageCacheSuite()
     user_row_cache_(),
     bf_cache_(),
     fuse_row_cache_(),
+    tx_data_cache_(),
+    tx_data_bf_cache_(),
     is_inited_(false)
 {
 }
@@ -63,6 +65,10 @@ int ObStorageCacheSuite::init(
     STORAGE_LOG(ERROR, "failed to set bf_cache_miss_count_threshold", K(ret));
   } else if (OB_FAIL(fuse_row_cache_.init("fuse_row_cache", fuse_row_cache_priority))) {
     STORAGE_LOG(ERROR, "fail to init fuse row cache", K(ret));
+  } else if (OB_FAIL(tx_data_cache_.init("tx_data_cache", user_row_cache_priority))) {
+    STORAGE_LOG(ERROR, "fail to init tx data cache", K(ret));
+  } else if (OB_FAIL(tx_data_bf_cache_.init("tx_data_bf_cache", bf_cache_priority))) {
+    STORAGE_LOG(ERROR, "fail to init tx data bloom filter cache", K(ret));
   } else {
     is_inited_ = true;
   }
@@ -95,6 +101,10 @@ int ObStorageCacheSuite::reset_priority(
     STORAGE_LOG(ERROR, "set priority for bloom filter cache failed, ", K(ret));
   } else if (OB_FAIL(fuse_row_cache_.set_priority(fuse_row_cache_priority))) {
     STORAGE_LOG(ERROR, "fail to set priority for fuse row cache", K(ret));
+  } else if (OB_FAIL(tx_data_cache_.set_priority(user_row_cache_priority))) {
+    STORAGE_LOG(ERROR, "fail to set priority for tx data cache", K(ret));
+  } else if (OB_FAIL(tx_data_bf_cache_.set_priority(bf_cache_priority))) {
+    STORAGE_LOG(ERROR, "fail to set priority for tx data bloom filter cache", K(ret));
   }
   return ret;
 }
@@ -115,6 +125,8 @@ void ObStorageCacheSuite::destroy()
   user_row_cache_.destroy();
   bf_cache_.destroy();
   fuse_row_cache_.destroy();
+  tx_data_cache_.destroy();
+  tx_data_bf_cache_.destroy();
   is_inited_ = false;
 }
 
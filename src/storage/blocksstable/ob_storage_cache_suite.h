@@ -18,6 +18,7 @@
 #include "ob_row_cache.h"
 #include "ob_fuse_row_cache.h"
 #include "ob_bloom_filter_cache.h"
+#include "storage/tx_table/ob_tx_data_cache.h"
 
 #define OB_STORE_CACHE oceanbase::blocksstable::ObStorageCacheSuite::get_instance()
 
@@ -49,6 +50,8 @@ public:
   ObRowCache &get_row_cache() { return user_row_cache_; }
   ObBloomFilterCache &get_bf_cache() { return bf_cache_; }
   ObFuseRowCache &get_fuse_row_cache() { return fuse_row_cache_; }
+  storage::ObTxDataKVCache &get_tx_data_cache() { return tx_data_cache_; }
+  storage::ObTxDataBFCache &get_tx_data_bf_cache() { return tx_data_bf_cache_; }
   void destroy();
   inline bool is_inited() const { return is_inited_; }
   TO_STRING_KV(K(is_inited_));
@@ -60,6 +63,8 @@ private:
   ObRowCache user_row_cache_;
   ObBloomFilterCache bf_cache_;
   ObFuseRowCache fuse_row_cache_;
+  storage::ObTxDataKVCache tx_data_cache_;
+  storage::ObTxDataBFCache tx_data_bf_cache_;
   bool is_inited_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObStorageCacheSuite);
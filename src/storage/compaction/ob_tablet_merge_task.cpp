@@ -20,6 +20,7 @@
 #include "storage/blocksstable/ob_index_block_builder.h"
 #include "storage/tablet/ob_tablet_common.h"
 #include "storage/tx_storage/ob_ls_service.h"
+#include "storage/tx_table/ob_tx_table.h"
 #include "ob_tenant_compaction_progress.h"
 #include "ob_compaction_diagnose.h"
 #include "ob_compaction_suggestion.h"
@@ -1049,6 +1050,15 @@ int ObTabletMergeFinishTask::process()
     } else if (OB_FAIL(add_sstable_for_merge(ctx))) {
       LOG_WARN("failed to add sstable for merge", K(ret));
     }
+    if (OB_SUCC(ret) && tablet_id.is_ls_tx_data_tablet()) {
+      // build the bloom filter of tx ids here, the reads of tx data only consult it
+      ObTxTableGuard tx_table_guard;
+      if (OB_TMP_FAIL(ctx.ls_handle_.get_ls()->get_tx_table_guard(tx_table_guard))) {
+        LOG_WARN("failed to get tx table guard", K(tmp_ret), K(ls_id));
+      } else if (OB_TMP_FAIL(tx_table_guard.get_tx_table()->get_tx_data_table()->build_bloom_filter(sstable))) {
+        LOG_WARN("failed to build tx data bloom filter", K(tmp_ret), K(ls_id), KPC(sstable));
+      }
+    }
     if (OB_SUCC(ret) && is_major_merge_type(ctx.param_.merge_type_) && NULL != ctx.param_.report_) {
       int tmp_ret = OB_SUCCESS;
       if (OB_TMP_FAIL(ctx.param_.report_->submit_tablet_update_task(MTL_ID(), ctx.param_.ls_id_, tablet_id))) {
@@ -182,6 +182,15 @@ int ObMvccValueIterator::lock_for_read_inner_(const ObQueryFlag &flag,
       if (snapshot_version >= data_version) {
         // Case 2.1 Read the version if it is smaller than read version
         version_iter_ = iter;
+        // Tip 2.1.1: the dml reader depends on the elr tx which is not committed
+        //            yet, and must abort if it aborts finally
+        if (is_elr
+            && !is_committed
+            && snapshot_tx_id.is_valid()
+            && NULL != ctx_->get_mem_ctx()
+            && OB_FAIL(ctx_->get_mem_ctx()->add_elr_prev_trans(data_tx_id))) {
+          TRANS_LOG(WARN, "add elr prev trans failed", K(ret), K(data_tx_id), KPC(iter));
+        }
       } else {
         // Case 2.2: Otherwise, skip to the next version
         iter = iter->prev_;
@@ -928,6 +928,11 @@ int ObMvccRow::mvcc_write_(ObIMemtableCtx &ctx,
                                                                    list_head_->get_dml_flag(),
                                                                    list_head_->get_seq_no()))) {
         TRANS_LOG(WARN, "check sequence set violation failed", K(ret), KPC(this));
+      } else if (nullptr != list_head_
+                 && list_head_->is_elr()
+                 && !list_head_->is_committed()
+                 && OB_FAIL(static_cast<ObMemtableCtx &>(ctx).add_elr_prev_trans(list_head_->get_tx_id()))) {
+        TRANS_LOG(WARN, "add elr prev trans failed", K(ret), KPC(this));
       } else if (OB_SUCC(check_double_insert_(snapshot_version,
                                               writer_node,
                                               list_head_))) {
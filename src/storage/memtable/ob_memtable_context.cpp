@@ -480,6 +480,16 @@ int ObMemtableCtx::elr_trans_preparing()
   return OB_SUCCESS;
 }
 
+int ObMemtableCtx::add_elr_prev_trans(const ObTransID &tx_id)
+{
+  int ret = OB_SUCCESS;
+  ObPartTransCtx *ctx = ATOMIC_LOAD(&ctx_);
+  if (NULL != ctx && tx_id != ctx->get_trans_id()) {
+    ret = ctx->add_elr_prev_trans(tx_id);
+  }
+  return ret;
+}
+
 int ObMemtableCtx::do_trans_end(
     const bool commit,
     const SCN trans_version,
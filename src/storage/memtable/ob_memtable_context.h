@@ -357,6 +357,9 @@ public:
                         const share::SCN final_scn);
   virtual int trans_clear();
   virtual int elr_trans_preparing();
+  // record the early lock released and not yet committed tx whose data is
+  // overwritten or read by this tx
+  int add_elr_prev_trans(const transaction::ObTransID &tx_id);
   virtual int trans_kill();
   virtual int trans_publish();
   virtual int trans_replay_begin();
@@ -36,6 +36,90 @@ namespace transaction
     TRANS_LOG(WARN, "tx table is null", KR(ret), K(ctx_mgr_->get_ls_id()), K(*this)); \
   }
 
+void ObTxStateSnapshot::reset()
+{
+  seq_ = 0;
+  state_ = ObTxData::RUNNING;
+  commit_version_.reset();
+}
+
+int64_t ObTxStateSnapshot::begin_write_()
+{
+  int64_t seq = 0;
+  while (true) {
+    seq = ATOMIC_LOAD(&seq_);
+    if (0 == (seq & 1) && ATOMIC_BCAS(&seq_, seq, seq + 1)) {
+      break;
+    } else {
+      PAUSE();
+    }
+  }
+  return seq + 1;
+}
+
+void ObTxStateSnapshot::end_write_(const int64_t seq)
+{
+  ATOMIC_STORE(&seq_, seq + 1);
+}
+
+void ObTxStateSnapshot::refresh(const ObTxData &tx_data)
+{
+  const int64_t seq = begin_write_();
+  commit_version_.atomic_store(tx_data.commit_version_.atomic_load());
+  ATOMIC_STORE(&state_, ATOMIC_LOAD(&tx_data.state_));
+  end_write_(seq);
+}
+
+void ObTxStateSnapshot::set_state(ObTxData &tx_data, const int32_t state)
+{
+  const int64_t seq = begin_write_();
+  ATOMIC_STORE(&tx_data.state_, state);
+  ATOMIC_STORE(&state_, state);
+  end_write_(seq);
+}
+
+void ObTxStateSnapshot::set_commit_version(ObTxData &tx_data, const SCN &commit_version)
+{
+  const int64_t seq = begin_write_();
+  tx_data.commit_version_.atomic_store(commit_version);
+  commit_version_.atomic_store(commit_version);
+  end_write_(seq);
+}
+
+void ObTxStateSnapshot::get(int32_t &state, SCN &commit_version) const
+{
+  while (true) {
+    const int64_t seq = ATOMIC_LOAD(&seq_);
+    if (0 != (seq & 1)) {
+      PAUSE();
+    } else {
+      state = ATOMIC_LOAD(&state_);
+      commit_version = commit_version_.atomic_load();
+      if (seq == ATOMIC_LOAD(&seq_)) {
+        break;
+      }
+    }
+  }
+}
+
+bool ObTxStateSnapshot::check(const ObTxData &tx_data) const
+{
+  bool bret = false;
+  while (true) {
+    const int64_t seq = ATOMIC_LOAD(&seq_);
+    if (0 != (seq & 1)) {
+      PAUSE();
+    } else {
+      bret = ATOMIC_LOAD(&state_) == ATOMIC_LOAD(&tx_data.state_)
+          && commit_version_.atomic_load() == tx_data.commit_version_.atomic_load();
+      if (seq == ATOMIC_LOAD(&seq_)) {
+        break;
+      }
+    }
+  }
+  return bret;
+}
+
 int ObCtxTxData::init(ObLSTxCtxMgr *ctx_mgr, int64_t tx_id)
 {
   int ret = OB_SUCCESS;
@@ -58,6 +142,7 @@ int ObCtxTxData::init(ObLSTxCtxMgr *ctx_mgr, int64_t tx_id)
       TRANS_LOG(WARN, "tx data is unexpected null", KR(ret), K(ctx_mgr_->get_ls_id()));
     } else {
       tx_data_guard_.tx_data()->tx_id_ = tx_id;
+      refresh_snapshot_();
     }
   }
   return ret;
@@ -68,6 +153,7 @@ void ObCtxTxData::reset()
   ctx_mgr_ = nullptr;
   tx_data_guard_.reset();
   read_only_ = false;
+  snapshot_.reset();
 }
 
 void ObCtxTxData::destroy()
@@ -113,6 +199,8 @@ int ObCtxTxData::recover_tx_data(ObTxDataGuard &rhs)
     TRANS_LOG(WARN, "input tx data guard is unexpected nullptr", K(ret), KPC(this));
   } else if (OB_FAIL(tx_data_guard_.init(rhs.tx_data()))) {
     TRANS_LOG(WARN, "init tx data guard failed", K(ret), KPC(this));
+  } else {
+    refresh_snapshot_();
   }
 
   return ret;
@@ -135,6 +223,8 @@ int ObCtxTxData::replace_tx_data(ObTxData *tmp_tx_data)
     tx_data_guard_.reset();
     if (OB_FAIL(tx_data_guard_.init(tmp_tx_data))) {
       TRANS_LOG(WARN, "init tx data guard failed", KR(ret), KPC(tmp_tx_data));
+    } else {
+      refresh_snapshot_();
     }
   }
   return ret;
@@ -233,7 +323,7 @@ int ObCtxTxData::set_state(int32_t state)
   if (OB_FAIL(check_tx_data_writable_())) {
     TRANS_LOG(WARN, "tx data is not writeable", K(ret), K(*this));
   } else {
-    ATOMIC_STORE(&(tx_data_guard_.tx_data()->state_), state);
+    snapshot_.set_state(*tx_data_guard_.tx_data(), state);
   }
 
   return ret;
@@ -247,7 +337,7 @@ int ObCtxTxData::set_commit_version(const SCN &commit_version)
   if (OB_FAIL(check_tx_data_writable_())) {
     TRANS_LOG(WARN, "tx data is not writeable", K(ret), K(*this));
   } else {
-    tx_data_guard_.tx_data()->commit_version_.atomic_store(commit_version);
+    snapshot_.set_commit_version(*tx_data_guard_.tx_data(), commit_version);
   }
 
   return ret;
@@ -284,26 +374,24 @@ int ObCtxTxData::set_end_log_ts(const SCN &end_scn)
 
 int32_t ObCtxTxData::get_state() const
 {
-  RLockGuard guard(lock_);
-  const ObTxData *tx_data = tx_data_guard_.tx_data();
-  if (OB_ISNULL(tx_data)) {
-    TRANS_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "tx data is unexpected nullptr", KPC(this));
-    return 0;
-  } else {
-    return ATOMIC_LOAD(&tx_data->state_);
-  }
+  int32_t state = 0;
+  SCN commit_version;
+  snapshot_.get(state, commit_version);
+#ifndef NDEBUG
+  check_snapshot_();
+#endif
+  return state;
 }
 
 const SCN ObCtxTxData::get_commit_version() const
 {
-  RLockGuard guard(lock_);
-  const ObTxData *tx_data = tx_data_guard_.tx_data();
-  if (OB_ISNULL(tx_data)) {
-    TRANS_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "tx data is unexpected nullptr", KPC(this));
-    return SCN::invalid_scn();
-  } else {
-    return tx_data->commit_version_.atomic_load();
-  }
+  int32_t state = 0;
+  SCN commit_version;
+  snapshot_.get(state, commit_version);
+#ifndef NDEBUG
+  check_snapshot_();
+#endif
+  return commit_version;
 }
 
 const SCN ObCtxTxData::get_start_log_ts() const
@@ -442,6 +530,23 @@ int ObCtxTxData::add_undo_action(ObUndoAction &undo_action, storage::ObUndoStatu
   return ret;
 }
 
+void ObCtxTxData::refresh_snapshot_()
+{
+  const ObTxData *tx_data = tx_data_guard_.tx_data();
+  if (OB_NOT_NULL(tx_data)) {
+    snapshot_.refresh(*tx_data);
+  }
+}
+
+void ObCtxTxData::check_snapshot_() const
+{
+  RLockGuard guard(lock_);
+  const ObTxData *tx_data = tx_data_guard_.tx_data();
+  if (OB_NOT_NULL(tx_data)) {
+    OB_ASSERT(snapshot_.check(*tx_data));
+  }
+}
+
 int ObCtxTxData::check_tx_data_writable_()
 {
   int ret = OB_SUCCESS;
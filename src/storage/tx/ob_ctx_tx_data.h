@@ -27,6 +27,31 @@ class ObTxTable;
 namespace transaction
 {
 
+// Seqlock protected copy of the state and commit version of tx data, readers
+// get a consistent pair without any lock and retry if a writer is running.
+class ObTxStateSnapshot
+{
+public:
+  ObTxStateSnapshot() { reset(); }
+  void reset();
+  void refresh(const storage::ObTxData &tx_data);
+  // tx data and the snapshot are updated in the same write section
+  void set_state(storage::ObTxData &tx_data, const int32_t state);
+  void set_commit_version(storage::ObTxData &tx_data, const share::SCN &commit_version);
+  void get(int32_t &state, share::SCN &commit_version) const;
+  // false if tx data is modified without the snapshot
+  bool check(const storage::ObTxData &tx_data) const;
+  TO_STRING_KV(K_(seq), K_(state), K_(commit_version));
+private:
+  int64_t begin_write_();
+  void end_write_(const int64_t seq);
+private:
+  // odd means a writer is modifying the snapshot
+  int64_t seq_;
+  int32_t state_;
+  share::SCN commit_version_;
+};
+
 class ObCtxTxData
 {
 public:
@@ -52,6 +77,7 @@ public:
   int set_start_log_ts(const share::SCN &start_ts);
   int set_end_log_ts(const share::SCN &end_ts);
 
+  // state and commit version are read from snapshot_ without lock
   int32_t get_state() const;
   const share::SCN get_commit_version() const;
   const share::SCN get_start_log_ts() const;
@@ -80,6 +106,7 @@ public:
     ctx_mgr_ = ctx_mgr;
     tx_data_guard_.init(&tx_data);
     read_only_ = false;
+    refresh_snapshot_();
   }
   void test_tx_data_reset()
   {
@@ -96,6 +123,8 @@ public:
 
 private:
   int check_tx_data_writable_();
+  void refresh_snapshot_();
+  void check_snapshot_() const;
   int insert_tx_data_(storage::ObTxTable *tx_table, storage::ObTxData *tx_data);
   int deep_copy_tx_data_(storage::ObTxTable *tx_table, storage::ObTxDataGuard &tx_data);
   int revert_tx_data_(storage::ObTxData *&tx_data);
@@ -110,6 +139,7 @@ private:
   bool read_only_;
   // lock for tx_data_ pointer
   RWLock lock_;
+  ObTxStateSnapshot snapshot_;
 };
 
 } // namespace transaction
@@ -49,6 +49,86 @@ inline bool atomic_update(int64_t *v, const int64_t x)
   return bool_ret;
 }
 
+// Latency histogram of waiting gts, the upper bound of each bucket is
+// get_bound_(i) us, the last bucket holds everything beyond.
+class ObGtsWaitHistogram
+{
+public:
+  static const int64_t BUCKET_COUNT = 12;
+public:
+  ObGtsWaitHistogram() { reset(); }
+  ~ObGtsWaitHistogram() {}
+  void reset()
+  {
+    for (int64_t i = 0; i < BUCKET_COUNT; i++) {
+      ATOMIC_STORE(&buckets_[i], 0);
+    }
+    ATOMIC_STORE(&total_cnt_, 0);
+    ATOMIC_STORE(&total_us_, 0);
+    ATOMIC_STORE(&max_us_, 0);
+  }
+  void add(const int64_t wait_us)
+  {
+    int64_t i = 0;
+    while (i < BUCKET_COUNT - 1 && wait_us > get_bound_(i)) {
+      i++;
+    }
+    ATOMIC_INC(&buckets_[i]);
+    ATOMIC_INC(&total_cnt_);
+    ATOMIC_AAF(&total_us_, wait_us);
+    (void)atomic_update(&max_us_, wait_us);
+  }
+  int64_t get_count(const int64_t idx) const
+  {
+    return (0 <= idx && idx < BUCKET_COUNT) ? ATOMIC_LOAD(&buckets_[idx]) : 0;
+  }
+  int64_t get_total_count() const { return ATOMIC_LOAD(&total_cnt_); }
+  // the upper bound of the bucket which 'pct' percent of waits fall into
+  int64_t get_percentile(const int64_t pct) const
+  {
+    const int64_t total = ATOMIC_LOAD(&total_cnt_);
+    const int64_t target = (total * pct + 99) / 100;
+    int64_t sum = 0;
+    int64_t i = 0;
+    for (; i < BUCKET_COUNT - 1; i++) {
+      sum += ATOMIC_LOAD(&buckets_[i]);
+      if (sum >= target) {
+        break;
+      }
+    }
+    return 0 == total ? 0 : (i < BUCKET_COUNT - 1 ? get_bound_(i) : ATOMIC_LOAD(&max_us_));
+  }
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    const int64_t total = ATOMIC_LOAD(&total_cnt_);
+    common::databuff_printf(buf, buf_len, pos, "{cnt:%ld, avg:%ld, p50:%ld, p99:%ld, max:%ld, buckets:[",
+        total, 0 == total ? 0 : ATOMIC_LOAD(&total_us_) / total,
+        get_percentile(50), get_percentile(99), ATOMIC_LOAD(&max_us_));
+    for (int64_t i = 0; i < BUCKET_COUNT; i++) {
+      if (i < BUCKET_COUNT - 1) {
+        common::databuff_printf(buf, buf_len, pos, "<=%ld:%ld, ", get_bound_(i), ATOMIC_LOAD(&buckets_[i]));
+      } else {
+        common::databuff_printf(buf, buf_len, pos, ">%ld:%ld]}",
+            get_bound_(i - 1), ATOMIC_LOAD(&buckets_[i]));
+      }
+    }
+    return pos;
+  }
+private:
+  static int64_t get_bound_(const int64_t idx)
+  {
+    static const int64_t BUCKET_BOUNDS[BUCKET_COUNT - 1] = {
+      50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000
+    };
+    return BUCKET_BOUNDS[idx];
+  }
+  int64_t buckets_[BUCKET_COUNT];
+  int64_t total_cnt_;
+  int64_t total_us_;
+  int64_t max_us_;
+};
+
 } // transaction
 } // oceanbase
 
@@ -41,6 +41,8 @@ void ObGtsStatistics::reset()
   try_get_gts_with_stc_cnt_ = 0;
   wait_gts_elapse_cnt_ = 0;
   try_wait_gts_elapse_cnt_ = 0;
+  coalesced_gts_rpc_cnt_ = 0;
+  get_gts_wait_histogram_.reset();
 }
 
 int ObGtsStatistics::init(const uint64_t tenant_id)
@@ -53,7 +55,7 @@ int ObGtsStatistics::init(const uint64_t tenant_id)
   return ret;
 }
 
-void ObGtsStatistics::statistics()
+void ObGtsStatistics::statistics(const int64_t gts_rpc_rtt)
 {
   const int64_t cur_ts = ObTimeUtility::current_time();
   const int64_t last_stat_ts = ATOMIC_LOAD(&last_stat_ts_);
@@ -67,7 +69,10 @@ void ObGtsStatistics::statistics()
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
                       "try_get_gts_with_stc_cnt", ATOMIC_LOAD(&try_get_gts_with_stc_cnt_),
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
-                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
+                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_),
+                      "coalesced_gts_rpc_cnt", ATOMIC_LOAD(&coalesced_gts_rpc_cnt_),
+                      K(gts_rpc_rtt),
+                      "get_gts_wait_us", get_gts_wait_histogram_);
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
@@ -75,6 +80,8 @@ void ObGtsStatistics::statistics()
       ATOMIC_STORE(&try_get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&wait_gts_elapse_cnt_, 0);
       ATOMIC_STORE(&try_wait_gts_elapse_cnt_, 0);
+      ATOMIC_STORE(&coalesced_gts_rpc_cnt_, 0);
+      get_gts_wait_histogram_.reset();
     }
   }
 
@@ -93,6 +100,9 @@ void ObGtsSource::reset()
     queue_[i].reset();
   }
   gts_cache_leader_.reset();
+  gts_rpc_rtt_ = 0;
+  last_rpc_ts_ = 0;
+  deferred_stc_ = 0;
 }
 
 
@@ -245,9 +255,13 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
         refresh_gts_location();
       }
     } else {
-      // If not in local, refresh gts
+      // If not in local, refresh gts. The rpc is skipped if the window is full,
+      // it will be sent together with other waiters when next response arrives
+      // or the rpc interval expires.
       if (need_send_rpc) {
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (!try_acquire_rpc_slot_()) {
+          defer_query_gts_(stc);
+        } else if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
       }
@@ -562,6 +576,7 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
     TRANS_LOG(WARN, "post gts request failed", KR(ret), K(leader), K(msg));
     (void)refresh_gts_location_();
   } else {
+    ATOMIC_STORE(&last_rpc_ts_, srr.mts_);
     gts_statistics_.inc_gts_rpc_cnt();
     TRANS_LOG(DEBUG, "post gts request success", K(srr), K_(gts_local_cache));
   }
@@ -604,9 +619,66 @@ int ObGtsSource::refresh_gts_(const bool need_refresh)
   return ret;
 }
 
+bool ObGtsSource::try_acquire_rpc_slot_()
+{
+  const int64_t now = MonotonicTs::current_time().mts_;
+  const int64_t last_rpc_ts = ATOMIC_LOAD(&last_rpc_ts_);
+  const int64_t interval = MIN(ATOMIC_LOAD(&gts_rpc_rtt_) / GTS_RPC_WINDOW, MAX_GTS_RPC_INTERVAL_US);
+  return now - last_rpc_ts >= interval && ATOMIC_BCAS(&last_rpc_ts_, last_rpc_ts, now);
+}
+
+void ObGtsSource::defer_query_gts_(const MonotonicTs stc)
+{
+  (void)atomic_update(&deferred_stc_, stc.mts_);
+  gts_statistics_.inc_coalesced_gts_rpc_cnt();
+  // all responses may have arrived before deferred_stc_ is set
+  if (gts_local_cache_.get_srr() >= gts_local_cache_.get_latest_srr()) {
+    const bool ignore_rpc_window = true;
+    query_deferred_gts_(ignore_rpc_window);
+  }
+}
+
+void ObGtsSource::query_deferred_gts()
+{
+  if (OB_LIKELY(is_inited_)) {
+    const bool ignore_rpc_window = false;
+    query_deferred_gts_(ignore_rpc_window);
+  }
+}
+
+// Send one rpc for all waiters deferred by defer_query_gts_, the rpc is sent
+// after their stc so it satisfies all of them. It's triggered by gts responses,
+// error responses and the ts mgr thread when the rpc interval expires.
+void ObGtsSource::query_deferred_gts_(const bool ignore_rpc_window)
+{
+  int tmp_ret = OB_SUCCESS;
+  int64_t deferred_stc = ATOMIC_LOAD(&deferred_stc_);
+  if (0 < deferred_stc
+      && (ignore_rpc_window || try_acquire_rpc_slot_())
+      && 0 < (deferred_stc = ATOMIC_TAS(&deferred_stc_, 0))) {
+    const bool need_refresh_gts_location = false;
+    if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
+      // retried by the ts mgr thread
+      (void)atomic_update(&deferred_stc_, deferred_stc);
+      if (EXECUTE_COUNT_PER_SEC(16)) {
+        TRANS_LOG(WARN, "query deferred gts failed", K(tmp_ret), K(deferred_stc));
+      }
+    }
+  }
+}
+
+void ObGtsSource::update_rpc_rtt_(const MonotonicTs srr, const MonotonicTs receive_gts_ts)
+{
+  const int64_t rtt = receive_gts_ts.mts_ - srr.mts_;
+  if (0 <= rtt) {
+    const int64_t old_rtt = ATOMIC_LOAD(&gts_rpc_rtt_);
+    ATOMIC_STORE(&gts_rpc_rtt_, 0 == old_rtt ? rtt : (old_rtt * 7 + rtt) / 8);
+  }
+}
+
 void ObGtsSource::statistics_()
 {
-  gts_statistics_.statistics();
+  gts_statistics_.statistics(ATOMIC_LOAD(&gts_rpc_rtt_));
 }
 
 int ObGtsSource::update_gts(const MonotonicTs srr,
@@ -626,6 +698,15 @@ int ObGtsSource::update_gts(const MonotonicTs srr,
     TRANS_LOG(WARN, "gts local cache update error", KR(ret), K(srr), K(gts),
               K(receive_gts_ts), K(update));
   } else {
+    update_rpc_rtt_(srr, receive_gts_ts);
+    // waiters deferred before srr are satisfied by this response
+    const int64_t deferred_stc = ATOMIC_LOAD(&deferred_stc_);
+    if (0 < deferred_stc && deferred_stc <= srr.mts_) {
+      (void)ATOMIC_BCAS(&deferred_stc_, deferred_stc, 0);
+    }
+    // a response has arrived, the window has room for the deferred rpc
+    const bool ignore_rpc_window = true;
+    query_deferred_gts_(ignore_rpc_window);
     TRANS_LOG(DEBUG, "gts local cache update success", K(srr), K(gts));
   }
 
@@ -667,7 +748,9 @@ int ObGtsSource::handle_gts_result(const uint64_t tenant_id, const int64_t queue
     TRANS_LOG(WARN, "get srr and gts failed", KR(ret));
   } else {
     ObGTSTaskQueue *queue = &(queue_[queue_index]);
-    if (OB_FAIL(queue->foreach_task(srr, gts, receive_gts_ts))) {
+    ObGtsWaitHistogram *wait_histogram = (queue_index < GET_GTS_QUEUE_COUNT)
+        ? gts_statistics_.get_wait_histogram() : NULL;
+    if (OB_FAIL(queue->foreach_task(srr, gts, receive_gts_ts, wait_histogram))) {
       TRANS_LOG(WARN, "iterate task failed", KR(ret), K(queue_index));
     }
   }
@@ -689,6 +772,9 @@ int ObGtsSource::handle_gts_err_response(const ObGtsErrResponse &err_msg)
       gts_cache_leader_.reset();
       refresh_gts_location_();
     }
+    // no response will arrive for the failed rpc, don't let deferred waiters wait for it
+    const bool ignore_rpc_window = true;
+    query_deferred_gts_(ignore_rpc_window);
   }
   if (EXECUTE_COUNT_PER_SEC(16)) {
     TRANS_LOG(INFO, "handle gts err response", KR(ret), K(err_msg), K(*this));
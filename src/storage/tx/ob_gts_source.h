@@ -51,7 +51,9 @@ public:
   void inc_try_get_gts_with_stc_cnt() { ATOMIC_INC(&try_get_gts_with_stc_cnt_); }
   void inc_wait_gts_elapse_cnt() { ATOMIC_INC(&wait_gts_elapse_cnt_); }
   void inc_try_wait_gts_elapse_cnt() { ATOMIC_INC(&try_wait_gts_elapse_cnt_); }
-  void statistics();
+  void inc_coalesced_gts_rpc_cnt() { ATOMIC_INC(&coalesced_gts_rpc_cnt_); }
+  ObGtsWaitHistogram *get_wait_histogram() { return &get_gts_wait_histogram_; }
+  void statistics(const int64_t gts_rpc_rtt);
 private:
   uint64_t tenant_id_;
   int64_t last_stat_ts_;
@@ -64,6 +66,9 @@ private:
 
   int64_t wait_gts_elapse_cnt_;
   int64_t try_wait_gts_elapse_cnt_;
+  // waiters who found an in-flight rpc and did not send their own
+  int64_t coalesced_gts_rpc_cnt_;
+  ObGtsWaitHistogram get_gts_wait_histogram_;
 };
 
 class ObGtsSource
@@ -92,12 +97,18 @@ public:
   int refresh_gts(const bool need_refresh);
   bool is_external_consistent() { return true; }
   int refresh_gts_location() { return refresh_gts_location_(); }
+  // send the deferred rpc if the rpc interval has expired
+  void query_deferred_gts();
   TO_STRING_KV(K_(tenant_id), K_(gts_local_cache), K_(server), K_(gts_cache_leader));
 private:
   int get_gts_leader_(common::ObAddr &leader);
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  bool try_acquire_rpc_slot_();
+  void defer_query_gts_(const MonotonicTs stc);
+  void query_deferred_gts_(const bool ignore_rpc_window);
+  void update_rpc_rtt_(const MonotonicTs srr, const MonotonicTs receive_gts_ts);
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -109,6 +120,11 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  // Gts rpcs are pipelined, at most GTS_RPC_WINDOW rpcs are sent during one round trip,
+  // waiters arriving in between are coalesced into the rpc sent on next response or
+  // when the interval expires.
+  static const int64_t GTS_RPC_WINDOW = 4;
+  static const int64_t MAX_GTS_RPC_INTERVAL_US = 2 * 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -122,6 +138,11 @@ private:
   common::ObTimeInterval log_interval_;
   common::ObAddr gts_cache_leader_;
   common::ObTimeInterval refresh_location_interval_;
+  // moving average of gts rpc round trip time
+  int64_t gts_rpc_rtt_;
+  int64_t last_rpc_ts_;
+  // max stc of waiters who have not sent rpc, 0 if none
+  int64_t deferred_stc_;
 };
 
 } // transaction
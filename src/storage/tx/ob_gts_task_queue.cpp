@@ -57,7 +57,8 @@ void ObGTSTaskQueue::reset()
 
 int ObGTSTaskQueue::foreach_task(const MonotonicTs srr,
                                  const int64_t gts,
-                                 const MonotonicTs receive_gts_ts)
+                                 const MonotonicTs receive_gts_ts,
+                                 ObGtsWaitHistogram *wait_histogram)
 {
   int ret = OB_SUCCESS;
   if (!is_inited_) {
@@ -77,6 +78,8 @@ int ObGTSTaskQueue::foreach_task(const MonotonicTs srr,
       } else {
         const uint64_t tenant_id = task->get_tenant_id();
         const int64_t request_ts = 0/*task->get_request_ts()*/;
+        // task may be released once callback succeeds, fetch stc beforehand
+        const MonotonicTs stc = (GET_GTS == task_type_) ? task->get_stc() : MonotonicTs(0);
         if (tenant_id != last_tenant_id) {
           if (OB_FAIL(ts_guard.switch_to(tenant_id))) {
             TRANS_LOG(ERROR, "switch tenant failed", K(ret), K(tenant_id));
@@ -118,9 +121,13 @@ int ObGTSTaskQueue::foreach_task(const MonotonicTs srr,
             }
           } else {
             if (GET_GTS == task_type_) {
-              const int64_t total_used = ObTimeUtility::current_time() - request_ts;
+              const int64_t total_used = ObTimeUtility::current_time()
+                  - (stc.is_valid() ? stc.mts_ : request_ts);
               ObTransStatistic::get_instance().add_gts_acquire_total_time(tenant_id, total_used);
               ObTransStatistic::get_instance().add_gts_acquire_total_wait_count(tenant_id, 1);
+              if (NULL != wait_histogram && stc.is_valid()) {
+                wait_histogram->add(total_used);
+              }
             } else if (WAIT_GTS_ELAPSING == task_type_) {
               const int64_t total_used = ObTimeUtility::current_time() - request_ts;
               ObTransStatistic::get_instance().add_gts_wait_elapse_total_time(tenant_id, total_used);
@@ -33,9 +33,11 @@ public:
   int init(const ObGTSCacheTaskType &type);
   void destroy();
   void reset();
+  // the time waited by each finished GET_GTS task is recorded into 'wait_histogram' if not NULL
   int foreach_task(const MonotonicTs srr,
                    const int64_t gts,
-                   const MonotonicTs receive_gts_ts);
+                   const MonotonicTs receive_gts_ts,
+                   ObGtsWaitHistogram *wait_histogram = NULL);
   int push(ObTsCbTask *task);
   int64_t get_task_count() const { return queue_.size(); }
   int gts_callback_interrupted(const int errcode);
@@ -984,6 +984,68 @@ bool ObPartTransCtx::is_force_abort_logging_() const
   return sub_state_.is_force_abort() && sub_state_.is_state_log_submitting();
 }
 
+// The tx has overwritten or read the data of early lock released txs, their commit
+// logs are submitted before ours on the same ls, so our log can never be persisted
+// without theirs. But they may abort after releasing locks (e.g. no log persisted
+// when the leader revokes), and the data we based on is invalid then, so we must
+// abort too before submitting commit or prepare log.
+int ObPartTransCtx::check_elr_prev_trans_()
+{
+  int ret = OB_SUCCESS;
+  if (elr_handler_.has_prev_trans() && !sub_state_.is_force_abort()) {
+    ObSEArray<ObTransID, 4> prev_trans;
+    if (OB_FAIL(elr_handler_.get_prev_trans(prev_trans))) {
+      TRANS_LOG(WARN, "get elr prev trans failed", K(ret), KPC(this));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < prev_trans.count(); i++) {
+      bool is_aborted = false;
+      if (OB_FAIL(check_elr_prev_trans_aborted_(prev_trans.at(i), is_aborted))) {
+        TRANS_LOG(WARN, "check elr prev trans failed", K(ret), K(prev_trans.at(i)), KPC(this));
+      } else if (is_aborted) {
+        sub_state_.set_force_abort();
+        TRANS_LOG(WARN, "elr prev trans aborted, cascading abort", K(prev_trans.at(i)), KPC(this));
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObPartTransCtx::check_elr_prev_trans_aborted_(const ObTransID &prev_tx_id, bool &is_aborted)
+{
+  int ret = OB_SUCCESS;
+  ObPartTransCtx *prev_ctx = NULL;
+  is_aborted = false;
+  // the ctx lock is held, so never acquire the lock of ctx mgr here
+  if (OB_SUCC(ls_tx_ctx_mgr_->get_tx_ctx_directly_from_hash_map(prev_tx_id, prev_ctx))) {
+    is_aborted = (ObTxData::ABORT == prev_ctx->ctx_tx_data_.get_state());
+    (void)ls_tx_ctx_mgr_->revert_tx_ctx_without_lock(prev_ctx);
+  } else if (OB_TRANS_CTX_NOT_EXIST != ret) {
+    TRANS_LOG(WARN, "get elr prev trans ctx failed", K(ret), K(prev_tx_id));
+  } else {
+    // the ctx has exited, check the tx data instead
+    ObTxTableGuard *tx_table_guard = mt_ctx_.get_tx_table_guard();
+    int64_t state = ObTxData::RUNNING;
+    SCN trans_version;
+    if (OB_FAIL(tx_table_guard->get_tx_table()->try_get_tx_state(prev_tx_id,
+                                                                 tx_table_guard->epoch(),
+                                                                 state,
+                                                                 trans_version))) {
+      if (OB_TRANS_CTX_NOT_EXIST == ret) {
+        // tx data has been recycled, the tx is regarded as committed the same as
+        // cleanout does, otherwise the hot row would be aborted repeatedly
+        ret = OB_SUCCESS;
+        is_aborted = false;
+      } else {
+        TRANS_LOG(WARN, "get elr prev trans state failed", K(ret), K(prev_tx_id));
+      }
+    } else {
+      is_aborted = (ObTxData::ABORT == state);
+    }
+  }
+  return ret;
+}
+
 bool ObPartTransCtx::has_persisted_log_() const
 {
   return exec_info_.max_applying_log_ts_.is_valid();
@@ -6524,7 +6586,9 @@ int ObPartTransCtx::do_local_tx_end_(TxEndAction tx_end_action)
 
     switch (tx_end_action) {
     case TxEndAction::COMMIT_TX: {
-      if (sub_state_.is_force_abort()) {
+      if (OB_FAIL(check_elr_prev_trans_())) {
+        TRANS_LOG(WARN, "check elr prev trans failed", K(ret), KPC(this));
+      } else if (sub_state_.is_force_abort()) {
         if (OB_FAIL(compensate_abort_log_())) {
           TRANS_LOG(WARN, "compensate abort log failed", K(ret), K(ls_id_), K(trans_id_),
                     K(tx_end_action), K(sub_state_));
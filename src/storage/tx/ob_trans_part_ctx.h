@@ -204,6 +204,8 @@ public:
 
   // for elr
   bool is_can_elr() const { return can_elr_; }
+  // record the early lock released tx whose data is overwritten or read by this tx
+  int add_elr_prev_trans(const ObTransID &tx_id) { return elr_handler_.add_prev_trans(tx_id); }
 
   int check_for_standby(const share::SCN &snapshot,
                         bool &can_read,
@@ -256,6 +258,9 @@ private:
 
   // force abort but not submit abort log
   bool need_force_abort_() const;
+  // set force abort if any elr prev trans has aborted
+  int check_elr_prev_trans_();
+  int check_elr_prev_trans_aborted_(const ObTransID &prev_tx_id, bool &is_aborted);
   // force abort but wait abort log_cb
   bool is_force_abort_logging_() const;
 
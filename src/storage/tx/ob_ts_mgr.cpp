@@ -187,6 +187,8 @@ int ObTsMgr::start()
     TRANS_LOG(ERROR, "ObTsMgr is already running", KR(ret));
   } else if (OB_FAIL(gts_request_rpc_->start())) {
     TRANS_LOG(WARN, "gts request rpc start", KR(ret));
+  } else if (OB_FAIL(set_thread_count(TS_MGR_THREAD_COUNT))) {
+    TRANS_LOG(WARN, "set thread count failed", KR(ret));
     // 启动gts任务刷新线程
   } else if (OB_FAIL(share::ObThreadPool::start())) {
     TRANS_LOG(ERROR, "GTS local cache manager refresh worker thread start error", KR(ret));
@@ -254,8 +256,27 @@ void ObTsMgr::destroy()
   location_adapter_def_.destroy();
 }
 
-// 执行gts任务刷新，由一个专门的线程来负责
 void ObTsMgr::run1()
+{
+  if (QUERY_DEFERRED_GTS_THREAD_IDX == static_cast<int64_t>(get_thread_idx())) {
+    query_deferred_gts_loop_();
+  } else {
+    refresh_gts_loop_();
+  }
+}
+
+void ObTsMgr::query_deferred_gts_loop_()
+{
+  ObGtsQueryDeferredFunctor query_deferred_functor;
+  lib::set_thread_name("TsMgrDeferRpc");
+  while (!has_set_stop()) {
+    ob_usleep(QUERY_DEFERRED_GTS_INTERVAL_US);
+    ts_source_info_map_.for_each(query_deferred_functor);
+  }
+}
+
+// 执行gts任务刷新，由一个专门的线程来负责
+void ObTsMgr::refresh_gts_loop_()
 {
   int ret = OB_SUCCESS;
   ObSEArray<uint64_t, 1> ids;
@@ -30,6 +30,7 @@
 #include "ob_location_adapter.h"
 
 #define REFRESH_GTS_INTERVEL_US  (100 * 1000)
+#define QUERY_DEFERRED_GTS_INTERVAL_US  (1 * 1000)
 
 namespace oceanbase
 {
@@ -177,6 +178,23 @@ public:
   }
 };
 
+// send deferred gts rpcs whose rpc interval has expired
+class ObGtsQueryDeferredFunctor
+{
+public:
+  ObGtsQueryDeferredFunctor() {}
+  ~ObGtsQueryDeferredFunctor() {}
+  bool operator()(const ObTsTenantInfo &gts_tenant_info, ObTsSourceInfo *ts_source_info)
+  {
+    UNUSED(gts_tenant_info);
+    ObGtsSource *gts_source = NULL;
+    if (OB_NOT_NULL(ts_source_info) && NULL != (gts_source = ts_source_info->get_gts_source())) {
+      gts_source->query_deferred_gts();
+    }
+    return true;
+  }
+};
+
 class GetObsoleteTenantFunctor
 {
 public:
@@ -309,7 +327,12 @@ public:
 private:
   static const int64_t TS_SOURCE_INFO_OBSOLETE_TIME = 120 * 1000 * 1000;
   static const int64_t TS_SOURCE_INFO_CACHE_NUM = 4096;
+  // thread 0 refreshes gts and recycles tenants, thread 1 sends deferred gts rpcs
+  static const int64_t TS_MGR_THREAD_COUNT = 2;
+  static const int64_t QUERY_DEFERRED_GTS_THREAD_IDX = 1;
 private:
+  void refresh_gts_loop_();
+  void query_deferred_gts_loop_();
   int get_ts_source_info_opt_(const uint64_t tenant_id, ObTsSourceInfoGuard &guard,
       const bool need_create_tenant, const bool need_update_access_ts);
   int get_ts_source_info_(const uint64_t tenant_id, ObTsSourceInfoGuard &guard,
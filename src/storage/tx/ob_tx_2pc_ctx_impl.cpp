@@ -75,6 +75,10 @@ int ObPartTransCtx::do_prepare(bool &no_need_submit_log)
   int ret = OB_SUCCESS;
   no_need_submit_log = false;
 
+  if (OB_FAIL(check_elr_prev_trans_())) {
+    TRANS_LOG(WARN, "check elr prev trans failed", K(ret), KPC(this));
+  }
+
   if (OB_SUCC(ret)) {
     if (sub_state_.is_force_abort()) {
       if (OB_FAIL(compensate_abort_log_())) {
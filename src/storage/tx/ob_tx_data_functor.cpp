@@ -272,10 +272,18 @@ int LockForReadFunctor::inner_lock_for_read(const ObTxData &tx_data, ObTxCCCtx *
           // Only dml statement can read elr data
           if (ObTxData::ELR_COMMIT == state
               && lock_for_read_arg_.mvcc_acc_ctx_.snapshot_.tx_id_.is_valid()) {
+            memtable::ObMemtableCtx *mem_ctx = lock_for_read_arg_.mvcc_acc_ctx_.get_mem_ctx();
             can_read_ = !tx_data.undo_status_list_.is_contain(data_sql_sequence);
             trans_version_ = commit_version;
             // TODO(handora.qc): use better implementaion to remove it
             is_determined_state_ = true;
+            // the reader depends on the elr tx which is not committed yet(ELR_COMMIT),
+            // and must abort if it aborts finally
+            if (can_read_
+                && NULL != mem_ctx
+                && OB_FAIL(mem_ctx->add_elr_prev_trans(data_tx_id))) {
+              TRANS_LOG(WARN, "add elr prev trans failed", K(ret), K(data_tx_id), K(lock_for_read_arg_));
+            }
           } else {
             // Case 2.2.3: data is in prepare state and the prepare version is
             // smaller than the read txn's snapshot version, then the data's
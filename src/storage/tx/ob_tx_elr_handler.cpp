@@ -17,6 +17,7 @@
 
 namespace oceanbase
 {
+using namespace common;
 namespace transaction
 {
 
@@ -24,6 +25,9 @@ void ObTxELRHandler::reset()
 {
   elr_prepared_state_ = TxELRState::ELR_INIT;
   mt_ctx_ = NULL;
+  ObSpinLockGuard guard(prev_trans_lock_);
+  prev_trans_arr_.reset();
+  ATOMIC_STORE(&prev_trans_cnt_, 0);
 }
 
 int ObTxELRHandler::check_and_early_lock_release(ObPartTransCtx *ctx)
@@ -43,5 +47,35 @@ int ObTxELRHandler::check_and_early_lock_release(ObPartTransCtx *ctx)
   return ret;
 }
 
+int ObTxELRHandler::add_prev_trans(const ObTransID &tx_id)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!tx_id.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), K(tx_id));
+  } else {
+    ObSpinLockGuard guard(prev_trans_lock_);
+    // hot rows are overwritten by the same prev trans repeatedly, so check the last one first
+    bool exist = false;
+    for (int64_t i = prev_trans_arr_.count() - 1; !exist && i >= 0; i--) {
+      exist = (tx_id == prev_trans_arr_.at(i));
+    }
+    if (exist) {
+      // do nothing
+    } else if (OB_FAIL(prev_trans_arr_.push_back(tx_id))) {
+      TRANS_LOG(WARN, "push back prev trans failed", K(ret), K(tx_id));
+    } else {
+      ATOMIC_STORE(&prev_trans_cnt_, prev_trans_arr_.count());
+    }
+  }
+  return ret;
+}
+
+int ObTxELRHandler::get_prev_trans(ObIArray<ObTransID> &prev_trans) const
+{
+  ObSpinLockGuard guard(prev_trans_lock_);
+  return prev_trans.assign(prev_trans_arr_);
+}
+
 } //transaction
 } //oceanbase
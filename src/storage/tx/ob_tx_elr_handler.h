@@ -14,6 +14,7 @@
 #define OCEANBASE_TX_ELR_HANDLER_
 
 #include "ob_trans_define.h"
+#include "lib/lock/ob_spin_lock.h"
 
 namespace oceanbase
 {
@@ -36,10 +37,16 @@ enum TxELRState
   ELR_PREPARED = 2
 };
 
+// Besides releasing the locks of itself, the handler records the early lock released
+// txs whose data has been overwritten or read by this tx (prev trans). These txs have
+// submitted commit log but may still abort (e.g. the log fails to be persisted), and
+// this tx must abort too in that case (cascading abort), see
+// ObPartTransCtx::check_elr_prev_trans_.
 class ObTxELRHandler
 {
 public:
-  ObTxELRHandler() : elr_prepared_state_(ELR_INIT), mt_ctx_(NULL) {}
+  ObTxELRHandler()
+    : elr_prepared_state_(ELR_INIT), mt_ctx_(NULL), prev_trans_lock_(), prev_trans_arr_(), prev_trans_cnt_(0) {}
   void reset();
 
   int check_and_early_lock_release(ObPartTransCtx *ctx);
@@ -50,11 +57,20 @@ public:
   void set_elr_prepared() { ATOMIC_STORE(&elr_prepared_state_, TxELRState::ELR_PREPARED); }
   bool is_elr_prepared() const { return TxELRState::ELR_PREPARED == ATOMIC_LOAD(&elr_prepared_state_); }
   void reset_elr_state() { ATOMIC_STORE(&elr_prepared_state_, TxELRState::ELR_INIT); }
-  TO_STRING_KV(K_(elr_prepared_state), KP_(mt_ctx));
+
+  // prev trans, called by concurrent writers and readers of this tx
+  int add_prev_trans(const ObTransID &tx_id);
+  int get_prev_trans(common::ObIArray<ObTransID> &prev_trans) const;
+  bool has_prev_trans() const { return ATOMIC_LOAD(&prev_trans_cnt_) > 0; }
+  TO_STRING_KV(K_(elr_prepared_state), KP_(mt_ctx), K_(prev_trans_cnt));
 private:
+  typedef common::ObSEArray<ObTransID, 4> PrevTransArray;
   // whether it is ready for elr
   TxELRState elr_prepared_state_;
   memtable::ObMemtableCtx *mt_ctx_;
+  mutable common::ObSpinLock prev_trans_lock_;
+  PrevTransArray prev_trans_arr_;
+  int64_t prev_trans_cnt_;
 };
 
 } // transaction
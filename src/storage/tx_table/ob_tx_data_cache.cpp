@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/tx_table/ob_tx_data_cache.h"
+#include "storage/tx/ob_tx_data_define.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+using namespace blocksstable;
+
+namespace storage
+{
+
+/***************************** ObTxDataCacheKey **********************************/
+
+bool ObTxDataCacheKey::operator ==(const ObIKVCacheKey &other) const
+{
+  const ObTxDataCacheKey &other_key = reinterpret_cast<const ObTxDataCacheKey &>(other);
+  return tenant_id_ == other_key.tenant_id_
+      && ls_id_ == other_key.ls_id_
+      && tx_id_ == other_key.tx_id_;
+}
+
+uint64_t ObTxDataCacheKey::hash() const
+{
+  uint64_t hash_val = tx_id_.hash();
+  hash_val = murmurhash(&tenant_id_, sizeof(tenant_id_), hash_val);
+  hash_val = murmurhash(&ls_id_, sizeof(ls_id_), hash_val);
+  return hash_val;
+}
+
+int ObTxDataCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(NULL == buf || buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    STORAGE_LOG(WARN, "invalid tx data cache key", K(ret), KPC(this));
+  } else {
+    key = new (buf) ObTxDataCacheKey(tenant_id_, ls_id_, tx_id_);
+  }
+  return ret;
+}
+
+/***************************** ObTxDataCacheValue **********************************/
+
+int ObTxDataCacheValue::init(const ObTxData &tx_data, ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  const int64_t serialize_size = tx_data.get_serialize_size();
+  int64_t pos = 0;
+  char *buf = NULL;
+  if (OB_UNLIKELY(serialize_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid tx data", K(ret), K(tx_data));
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(serialize_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "alloc memory failed", K(ret), K(serialize_size));
+  } else if (OB_FAIL(tx_data.serialize(buf, serialize_size, pos))) {
+    STORAGE_LOG(WARN, "serialize tx data failed", K(ret), K(tx_data));
+  } else {
+    buf_ = buf;
+    buf_len_ = pos;
+  }
+  return ret;
+}
+
+int ObTxDataCacheValue::get_tx_data(const ObTransID &tx_id,
+                                    ObTxData &tx_data,
+                                    ObSliceAlloc &slice_allocator) const
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    STORAGE_LOG(WARN, "invalid tx data cache value", K(ret), KPC(this));
+  } else if (FALSE_IT(tx_data.tx_id_ = tx_id)) {
+  } else if (OB_FAIL(tx_data.deserialize(buf_, buf_len_, pos, slice_allocator))) {
+    STORAGE_LOG(WARN, "deserialize tx data failed", K(ret), K(tx_id), KPC(this));
+  }
+  return ret;
+}
+
+int ObTxDataCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(NULL == buf || buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    STORAGE_LOG(WARN, "invalid tx data cache value", K(ret), KPC(this));
+  } else {
+    ObTxDataCacheValue *pvalue = new (buf) ObTxDataCacheValue();
+    pvalue->buf_ = buf + sizeof(*this);
+    pvalue->buf_len_ = buf_len_;
+    MEMCPY(pvalue->buf_, buf_, buf_len_);
+    value = pvalue;
+  }
+  return ret;
+}
+
+/***************************** ObTxDataKVCache **********************************/
+
+int ObTxDataKVCache::get_tx_data(const ObTxDataCacheKey &key,
+                                 ObTxData &tx_data,
+                                 ObSliceAlloc &slice_allocator)
+{
+  int ret = OB_SUCCESS;
+  const ObTxDataCacheValue *value = NULL;
+  ObKVCacheHandle handle;
+  if (OB_UNLIKELY(!key.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid tx data cache key", K(ret), K(key));
+  } else if (OB_FAIL(get(key, value, handle))) {
+    if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != ret)) {
+      STORAGE_LOG(WARN, "get tx data from cache failed", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(value)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "unexpected null tx data cache value", K(ret), K(key));
+  } else if (OB_FAIL(value->get_tx_data(key.get_tx_id(), tx_data, slice_allocator))) {
+    STORAGE_LOG(WARN, "get tx data from cache value failed", K(ret), K(key));
+  }
+  return ret;
+}
+
+int ObTxDataKVCache::put_tx_data(const ObTxDataCacheKey &key, const ObTxData &tx_data)
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator allocator("TxDataCache", OB_MALLOC_NORMAL_BLOCK_SIZE, key.get_tenant_id());
+  ObTxDataCacheValue value;
+  if (OB_UNLIKELY(!key.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid tx data cache key", K(ret), K(key));
+  } else if (OB_FAIL(value.init(tx_data, allocator))) {
+    STORAGE_LOG(WARN, "init tx data cache value failed", K(ret), K(key), K(tx_data));
+  } else if (OB_FAIL(put(key, value, true /*overwrite*/))) {
+    STORAGE_LOG(WARN, "put tx data into cache failed", K(ret), K(key));
+  }
+  return ret;
+}
+
+/***************************** ObTxDataBFCacheKey **********************************/
+
+bool ObTxDataBFCacheKey::operator ==(const ObIKVCacheKey &other) const
+{
+  const ObTxDataBFCacheKey &other_key = reinterpret_cast<const ObTxDataBFCacheKey &>(other);
+  return tenant_id_ == other_key.tenant_id_
+      && ls_id_ == other_key.ls_id_
+      && table_key_ == other_key.table_key_
+      && data_checksum_ == other_key.data_checksum_;
+}
+
+uint64_t ObTxDataBFCacheKey::hash() const
+{
+  uint64_t hash_val = table_key_.hash();
+  hash_val = murmurhash(&tenant_id_, sizeof(tenant_id_), hash_val);
+  hash_val = murmurhash(&ls_id_, sizeof(ls_id_), hash_val);
+  hash_val = murmurhash(&data_checksum_, sizeof(data_checksum_), hash_val);
+  return hash_val;
+}
+
+int ObTxDataBFCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(NULL == buf || buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    STORAGE_LOG(WARN, "invalid tx data bloom filter cache key", K(ret), KPC(this));
+  } else {
+    key = new (buf) ObTxDataBFCacheKey(tenant_id_, ls_id_, table_key_, data_checksum_);
+  }
+  return ret;
+}
+
+/***************************** ObTxDataBFCache **********************************/
+
+int ObTxDataBFCache::may_contain(const ObTxDataBFCacheKey &key,
+                                 const ObTransID &tx_id,
+                                 bool &is_contain)
+{
+  int ret = OB_SUCCESS;
+  const ObBloomFilterCacheValue *value = NULL;
+  ObKVCacheHandle handle;
+  is_contain = true;
+  if (OB_UNLIKELY(!key.is_valid() || !tx_id.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), K(key), K(tx_id));
+  } else if (OB_FAIL(get(key, value, handle))) {
+    if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != ret)) {
+      STORAGE_LOG(WARN, "get tx data bloom filter from cache failed", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(value)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "unexpected null bloom filter cache value", K(ret), K(key));
+  } else if (OB_FAIL(value->may_contain(hash_tx_id(tx_id), is_contain))) {
+    STORAGE_LOG(WARN, "check bloom filter failed", K(ret), K(key), K(tx_id));
+  }
+  return ret;
+}
+
+int ObTxDataBFCache::put_bloom_filter(const ObTxDataBFCacheKey &key,
+                                      const ObBloomFilterCacheValue &value)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!key.is_valid() || !value.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), K(key), K(value));
+  } else if (OB_FAIL(put(key, value, true /*overwrite*/))) {
+    STORAGE_LOG(WARN, "put tx data bloom filter into cache failed", K(ret), K(key));
+  }
+  return ret;
+}
+
+uint32_t ObTxDataBFCache::hash_tx_id(const ObTransID &tx_id)
+{
+  return static_cast<uint32_t>(tx_id.hash());
+}
+
+}  // namespace storage
+}  // namespace oceanbase
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_OB_TX_DATA_CACHE
+#define OCEANBASE_STORAGE_OB_TX_DATA_CACHE
+
+#include "lib/allocator/ob_slice_alloc.h"
+#include "share/cache/ob_kv_storecache.h"
+#include "share/ob_ls_id.h"
+#include "storage/blocksstable/ob_bloom_filter_cache.h"
+#include "storage/ob_i_table.h"
+#include "storage/tx/ob_trans_define.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+class ObTxData;
+
+// Cache of the tx data read from tx data sstables. Only decided (commit or abort)
+// tx data is cached, because it never changes once it is dumped into sstables.
+class ObTxDataCacheKey : public common::ObIKVCacheKey
+{
+public:
+  ObTxDataCacheKey() : tenant_id_(0), ls_id_(), tx_id_() {}
+  ObTxDataCacheKey(const uint64_t tenant_id,
+                   const share::ObLSID &ls_id,
+                   const transaction::ObTransID &tx_id)
+    : tenant_id_(tenant_id), ls_id_(ls_id), tx_id_(tx_id) {}
+  virtual ~ObTxDataCacheKey() {}
+  virtual bool operator ==(const common::ObIKVCacheKey &other) const override;
+  virtual uint64_t hash() const override;
+  virtual uint64_t get_tenant_id() const override { return tenant_id_; }
+  virtual int64_t size() const override { return sizeof(*this); }
+  virtual int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheKey *&key) const override;
+  bool is_valid() const { return common::OB_INVALID_TENANT_ID != tenant_id_ && ls_id_.is_valid() && tx_id_.is_valid(); }
+  const transaction::ObTransID &get_tx_id() const { return tx_id_; }
+  TO_STRING_KV(K_(tenant_id), K_(ls_id), K_(tx_id));
+private:
+  uint64_t tenant_id_;
+  share::ObLSID ls_id_;
+  transaction::ObTransID tx_id_;
+};
+
+// The value is the serialized tx data, the same format as it is stored in sstable.
+class ObTxDataCacheValue : public common::ObIKVCacheValue
+{
+public:
+  ObTxDataCacheValue() : buf_(NULL), buf_len_(0) {}
+  virtual ~ObTxDataCacheValue() {}
+  // serialize the tx data into buffer allocated by allocator
+  int init(const ObTxData &tx_data, common::ObIAllocator &allocator);
+  // the undo status nodes of tx data are allocated by slice allocator and should be
+  // freed by caller.
+  int get_tx_data(const transaction::ObTransID &tx_id,
+                  ObTxData &tx_data,
+                  ObSliceAlloc &slice_allocator) const;
+  virtual int64_t size() const override { return sizeof(*this) + buf_len_; }
+  virtual int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheValue *&value) const override;
+  bool is_valid() const { return NULL != buf_ && buf_len_ > 0; }
+  TO_STRING_KV(KP_(buf), K_(buf_len));
+private:
+  char *buf_;
+  int64_t buf_len_;
+};
+
+class ObTxDataKVCache : public common::ObKVCache<ObTxDataCacheKey, ObTxDataCacheValue>
+{
+public:
+  ObTxDataKVCache() {}
+  virtual ~ObTxDataKVCache() {}
+  // @retval OB_ENTRY_NOT_EXIST, the tx data is not cached
+  int get_tx_data(const ObTxDataCacheKey &key, ObTxData &tx_data, ObSliceAlloc &slice_allocator);
+  int put_tx_data(const ObTxDataCacheKey &key, const ObTxData &tx_data);
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObTxDataKVCache);
+};
+
+// Bloom filter on the tx ids of a tx data sstable. It is built after the sstable
+// is created by merge, so the lookups skip sstables which do not contain the tx
+// data. The data checksum tells apart sstables with the same table key, e.g.
+// sstables of a rebuilt ls.
+class ObTxDataBFCacheKey : public common::ObIKVCacheKey
+{
+public:
+  ObTxDataBFCacheKey() : tenant_id_(0), ls_id_(), table_key_(), data_checksum_(0) {}
+  ObTxDataBFCacheKey(const uint64_t tenant_id,
+                     const share::ObLSID &ls_id,
+                     const ObITable::TableKey &table_key,
+                     const int64_t data_checksum)
+    : tenant_id_(tenant_id), ls_id_(ls_id), table_key_(table_key), data_checksum_(data_checksum) {}
+  virtual ~ObTxDataBFCacheKey() {}
+  virtual bool operator ==(const common::ObIKVCacheKey &other) const override;
+  virtual uint64_t hash() const override;
+  virtual uint64_t get_tenant_id() const override { return tenant_id_; }
+  virtual int64_t size() const override { return sizeof(*this); }
+  virtual int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheKey *&key) const override;
+  bool is_valid() const { return common::OB_INVALID_TENANT_ID != tenant_id_ && ls_id_.is_valid() && table_key_.is_valid(); }
+  TO_STRING_KV(K_(tenant_id), K_(ls_id), K_(table_key), K_(data_checksum));
+private:
+  uint64_t tenant_id_;
+  share::ObLSID ls_id_;
+  ObITable::TableKey table_key_;
+  int64_t data_checksum_;
+};
+
+class ObTxDataBFCache : public common::ObKVCache<ObTxDataBFCacheKey, blocksstable::ObBloomFilterCacheValue>
+{
+public:
+  ObTxDataBFCache() {}
+  virtual ~ObTxDataBFCache() {}
+  // @retval OB_ENTRY_NOT_EXIST, the bloom filter has not been built or has been evicted
+  int may_contain(const ObTxDataBFCacheKey &key, const transaction::ObTransID &tx_id, bool &is_contain);
+  int put_bloom_filter(const ObTxDataBFCacheKey &key, const blocksstable::ObBloomFilterCacheValue &value);
+  static uint32_t hash_tx_id(const transaction::ObTransID &tx_id);
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObTxDataBFCache);
+};
+
+}  // namespace storage
+}  // namespace oceanbase
+
+#endif  // OCEANBASE_STORAGE_OB_TX_DATA_CACHE
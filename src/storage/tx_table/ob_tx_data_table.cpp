@@ -24,6 +24,7 @@
 #include "storage/tx_table/ob_tx_ctx_table.h"
 #include "storage/tx_table/ob_tx_table_define.h"
 #include "storage/tablet/ob_tablet.h"
+#include "storage/blocksstable/ob_storage_cache_suite.h"
 
 #define USING_LOG_PREFIX STORAGE
 
@@ -645,11 +646,10 @@ int ObTxDataTable::get_tx_data_in_memtables_cache_(const ObTransID tx_id,
 }
 
 // For ease of understanding, this function can be regarded as the following steps:
-// 1. Try to get tx data from sstable cache if we want to use the cache.
-// 2. If we 1) dont want to get tx data from cache; 2) get from cache failed; 3) get an tx data with
-// running state from cachce, trying to get tx data from sstable.
+// 1. Try to get tx data from tx data kv cache, only decided tx data is cached.
+// 2. If it is not cached, get tx data from sstables and put it into the kv cache if decided.
 // 3. Call functor with tx data.
-// 4. Free or revert tx data according to where it is from.
+// 4. Free the undo status list which is allocated by slice allocator.
 int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataCheckFunctor &fn)
 {
   int ret = OB_SUCCESS;
@@ -670,6 +670,53 @@ int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataChe
 }
 
 int ObTxDataTable::get_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObTxData &tx_data)
+{
+  int ret = OB_SUCCESS;
+  if (OB_SUCC(get_tx_data_in_kv_cache_(tx_id, tx_data))) {
+    // hit the tx data kv cache
+  } else if (OB_FAIL(read_tx_data_from_sstables_(tx_id, tx_data))) {
+    if (OB_TRANS_CTX_NOT_EXIST != ret) {
+      STORAGE_LOG(WARN, "read tx data from sstables failed", KR(ret), K(tx_id));
+    }
+  } else {
+    put_tx_data_into_kv_cache_(tx_data);
+  }
+  return ret;
+}
+
+int ObTxDataTable::get_tx_data_in_kv_cache_(const transaction::ObTransID tx_id, ObTxData &tx_data)
+{
+  int ret = OB_SUCCESS;
+  ObTxDataCacheKey key(MTL_ID(), get_ls_id(), tx_id);
+  if (OB_UNLIKELY(!OB_STORE_CACHE.is_inited())) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(OB_STORE_CACHE.get_tx_data_cache().get_tx_data(key, tx_data, slice_allocator_))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      STORAGE_LOG(WARN, "get tx data from kv cache failed", KR(ret), K(key));
+    }
+    // the tx data may be partially deserialized, read it from sstables again
+    if (OB_NOT_NULL(tx_data.undo_status_list_.head_)) {
+      free_undo_status_list_(tx_data.undo_status_list_.head_);
+    }
+    tx_data.reset();
+  }
+  return ret;
+}
+
+void ObTxDataTable::put_tx_data_into_kv_cache_(const ObTxData &tx_data)
+{
+  int tmp_ret = OB_SUCCESS;
+  // the tx data of running tx may be updated by following undo actions
+  if ((ObTxData::COMMIT == tx_data.state_ || ObTxData::ABORT == tx_data.state_)
+      && OB_STORE_CACHE.is_inited()) {
+    ObTxDataCacheKey key(MTL_ID(), get_ls_id(), tx_data.tx_id_);
+    if (OB_TMP_FAIL(OB_STORE_CACHE.get_tx_data_cache().put_tx_data(key, tx_data))) {
+      STORAGE_LOG_RET(WARN, tmp_ret, "put tx data into kv cache failed", K(tmp_ret), K(key));
+    }
+  }
+}
+
+int ObTxDataTable::read_tx_data_from_sstables_(const transaction::ObTransID tx_id, ObTxData &tx_data)
 {
   int ret = OB_SUCCESS;
   ObTableIterParam iter_param = read_schema_.iter_param_;
@@ -685,7 +732,7 @@ int ObTxDataTable::get_tx_data_in_sstable_(const transaction::ObTransID tx_id, O
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("invalid tablet handle", KR(ret), K(tablet_handle), K(tablet_id_));
   } else {
-    ObTxDataSingleRowGetter getter(iter_param, slice_allocator_);
+    ObTxDataSingleRowGetter getter(iter_param, slice_allocator_, get_ls_id());
     if (OB_FAIL(getter.init(tx_id))) {
       STORAGE_LOG(WARN, "init ObTxDataSingleRowGetter fail.", KR(ret), KP(this), K(tablet_id_));
     } else if (OB_FAIL(getter.get_next_row(tx_data))) {
@@ -700,6 +747,44 @@ int ObTxDataTable::get_tx_data_in_sstable_(const transaction::ObTransID tx_id, O
   return ret;
 }
 
+int ObTxDataTable::build_bloom_filter(ObITable *table)
+{
+  int ret = OB_SUCCESS;
+  ObTableIterParam iter_param = read_schema_.iter_param_;
+  ObTabletHandle &tablet_handle = iter_param.tablet_handle_;
+  blocksstable::ObBloomFilterCacheValue bf_value;
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "tx data table is not inited", KR(ret));
+  } else if (OB_ISNULL(table) || OB_UNLIKELY(!table->is_sstable())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid tx data sstable", KR(ret), KPC(table));
+  } else if (OB_UNLIKELY(!OB_STORE_CACHE.is_inited())
+             || 0 >= static_cast<ObSSTable *>(table)->get_meta().get_row_count()) {
+    // skip building
+  } else if (OB_FAIL(ls_tablet_svr_->get_tablet(tablet_id_, tablet_handle))) {
+    STORAGE_LOG(WARN, "get tablet from ls tablet service fail.", KR(ret), KP(this), K(tablet_id_));
+  } else if (OB_UNLIKELY(!tablet_handle.is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid tablet handle", KR(ret), K(tablet_handle), K(tablet_id_));
+  } else {
+    ObTxDataBFCacheKey key(MTL_ID(),
+                           get_ls_id(),
+                           table->get_key(),
+                           static_cast<ObSSTable *>(table)->get_meta().get_basic_meta().data_checksum_);
+    ObTxDataBloomFilterBuilder builder(iter_param, table);
+    if (OB_FAIL(builder.build(bf_value))) {
+      STORAGE_LOG(WARN, "build tx data bloom filter failed", KR(ret), K(key));
+    } else if (OB_FAIL(OB_STORE_CACHE.get_tx_data_bf_cache().put_bloom_filter(key, bf_value))) {
+      STORAGE_LOG(WARN, "put tx data bloom filter failed", KR(ret), K(key));
+    } else {
+      STORAGE_LOG(INFO, "build tx data bloom filter succeed", K(key), K(bf_value));
+    }
+  }
+  return ret;
+}
+
 int ObTxDataTable::get_recycle_scn(SCN &recycle_scn)
 {
   int ret = OB_SUCCESS;
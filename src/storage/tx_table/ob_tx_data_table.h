@@ -101,11 +101,6 @@ public:
   using SliceAllocator = ObSliceAlloc;
 
   static const int64_t TX_DATA_MAX_CONCURRENCY = 32;
-  // A tx data is 128 bytes, 128 * 262144 = 32MB
-  static const int64_t SSTABLE_CACHE_MAX_RETAIN_CNT = 262144;
-  // The max tps is 150w which means the cache can be inserted 15w tx data during 100ms. So once
-  // cache cleaning task will delete at least 11w tx data.
-  static const int64_t DEFAULT_CACHE_RETAINED_TIME = 100_ms; // 100ms
 
   // The tx data memtable do not need freeze it self if its memory use is less than 1%
   static constexpr double TX_DATA_FREEZE_TRIGGER_MIN_PERCENTAGE = 1;
@@ -210,6 +205,15 @@ public:  // ObTxDataTable
    */
   int supplement_undo_actions_if_exist(ObTxData *tx_data);
 
+  /**
+   * @brief Build the bloom filter of tx ids for the tx data sstable and put it into the kv
+   * cache. It is called after the sstable is created by merge, so the reads of tx data can
+   * skip the sstable without scanning it.
+   *
+   * @param[in] table the tx data sstable created by merge
+   */
+  int build_bloom_filter(ObITable *table);
+
   int self_freeze_task();
 
   int update_memtables_cache();
@@ -252,21 +256,21 @@ private:
 
   int init_arena_allocator_();
 
-  int init_sstable_cache_();
-
-
-  int register_clean_cache_task_();
-
   int check_tx_data_in_memtable_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn);
   int check_tx_data_with_cache_once_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn);
   int get_tx_data_from_cache_(const transaction::ObTransID tx_id, ObTxDataGuard &tx_data_guard, bool &find);
 
   int check_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn);
 
-  int get_tx_data_in_cache_(const transaction::ObTransID tx_id, ObTxData *&tx_data);
-
+  // get tx data from the tx data kv cache first, then the tx data sstables
   int get_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObTxData &tx_data);
 
+  int get_tx_data_in_kv_cache_(const transaction::ObTransID tx_id, ObTxData &tx_data);
+
+  void put_tx_data_into_kv_cache_(const ObTxData &tx_data);
+
+  int read_tx_data_from_sstables_(const transaction::ObTransID tx_id, ObTxData &tx_data);
+
   int insert_(ObTxData *&tx_data, ObTxDataMemtableWriteGuard &write_guard);
 
   int insert_into_memtable_(ObTxDataMemtable *tx_data_memtable, ObTxData *&tx_data);
@@ -314,7 +318,6 @@ private:
   void print_alloc_size_for_test_();
   // free the whole undo status list allocated by slice allocator
   void free_undo_status_list_(ObUndoStatusNode *node_ptr);
-  void clean_sstable_cache_task_(int64_t cache_keeped_time);
   void update_calc_upper_info_(const share::SCN &max_decided_log_ts);
 private:
   static const int64_t LS_TX_DATA_SCHEMA_VERSION = 0;
@@ -339,18 +342,6 @@ private:
 };  // tx_table
 
 
-class CleanTxDataSSTableCacheFunctor
-{
-public:
-  CleanTxDataSSTableCacheFunctor(TxDataMap &sstable_cache, int64_t clean_ts) : sstable_cache_(sstable_cache), clean_ts_(clean_ts) {}
-
-  bool operator()(const transaction::ObTransID &key, ObTxData *tx_data);
-
-private:
-  TxDataMap &sstable_cache_;
-  int64_t clean_ts_;
-};
-
 }  // namespace storage
 
 }  // namespace oceanbase
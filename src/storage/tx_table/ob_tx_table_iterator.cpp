@@ -25,6 +25,7 @@
 #include "storage/tx_table/ob_tx_table.h"
 #include <cmath>
 #include "storage/tablet/ob_tablet.h"
+#include "storage/blocksstable/ob_storage_cache_suite.h"
 
 namespace oceanbase
 {
@@ -515,6 +516,8 @@ int ObTxDataSingleRowGetter::get_row_from_sstables_(blocksstable::ObDatumRowkey
     if (OB_ISNULL(table = sstables[i])) {
       ret = OB_ERR_SYS;
       STORAGE_LOG(ERROR, "Unexpected null table", KR(ret), K(i), K(sstables));
+    } else if (!sstable_may_contain_(table)) {
+      // this tx data not exist in this sstable, try next one
     } else if (OB_FAIL(table->get(iter_param, access_context, row_key, row_iter))) {
       STORAGE_LOG(WARN, "Failed to get param", KR(ret), KPC(table));
     } else if (OB_FAIL(row_iter->get_next_row(row))) {
@@ -590,6 +593,28 @@ int ObTxDataSingleRowGetter::deserialize_tx_data_from_store_buffers_(ObTxData &t
   return ret;
 }
 
+bool ObTxDataSingleRowGetter::sstable_may_contain_(ObITable *table)
+{
+  int ret = OB_SUCCESS;
+  bool may_contain = true;
+  if (!ls_id_.is_valid() || !OB_STORE_CACHE.is_inited() || !table->is_sstable()) {
+    // bloom filter is not used
+  } else {
+    // the bloom filter is built after the sstable is created by merge, read the sstable
+    // directly if it has not been built or has been evicted.
+    ObTxDataBFCacheKey key(MTL_ID(),
+                           ls_id_,
+                           table->get_key(),
+                           static_cast<blocksstable::ObSSTable *>(table)->get_meta().get_basic_meta().data_checksum_);
+    if (OB_FAIL(OB_STORE_CACHE.get_tx_data_bf_cache().may_contain(key, tx_id_, may_contain))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        STORAGE_LOG(WARN, "check tx data bloom filter failed", KR(ret), K(key), K_(tx_id));
+      }
+    }
+  }
+  return OB_SUCCESS == ret ? may_contain : true;
+}
+
 /***************************** ObTxDataSingleRowGetter **********************************/
 
 /***************************** ObCommitVersionsGetter **********************************/
@@ -648,6 +673,73 @@ int ObCommitVersionsGetter::get_next_row(ObCommitVersionsArray &commit_versions)
   return ret;
 }
 
+/***************************** ObTxDataBloomFilterBuilder **********************************/
+
+int ObTxDataBloomFilterBuilder::build(blocksstable::ObBloomFilterCacheValue &bf_value)
+{
+  int ret = OB_SUCCESS;
+  GENERATE_ACCESS_CONTEXT
+  ObStoreRowIterator *row_iter = nullptr;
+  blocksstable::ObDatumRange whole_range;
+  whole_range.set_whole_range();
+  int64_t row_cnt = 0;
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(table_) || OB_UNLIKELY(!table_->is_sstable())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid tx data sstable", KR(ret), KPC(table_));
+  } else if (!iter_param_.tablet_handle_.is_valid()) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(ERROR, "tablet handle in iter param is invalid", KR(ret), K(iter_param_));
+  } else if (OB_UNLIKELY(0 >= (row_cnt = static_cast<blocksstable::ObSSTable *>(table_)->get_meta().get_row_count()))) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "empty tx data sstable", KR(ret), KPC(table_));
+  } else if (OB_FAIL(bf_value.init(1 /*rowkey_column_cnt*/, row_cnt))) {
+    STORAGE_LOG(WARN, "init bloom filter failed", KR(ret), K(row_cnt));
+  } else if (OB_FAIL(table_->scan(iter_param_, access_context, whole_range, row_iter))) {
+    STORAGE_LOG(WARN, "scan tx data sstable failed", KR(ret), KPC(table_));
+  } else if (OB_ISNULL(row_iter)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(ERROR, "row iter is unexpected nullptr", KR(ret), KPC(table_));
+  } else if (OB_FAIL(insert_tx_ids(*row_iter, bf_value))) {
+    STORAGE_LOG(WARN, "insert tx ids into bloom filter failed", KR(ret), KPC(table_));
+  }
+
+  if (OB_NOT_NULL(row_iter)) {
+    row_iter->~ObStoreRowIterator();
+    row_iter = nullptr;
+  }
+  return ret;
+}
+
+int ObTxDataBloomFilterBuilder::insert_tx_ids(ObIStoreRowIterator &row_iter,
+                                              blocksstable::ObBloomFilterCacheValue &bf_value)
+{
+  int ret = OB_SUCCESS;
+  const blocksstable::ObDatumRow *row = nullptr;
+  int64_t last_tx_id = 0;
+  while (OB_SUCC(ret) && OB_SUCC(row_iter.get_next_row(row))) {
+    if (OB_ISNULL(row)) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(ERROR, "unexpected nullptr of row", KR(ret));
+    } else {
+      const int64_t tx_id = row->storage_datums_[TX_DATA_ID_COLUMN].get_int();
+      // skip the commit versions row and the following rows of a tx data
+      if (INT64_MAX == tx_id || last_tx_id == tx_id) {
+        // do nothing
+      } else if (OB_FAIL(bf_value.insert(ObTxDataBFCache::hash_tx_id(transaction::ObTransID(tx_id))))) {
+        STORAGE_LOG(WARN, "insert into bloom filter failed", KR(ret), K(tx_id));
+      } else {
+        last_tx_id = tx_id;
+      }
+    }
+  }
+  if (OB_ITER_END == ret) {
+    ret = OB_SUCCESS;
+  }
+  return ret;
+}
+
 /***************************** ObCommitVersionsGetter **********************************/
 
 int ObTxCtxMemtableScanIterator::init(ObTxCtxMemtable *tx_ctx_memtable)
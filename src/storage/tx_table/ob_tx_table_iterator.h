@@ -25,6 +25,7 @@ namespace oceanbase
 
 namespace blocksstable {
 struct ObDatumRow;
+class ObBloomFilterCacheValue;
 };
 
 namespace transaction
@@ -219,9 +220,11 @@ class ObTxDataSingleRowGetter
 {
   using SliceAllocator = ObSliceAlloc;
 public:
+  // the tx data sstables are filtered by bloom filters of tx ids if ls_id is valid
   ObTxDataSingleRowGetter(const ObTableIterParam & iter_param,
-                          SliceAllocator &slice_allocator)
-      : iter_param_(iter_param), slice_allocator_(slice_allocator), key_datums_() {}
+                          SliceAllocator &slice_allocator,
+                          const share::ObLSID &ls_id = share::ObLSID())
+      : iter_param_(iter_param), slice_allocator_(slice_allocator), ls_id_(ls_id), key_datums_() {}
   virtual ~ObTxDataSingleRowGetter() {}
 
   /**
@@ -241,10 +244,12 @@ private:
                              ObStringHolder &temp_buffer,
                              int64_t &total_need_buffer_cnt);
   OB_NOINLINE int deserialize_tx_data_from_store_buffers_(ObTxData &tx_data);
+  bool sstable_may_contain_(ObITable *table);
 
 private:
   const ObTableIterParam &iter_param_;
   SliceAllocator &slice_allocator_;
+  share::ObLSID ls_id_;
   transaction::ObTransID tx_id_;
   ObArenaAllocator arena_allocator_;
   blocksstable::ObStorageDatum key_datums_[2];
@@ -269,6 +274,27 @@ private:
   blocksstable::ObStorageDatum key_datums_[2];
 };
 
+/**
+ * @brief Using for build the bloom filter of tx ids from a tx data sstable, which is done
+ * after the sstable is created by merge.
+ */
+class ObTxDataBloomFilterBuilder {
+public:
+  ObTxDataBloomFilterBuilder(const ObTableIterParam &iter_param, ObITable *table)
+      : iter_param_(iter_param), table_(table) {}
+  virtual ~ObTxDataBloomFilterBuilder() {}
+
+  int build(blocksstable::ObBloomFilterCacheValue &bf_value);
+  // insert the tx ids of the tx data rows into the inited bloom filter
+  static int insert_tx_ids(ObIStoreRowIterator &row_iter,
+                           blocksstable::ObBloomFilterCacheValue &bf_value);
+
+private:
+  const ObTableIterParam &iter_param_;
+  ObArenaAllocator arena_allocator_;
+  ObITable *table_;
+};
+
 // ObTxCtxMemtableScanIterator is the iterator for tx ctx table merge process
 class ObTxCtxMemtableScanIterator : public memtable::ObIMemtableIterator
 {
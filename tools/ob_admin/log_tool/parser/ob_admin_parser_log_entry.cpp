@@ -25,6 +25,7 @@
 #include "logservice/ob_log_base_header.h"
 #include "logservice/ob_garbage_collector.h"
 #include "logservice/data_dictionary/ob_data_dict_iterator.h"     // ObDataDictIterator
+#include "logservice/palf/log_entry.h"                             // LogEntry
 #include "share/scn.h"
 
 
@@ -44,7 +45,7 @@ ObAdminParserLogEntry::ObAdminParserLogEntry(const LogEntry &entry,
                                              const block_id_t block_id,
                                              const LSN lsn,
                                              const ObAdminMutatorStringArg &str_arg)
-    : buf_(entry.get_data_buf()), buf_len_(entry.get_data_len()), pos_(0),
+    : entry_(entry), decompress_buf_(), buf_(NULL), buf_len_(0), pos_(0),
     scn_val_(entry.get_scn().get_val_for_logservice()), block_id_(block_id), lsn_(lsn), str_arg_()
 {
   str_arg_ = str_arg;
@@ -57,7 +58,10 @@ int ObAdminParserLogEntry::parse()
 {
   int ret = OB_SUCCESS;
   ObLogBaseHeader header;
-  if (OB_FAIL(get_entry_header_(header))) {
+  // data of log entry may be compressed by palf
+  if (OB_FAIL(decompress_buf_.decompress(entry_, buf_, buf_len_))) {
+    LOG_WARN("decompress log entry failed", K(ret), K(entry_), K(block_id_), K(lsn_));
+  } else if (OB_FAIL(get_entry_header_(header))) {
     LOG_WARN("get_entry_header failed", K(ret));
   } else if (OB_FAIL(parse_different_entry_type_(header))){
     LOG_WARN("parse_different_entry_type_ failed", K(ret), K(header));
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "storage/tx/ob_tx_log.h"
 #include "logservice/ob_log_base_type.h"
+#include "logservice/palf/log_compressor.h"
 #include "../ob_admin_log_tool_executor.h"
 
 namespace oceanbase
@@ -76,8 +77,10 @@ private:
                      bool &has_dumped_tx_id);
 
 private:
+  const palf::LogEntry &entry_;
+  palf::LogDecompressBuf decompress_buf_;
   const char *buf_;
-  const int64_t buf_len_;
+  int64_t buf_len_;
   int64_t pos_;
 
   int64_t scn_val_;
@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "ob_obj2str_helper.h"              // ObObj2strHelper
+#include "ob_log_schema_cache_info.h"       // TableSchemaInfo
+#undef private
+#include "share/schema/ob_table_schema.h"   // ObTableSchema
+#include "lib/allocator/page_arena.h"       // ObArenaAllocator
+#include "lib/timezone/ob_timezone_info.h"  // ObTimeZoneInfoWrap
+#include "lib/timezone/ob_time_convert.h"   // ObTimeConverter
+#include "lib/container/ob_array_helper.h"  // ObArrayHelper
+
+using namespace oceanbase::common;
+using namespace oceanbase::share::schema;
+namespace oceanbase
+{
+namespace libobcdc
+{
+
+static const uint64_t TENANT_ID = 1001;
+static const uint64_t TABLE_ID = 500001;
+static const uint64_t COLUMN_ID = 16;
+
+class TestObj2strHelper : public ::testing::Test
+{
+public:
+  TestObj2strHelper() : allocator_("Obj2strTest") {}
+  ~TestObj2strHelper() {}
+  virtual void SetUp()
+  {
+    // only the flags are used by obj2str of fixed length types
+    helper_.enable_output_binary_value_ = true;
+  }
+
+  int obj2str(const ObObj &obj, ObString &str, const bool is_default_value = false)
+  {
+    ObArrayHelper<ObString> extended_type_info;
+    ObAccuracy accuracy;
+    return helper_.obj2str(TENANT_ID, TABLE_ID, COLUMN_ID, obj, str, allocator_, false,
+        extended_type_info, accuracy, CS_TYPE_BINARY, &tz_info_wrap_, is_default_value);
+  }
+
+  template<typename T>
+  void check_binary(const ObObj &obj, const T expect)
+  {
+    ObString str;
+    T value;
+    ASSERT_EQ(OB_SUCCESS, obj2str(obj, str));
+    ASSERT_EQ(static_cast<int64_t>(sizeof(T)), str.length());
+    MEMCPY(&value, str.ptr(), sizeof(T));
+    ASSERT_EQ(0, MEMCMP(&expect, &value, sizeof(T)));
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObTimeZoneInfoWrap tz_info_wrap_;
+  ObObj2strHelper helper_;
+};
+
+TEST_F(TestObj2strHelper, fixed_length_binary)
+{
+  ObObj obj;
+  const int64_t int_values[] = {0, 1, -1, INT32_MAX, INT64_MAX, INT64_MIN};
+  for (int64_t i = 0; i < ARRAYSIZEOF(int_values); i++) {
+    obj.set_int(int_values[i]);
+    check_binary<int64_t>(obj, int_values[i]);
+  }
+  obj.set_uint64(UINT64_MAX);
+  check_binary<uint64_t>(obj, UINT64_MAX);
+  obj.set_bit(0x5a5a);
+  check_binary<uint64_t>(obj, 0x5a5a);
+  obj.set_float(-1.5f);
+  check_binary<float>(obj, -1.5f);
+  obj.set_double(3.14159265358979);
+  check_binary<double>(obj, 3.14159265358979);
+
+  // 2024-01-02 03:04:05.678901
+  const int64_t usec = 1704164645678901L;
+  obj.set_datetime(usec);
+  check_binary<int64_t>(obj, usec);
+  obj.set_timestamp(usec);
+  check_binary<int64_t>(obj, usec);
+  // -838:59:59
+  obj.set_time(-3020399000000L);
+  check_binary<int64_t>(obj, -3020399000000L);
+  // 2024-01-02, days since 1970-01-01
+  obj.set_date(19724);
+  check_binary<int32_t>(obj, 19724);
+  obj.set_date(ObTimeConverter::ZERO_DATE);
+  check_binary<int32_t>(obj, ObTimeConverter::ZERO_DATE);
+}
+
+TEST_F(TestObj2strHelper, year_offset)
+{
+  ObObj obj;
+  uint8_t year = 0;
+  // year is an offset to 1900, 0 is year 0000
+  ASSERT_EQ(OB_SUCCESS, ObTimeConverter::int_to_year(2024, year));
+  obj.set_year(year);
+  check_binary<uint8_t>(obj, 124);
+  ASSERT_EQ(OB_SUCCESS, ObTimeConverter::int_to_year(1901, year));
+  obj.set_year(year);
+  check_binary<uint8_t>(obj, 1);
+  ASSERT_EQ(OB_SUCCESS, ObTimeConverter::int_to_year(2155, year));
+  obj.set_year(year);
+  check_binary<uint8_t>(obj, 255);
+  obj.set_year(ObTimeConverter::ZERO_YEAR);
+  check_binary<uint8_t>(obj, 0);
+}
+
+TEST_F(TestObj2strHelper, keep_text)
+{
+  ObObj obj;
+  ObString str;
+  // default value of schema is always text
+  obj.set_int(-42);
+  ASSERT_EQ(OB_SUCCESS, obj2str(obj, str, true));
+  ASSERT_EQ(ObString::make_string("-42"), str);
+  obj.set_double(2.5);
+  ASSERT_EQ(OB_SUCCESS, obj2str(obj, str, true));
+  ASSERT_EQ(ObString::make_string("2.5"), str);
+  obj.set_bit(7);
+  ASSERT_EQ(OB_SUCCESS, obj2str(obj, str, true));
+  ASSERT_EQ(ObString::make_string("7"), str);
+
+  // variable length types are not changed
+  obj.set_varchar("abc");
+  obj.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  ASSERT_EQ(OB_SUCCESS, obj2str(obj, str));
+  ASSERT_EQ(ObString::make_string("abc"), str);
+  obj.set_null();
+  ASSERT_EQ(OB_SUCCESS, obj2str(obj, str));
+  ASSERT_TRUE(str.empty());
+
+  // same as default value when disabled
+  helper_.enable_output_binary_value_ = false;
+  obj.set_int(-42);
+  ASSERT_EQ(OB_SUCCESS, obj2str(obj, str));
+  ASSERT_EQ(ObString::make_string("-42"), str);
+}
+
+void fill_column(ObColumnSchemaV2 &column, const uint64_t column_id, const char *name,
+    const int64_t rowkey_pos, const ObObj &default_value)
+{
+  column.set_column_id(column_id);
+  column.set_column_name(ObString::make_string(name));
+  column.set_rowkey_position(rowkey_pos);
+  column.set_data_type(default_value.get_type());
+  column.set_charset_type(CHARSET_UTF8MB4);
+  column.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  column.set_orig_default_value(default_value);
+  column.set_cur_default_value(default_value);
+}
+
+TEST_F(TestObj2strHelper, default_value_in_binary_row)
+{
+  ObTableSchema table_schema;
+  ObColumnSchemaV2 column;
+  ObObj value;
+  table_schema.set_tenant_id(TENANT_ID);
+  table_schema.set_table_id(TABLE_ID);
+  table_schema.set_table_type(USER_TABLE);
+  table_schema.set_max_used_column_id(COLUMN_ID + 2);
+  // c1 int primary key, c2 int default 7, c3 varchar default 'x'
+  value.set_int(0);
+  fill_column(column, COLUMN_ID, "c1", 1, value);
+  ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+  column.reset();
+  value.set_int(7);
+  fill_column(column, COLUMN_ID + 1, "c2", 0, value);
+  ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+  column.reset();
+  value.set_varchar("x");
+  value.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  fill_column(column, COLUMN_ID + 2, "c3", 0, value);
+  ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+
+  TableSchemaInfo table_schema_info(allocator_);
+  ASSERT_EQ(OB_SUCCESS, table_schema_info.init(&table_schema));
+  for (int16_t idx = 0; idx < 3; idx++) {
+    const ObColumnSchemaV2 *column_schema = table_schema.get_column_schema(COLUMN_ID + idx);
+    ASSERT_TRUE(NULL != column_schema);
+    ASSERT_EQ(OB_SUCCESS, table_schema_info.init_column_schema_info(table_schema, *column_schema,
+        idx, true, idx, &tz_info_wrap_, helper_));
+  }
+
+  // row of insert into t(c1) values(-1): c1 is explicit, c2 and c3 are filled with default value
+  ColumnSchemaInfo *column_schema_info = NULL;
+  ObString explicit_str;
+  value.set_int(-1);
+  ASSERT_EQ(OB_SUCCESS, obj2str(value, explicit_str));
+  ASSERT_EQ(static_cast<int64_t>(sizeof(int64_t)), explicit_str.length());
+
+  // binary in row as the explicit value, text in table meta
+  int64_t int_value = 0;
+  ASSERT_EQ(OB_SUCCESS, table_schema_info.get_column_schema_info(1, true, column_schema_info));
+  ASSERT_TRUE(NULL != column_schema_info);
+  const ObString *row_default = column_schema_info->get_row_default_value_str();
+  ASSERT_TRUE(NULL != row_default);
+  ASSERT_EQ(explicit_str.length(), row_default->length());
+  MEMCPY(&int_value, row_default->ptr(), sizeof(int_value));
+  ASSERT_EQ(7, int_value);
+  ASSERT_EQ(ObString::make_string("7"), *column_schema_info->get_orig_default_value_str());
+
+  // variable length column is the same in row and table meta
+  ASSERT_EQ(OB_SUCCESS, table_schema_info.get_column_schema_info(2, true, column_schema_info));
+  ASSERT_TRUE(NULL != column_schema_info);
+  ASSERT_EQ(ObString::make_string("x"), *column_schema_info->get_row_default_value_str());
+  ASSERT_EQ(column_schema_info->get_orig_default_value_str(), column_schema_info->get_row_default_value_str());
+  ASSERT_FALSE(helper_.is_binary_output_obj(value));
+
+  table_schema_info.destroy();
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_ob_obj2str_helper.log", true);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,8 @@
 #include "logservice/palf/log_define.h"
 #include "logservice/palf/log_group_entry.h"
 #include "logservice/palf/log_writer_utils.h"
+#include "logservice/palf/log_compressor.h"
+#include "lib/random/ob_random.h"
 #define private public
 #include "logservice/palf/log_group_entry_header.h"
 #include "logservice/palf/log_entry.h"
@@ -220,6 +222,54 @@ TEST(TestLogGroupEntryHeader, test_log_group_entry_header)
   EXPECT_TRUE(log_group_entry2.check_integrity());
 }
 
+TEST(TestLogEntry, test_compressed_log_entry)
+{
+  const int64_t DATA_LEN = 16 * 1024;
+  const int64_t BUFSIZE = 2 * DATA_LEN;
+  char data[DATA_LEN];
+  char compressed[BUFSIZE];
+  for (int64_t i = 0; i < DATA_LEN; i++) {
+    data[i] = static_cast<char>('a' + (i % 8));
+  }
+  int64_t max_size = 0;
+  int64_t compressed_len = 0;
+  EXPECT_EQ(OB_SUCCESS, LogCompressor::get_max_compressed_size(LZ4_COMPRESSOR, DATA_LEN, max_size));
+  EXPECT_GE(BUFSIZE, max_size);
+  EXPECT_EQ(OB_SUCCESS, LogCompressor::compress(LZ4_COMPRESSOR, data, DATA_LEN, compressed, BUFSIZE, compressed_len));
+  EXPECT_LT(compressed_len, DATA_LEN);
+  int64_t orig_len = 0;
+  EXPECT_EQ(OB_SUCCESS, LogCompressor::get_decompressed_size(compressed, compressed_len, orig_len));
+  EXPECT_EQ(DATA_LEN, orig_len);
+
+  // the data of compressed LogEntry is decompressed transparently
+  LogEntry log_entry;
+  EXPECT_EQ(OB_SUCCESS, log_entry.header_.generate_header(compressed, compressed_len, share::SCN::base_scn(), true));
+  log_entry.buf_ = compressed;
+  EXPECT_TRUE(log_entry.get_header().is_compressed());
+  EXPECT_TRUE(log_entry.check_integrity());
+  LogDecompressBuf decompress_buf;
+  const char *buf = NULL;
+  int64_t buf_len = 0;
+  EXPECT_EQ(OB_SUCCESS, decompress_buf.decompress(log_entry, buf, buf_len));
+  EXPECT_EQ(DATA_LEN, buf_len);
+  EXPECT_EQ(0, MEMCMP(buf, data, DATA_LEN));
+
+  // the data of uncompressed LogEntry is returned directly
+  LogEntry raw_log_entry;
+  EXPECT_EQ(OB_SUCCESS, raw_log_entry.header_.generate_header(data, DATA_LEN, share::SCN::base_scn()));
+  raw_log_entry.buf_ = data;
+  EXPECT_FALSE(raw_log_entry.get_header().is_compressed());
+  EXPECT_EQ(OB_SUCCESS, decompress_buf.decompress(raw_log_entry, buf, buf_len));
+  EXPECT_EQ(data, buf);
+  EXPECT_EQ(DATA_LEN, buf_len);
+
+  // random data can not be compressed smaller
+  for (int64_t i = 0; i < DATA_LEN; i++) {
+    data[i] = static_cast<char>(ObRandom::rand(0, 255));
+  }
+  EXPECT_EQ(OB_BUF_NOT_ENOUGH, LogCompressor::compress(LZ4_COMPRESSOR, data, DATA_LEN, compressed, BUFSIZE, compressed_len));
+}
+
 } // namespace unittest
 } // namespace oceanbase
 
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "logservice/palf/log_hot_cache.h"
+#include "logservice/palf/log_writer_utils.h"
+#undef private
+#include "lib/alloc/alloc_func.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace palf;
+
+namespace unittest
+{
+
+class TestLogHotCache : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ObMallocAllocator::get_instance()->create_and_add_tenant_allocator(TENANT_ID);
+    ObTenantBase tbase(TENANT_ID);
+    ObTenantEnv::set_tenant(&tbase);
+    // quota is enough for two caches
+    lib::set_tenant_memory_limit(TENANT_ID, 2 * CACHE_SIZE * 100 / PALF_HOT_CACHE_MEMORY_PERCENTAGE);
+    for (int64_t i = 0; i < DATA_LEN; i++) {
+      data_[i] = static_cast<char>(i % 127);
+    }
+  }
+  virtual void TearDown() {}
+  void fill(LogHotCache &cache, const int64_t start, const int64_t len)
+  {
+    LogWriteBuf write_buf;
+    ASSERT_EQ(OB_SUCCESS, write_buf.push_back(data_ + start, len));
+    cache.fill(LSN(start), write_buf);
+  }
+  void check_read(LogHotCache &cache, const int64_t start, const int64_t len)
+  {
+    char buf[DATA_LEN];
+    int64_t out_read_size = 0;
+    ASSERT_EQ(OB_SUCCESS, cache.read(LSN(start), len, buf, out_read_size));
+    ASSERT_EQ(len, out_read_size);
+    ASSERT_EQ(0, MEMCMP(buf, data_ + start, len));
+  }
+protected:
+  static const uint64_t TENANT_ID = 1001;
+  static const int64_t CACHE_SIZE = 4096;
+  static const int64_t DATA_LEN = 4 * CACHE_SIZE;
+  char data_[DATA_LEN];
+};
+
+TEST_F(TestLogHotCache, test_fill_and_read)
+{
+  LogHotCacheQuota quota;
+  LogHotCache cache;
+  char buf[CACHE_SIZE];
+  int64_t out_read_size = 0;
+  EXPECT_EQ(OB_SUCCESS, quota.init(TENANT_ID, CACHE_SIZE));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, cache.init(1, NULL));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(0), 10, buf, out_read_size));
+  EXPECT_EQ(OB_SUCCESS, cache.init(1, &quota));
+  EXPECT_EQ(OB_INIT_TWICE, cache.init(1, &quota));
+  // buffer is allocated lazily
+  EXPECT_TRUE(NULL == cache.buf_);
+  EXPECT_EQ(0, quota.used_size_);
+
+  fill(cache, 0, 1000);
+  fill(cache, 1000, 2000);
+  check_read(cache, 0, 3000);
+  check_read(cache, 500, 100);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(2900), 200, buf, out_read_size));
+
+  // wrap around, the oldest data is evicted
+  fill(cache, 3000, 2000);
+  EXPECT_EQ(LSN(5000 - CACHE_SIZE), cache.start_lsn_);
+  EXPECT_EQ(LSN(5000), cache.end_lsn_);
+  check_read(cache, 5000 - CACHE_SIZE, CACHE_SIZE);
+  check_read(cache, 3500, 1500);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(0), 100, buf, out_read_size));
+
+  // write larger than cache
+  fill(cache, 5000, CACHE_SIZE + 100);
+  check_read(cache, 5100, CACHE_SIZE);
+
+  // not continuous write resets cache
+  fill(cache, 12000, 100);
+  EXPECT_EQ(LSN(12000), cache.start_lsn_);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(5100), 100, buf, out_read_size));
+  check_read(cache, 12000, 100);
+
+  cache.trim(LSN(12050));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(12000), 100, buf, out_read_size));
+  check_read(cache, 12050, 50);
+  cache.reset();
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(12050), 50, buf, out_read_size));
+  cache.destroy();
+  EXPECT_EQ(0, quota.used_size_);
+}
+
+TEST_F(TestLogHotCache, test_quota)
+{
+  LogHotCacheQuota quota;
+  LogHotCache cache1;
+  LogHotCache cache2;
+  LogHotCache cache3;
+  char buf[CACHE_SIZE];
+  int64_t out_read_size = 0;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, quota.init(TENANT_ID, -1));
+  EXPECT_EQ(OB_SUCCESS, quota.init(TENANT_ID, CACHE_SIZE));
+  EXPECT_EQ(OB_SUCCESS, cache1.init(1, &quota));
+  EXPECT_EQ(OB_SUCCESS, cache2.init(2, &quota));
+  EXPECT_EQ(OB_SUCCESS, cache3.init(3, &quota));
+  fill(cache1, 0, 100);
+  fill(cache2, 0, 100);
+  EXPECT_EQ(2 * CACHE_SIZE, quota.used_size_);
+  check_read(cache1, 0, 100);
+  check_read(cache2, 0, 100);
+
+  // quota is exhausted, cache3 reads from disk only
+  fill(cache3, 0, 100);
+  EXPECT_TRUE(NULL == cache3.buf_);
+  EXPECT_NE(OB_INVALID_TIMESTAMP, cache3.last_alloc_fail_ts_);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache3.read(LSN(0), 100, buf, out_read_size));
+
+  // quota is released by destroy, cache3 retries after ALLOC_RETRY_INTERVAL_US
+  cache1.destroy();
+  EXPECT_EQ(CACHE_SIZE, quota.used_size_);
+  fill(cache3, 100, 100);
+  EXPECT_TRUE(NULL == cache3.buf_);
+  cache3.last_alloc_fail_ts_ -= LogHotCache::ALLOC_RETRY_INTERVAL_US;
+  fill(cache3, 100, 100);
+  check_read(cache3, 100, 100);
+  EXPECT_EQ(2 * CACHE_SIZE, quota.used_size_);
+
+  // shrink cache size, buffers are reallocated at next fill
+  quota.set_cache_size(CACHE_SIZE / 2);
+  fill(cache2, 100, 100);
+  EXPECT_EQ(CACHE_SIZE / 2, cache2.cache_size_);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache2.read(LSN(0), 100, buf, out_read_size));
+  check_read(cache2, 100, 100);
+  EXPECT_EQ(CACHE_SIZE + CACHE_SIZE / 2, quota.used_size_);
+
+  // disable hot cache
+  quota.set_cache_size(0);
+  fill(cache2, 200, 100);
+  fill(cache3, 200, 100);
+  EXPECT_TRUE(NULL == cache2.buf_);
+  EXPECT_TRUE(NULL == cache3.buf_);
+  EXPECT_EQ(0, quota.used_size_);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache2.read(LSN(200), 100, buf, out_read_size));
+  cache2.destroy();
+  cache3.destroy();
+  quota.destroy();
+}
+
+} // END of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf ./test_log_hot_cache.log*");
+  OB_LOGGER.set_file_name("test_log_hot_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_hot_cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "logservice/palf/log_io_worker.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+
+namespace unittest
+{
+
+TEST(TestLogIOBatchCtrl, test_adapt)
+{
+  LogIOBatchCtrl ctrl;
+  ctrl.init(64);
+  EXPECT_EQ(1, ctrl.get_target_batch_size());
+  EXPECT_EQ(0, ctrl.get_wait_window_us());
+
+  // backlog in queue, batch grows up to max batch size
+  for (int64_t i = 0; i < 10; i++) {
+    ctrl.on_batch_done(ctrl.get_target_batch_size(), 400, 10);
+  }
+  EXPECT_EQ(64, ctrl.get_target_batch_size());
+  EXPECT_EQ(0, ctrl.get_wait_window_us());
+  EXPECT_EQ(400, ctrl.get_avg_flush_cost_us());
+
+  // several writers without backlog, wait a fraction of flush cost
+  ctrl.on_batch_done(4, 400, 0);
+  EXPECT_EQ(64, ctrl.get_target_batch_size());
+  EXPECT_EQ(100, ctrl.get_wait_window_us());
+  // wait window is bounded
+  for (int64_t i = 0; i < 100; i++) {
+    ctrl.on_batch_done(4, 100 * 1000, 0);
+  }
+  EXPECT_EQ(LogIOBatchCtrl::MAX_WAIT_WINDOW_US, ctrl.get_wait_window_us());
+
+  // idle, flush immediately
+  for (int64_t i = 0; i < 100; i++) {
+    ctrl.on_batch_done(1, 400, 0);
+  }
+  EXPECT_EQ(1, ctrl.get_target_batch_size());
+  EXPECT_EQ(0, ctrl.get_wait_window_us());
+}
+
+TEST(TestLogIOBatchCtrl, test_statistics)
+{
+  LogIOBatchCtrl ctrl;
+  ctrl.init(1 << 20);
+  EXPECT_EQ(LogIOBatchCtrl::MAX_TARGET_BATCH_SIZE, ctrl.max_batch_size_);
+  ctrl.on_batch_done(1, 10, 0);
+  ctrl.on_batch_done(3, 20, 0);
+  ctrl.on_batch_done(4, 30, 0);
+  ctrl.on_batch_done(1000, 40, 0);
+  EXPECT_EQ(4, ctrl.batch_count_);
+  EXPECT_EQ(1, ctrl.batch_size_hist_[0]);
+  EXPECT_EQ(1, ctrl.batch_size_hist_[1]);
+  EXPECT_EQ(1, ctrl.batch_size_hist_[2]);
+  EXPECT_EQ(1, ctrl.batch_size_hist_[LogIOBatchCtrl::BATCH_SIZE_BUCKET_NUM - 1]);
+  EXPECT_EQ(100, ctrl.total_flush_cost_us_);
+  EXPECT_EQ(40, ctrl.max_flush_cost_us_);
+  PALF_LOG(INFO, "statistics", K(ctrl));
+  ctrl.reset_statistics();
+  EXPECT_EQ(0, ctrl.batch_count_);
+  EXPECT_EQ(0, ctrl.batch_size_hist_[0]);
+}
+
+} // END of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf ./test_log_io_batch_ctrl.log*");
+  OB_LOGGER.set_file_name("test_log_io_batch_ctrl.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_io_batch_ctrl");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/utility/ob_test_util.h"
+#include "lib/timezone/ob_time_convert.h"
+#include "rpc/obmysql/ob_mysql_util.h"
+#include "observer/mysql/obsm_batch_row.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+
+// The formatting kernels must produce exactly the same cells as ObMySQLUtil.
+class TestSMBatchRow: public ::testing::Test
+{
+public:
+  TestSMBatchRow() {}
+  virtual ~TestSMBatchRow() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  void check_int(const int64_t val, const bool is_unsigned)
+  {
+    int64_t pos1 = 0;
+    int64_t pos2 = 0;
+    ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::int_cell_str(buf1_, BUF_LEN, val,
+        is_unsigned ? ObUInt64Type : ObIntType, is_unsigned, TEXT, pos1, false, 0));
+    ASSERT_EQ(OB_SUCCESS, ObSMBatchRowEncoder::int_cell_str(buf2_, BUF_LEN, val,
+                                                            is_unsigned, pos2));
+    ASSERT_EQ(pos1, pos2) << val;
+    ASSERT_EQ(0, MEMCMP(buf1_, buf2_, pos1)) << val;
+  }
+  void check_date(const int32_t val)
+  {
+    int64_t pos1 = 0;
+    int64_t pos2 = 0;
+    ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::date_cell_str(buf1_, BUF_LEN, val, TEXT, pos1));
+    ASSERT_EQ(OB_SUCCESS, ObSMBatchRowEncoder::date_cell_str(buf2_, BUF_LEN, val, pos2));
+    ASSERT_EQ(pos1, pos2) << val;
+    ASSERT_EQ(0, MEMCMP(buf1_, buf2_, pos1)) << val;
+  }
+  void check_datetime(const int64_t val, const int16_t scale)
+  {
+    int64_t pos1 = 0;
+    int64_t pos2 = 0;
+    ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::datetime_cell_str(buf1_, BUF_LEN, val, TEXT, pos1,
+                                                         NULL, scale));
+    ASSERT_EQ(OB_SUCCESS, ObSMBatchRowEncoder::datetime_cell_str(buf2_, BUF_LEN, val,
+                                                                 scale, pos2));
+    ASSERT_EQ(pos1, pos2) << val << " " << scale;
+    ASSERT_EQ(0, MEMCMP(buf1_, buf2_, pos1)) << val << " " << scale;
+  }
+
+protected:
+  static const int64_t BUF_LEN = 128;
+  char buf1_[BUF_LEN];
+  char buf2_[BUF_LEN];
+};
+
+TEST_F(TestSMBatchRow, int_cell)
+{
+  const int64_t values[] = {0, 1, -1, 9, 10, -10, 99, 100, 12345, -99999,
+                            INT32_MAX, INT32_MIN, INT64_MAX, INT64_MIN};
+  for (int64_t i = 0; i < ARRAYSIZEOF(values); i++) {
+    check_int(values[i], false);
+    check_int(values[i], true);
+  }
+  for (int64_t i = 0; i < 100000; i++) {
+    const int64_t val = static_cast<int64_t>(
+        (static_cast<uint64_t>(rand()) << 33) ^ (static_cast<uint64_t>(rand()) << 11) ^ rand())
+        >> (rand() % 64);
+    check_int(val, false);
+    check_int(val, true);
+  }
+}
+
+TEST_F(TestSMBatchRow, date_cell)
+{
+  check_date(ObTimeConverter::ZERO_DATE);
+  check_date(0);
+  check_date(-1);
+  // 0000-01-01
+  const int32_t min_date = static_cast<int32_t>(DATETIME_MIN_VAL / USECS_PER_DAY);
+  check_date(min_date);
+  check_date(DATE_MAX_VAL);
+  for (int32_t val = min_date; val <= DATE_MAX_VAL; val += 7) {
+    check_date(val);
+  }
+}
+
+TEST_F(TestSMBatchRow, datetime_cell)
+{
+  const int64_t values[] = {0, -1, 1, 999999, -999999, 86400000000LL - 1,
+                            DATETIME_MIN_VAL, DATETIME_MAX_VAL,
+                            ObTimeConverter::ZERO_DATETIME};
+  for (int16_t scale = -1; scale <= 6; scale++) {
+    for (int64_t i = 0; i < ARRAYSIZEOF(values); i++) {
+      check_datetime(values[i], scale);
+    }
+  }
+  const int64_t range = DATETIME_MAX_VAL / 1000000 - DATETIME_MIN_VAL / 1000000;
+  for (int64_t i = 0; i < 100000; i++) {
+    const int64_t sec = DATETIME_MIN_VAL / 1000000
+        + ((static_cast<int64_t>(rand()) << 31) ^ rand()) % range;
+    const int64_t val = sec * 1000000 + rand() % 1000000;
+    check_datetime(val, static_cast<int16_t>(rand() % 7));
+  }
+}
+
+TEST_F(TestSMBatchRow, size_overflow)
+{
+  for (int64_t len = 0; len < ObSMBatchRowEncoder::MAX_DATETIME_CELL_LEN; len++) {
+    int64_t pos = 0;
+    if (len < 1 + 4) {
+      ASSERT_EQ(OB_SIZE_OVERFLOW, ObSMBatchRowEncoder::int_cell_str(buf2_, len, -1234, false, pos));
+      ASSERT_EQ(0, pos);
+    }
+    if (len < ObSMBatchRowEncoder::DATE_CELL_LEN) {
+      ASSERT_EQ(OB_SIZE_OVERFLOW, ObSMBatchRowEncoder::date_cell_str(buf2_, len, 10000, pos));
+      ASSERT_EQ(0, pos);
+    }
+    ASSERT_EQ(OB_SIZE_OVERFLOW,
+              ObSMBatchRowEncoder::datetime_cell_str(buf2_, len, 123456789, 6, pos));
+    ASSERT_EQ(0, pos);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "share/rpc/ob_batch_rpc.h"
+#include "share/config/ob_server_config.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace obrpc;
+namespace unittest
+{
+
+class FakeReq : public ObIFill
+{
+public:
+  virtual int fill_buffer(char* buf, int64_t size, int64_t &filled_size) const
+  {
+    MEMSET(buf, 'x', size);
+    filled_size = size;
+    return OB_SUCCESS;
+  }
+  virtual int64_t get_req_size() const { return 16; }
+};
+
+class TestBatchRpc : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    self_.set_ip_addr("127.0.0.1", 8080);
+    server1_.set_ip_addr("127.0.0.2", 8080);
+    server2_.set_ip_addr("127.0.0.3", 8080);
+  }
+  virtual void TearDown()
+  {
+    GCONF._trx_2pc_msg_batch_window.set_value("0us");
+  }
+  int post(ObBatchRpcBase &base, const int batch_type, const ObAddr &server)
+  {
+    return base.post(OB_SYS_TENANT_ID, server, 1, batch_type, 0, req_);
+  }
+
+protected:
+  // the proxy is not inited, messages flushed by the destructor are dropped
+  ObBatchRpcProxy rpc_;
+  FakeReq req_;
+  ObAddr self_;
+  ObAddr server1_;
+  ObAddr server2_;
+};
+
+TEST_F(TestBatchRpc, wait_cond)
+{
+  SingleWaitCond cond;
+  ASSERT_FALSE(cond.wait(1000));
+  // signaled before wait, the flag is consumed
+  cond.signal();
+  ASSERT_TRUE(cond.wait(1000));
+  ASSERT_FALSE(cond.wait(1000));
+
+  // woken up by the signal of another thread
+  const int64_t start_ts = ObTimeUtility::current_time();
+  std::thread th([&cond]() {
+    ob_usleep(10 * 1000);
+    cond.signal();
+  });
+  ASSERT_TRUE(cond.wait(10 * 1000 * 1000));
+  ASSERT_LT(ObTimeUtility::current_time() - start_ts, 5 * 1000 * 1000);
+  th.join();
+  ASSERT_FALSE(cond.wait(1000));
+}
+
+TEST_F(TestBatchRpc, coalesce_off_by_default)
+{
+  ObBatchRpcBase base;
+  ASSERT_EQ(0, get_batch_coalesce_us(TRX_BATCH_REQ_NODELAY));
+  ASSERT_EQ(OB_SUCCESS, base.init(0, TRX_BATCH_REQ_NODELAY, &rpc_, self_));
+  ASSERT_EQ(OB_SUCCESS, post(base, TRX_BATCH_REQ_NODELAY, server1_));
+  ASSERT_EQ(OB_SUCCESS, post(base, TRX_BATCH_REQ_NODELAY, server2_));
+  ASSERT_FALSE(base.need_coalesce());
+}
+
+TEST_F(TestBatchRpc, coalesce_fan_out)
+{
+  GCONF._trx_2pc_msg_batch_window.set_value("100us");
+  ASSERT_EQ(100, get_batch_coalesce_us(TRX_BATCH_REQ_NODELAY));
+  ObBatchRpcBase base;
+  ASSERT_EQ(OB_SUCCESS, base.init(0, TRX_BATCH_REQ_NODELAY, &rpc_, self_));
+  ASSERT_FALSE(base.need_coalesce());
+  // messages to a single server are not delayed
+  ASSERT_EQ(OB_SUCCESS, post(base, TRX_BATCH_REQ_NODELAY, server1_));
+  ASSERT_EQ(OB_SUCCESS, post(base, TRX_BATCH_REQ_NODELAY, server1_));
+  ASSERT_FALSE(base.need_coalesce());
+  ASSERT_EQ(OB_SUCCESS, post(base, TRX_BATCH_REQ_NODELAY, server2_));
+  ASSERT_TRUE(base.need_coalesce());
+
+  // other batch types are never delayed
+  ObBatchRpcBase clog_base;
+  ASSERT_EQ(0, get_batch_coalesce_us(CLOG_BATCH_REQ_NODELAY));
+  ASSERT_EQ(OB_SUCCESS, clog_base.init(0, CLOG_BATCH_REQ_NODELAY, &rpc_, self_));
+  ASSERT_EQ(OB_SUCCESS, post(clog_base, CLOG_BATCH_REQ_NODELAY, server1_));
+  ASSERT_EQ(OB_SUCCESS, post(clog_base, CLOG_BATCH_REQ_NODELAY, server2_));
+  ASSERT_FALSE(clog_base.need_coalesce());
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_batch_rpc.log*");
+  OB_LOGGER.set_file_name("test_batch_rpc.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
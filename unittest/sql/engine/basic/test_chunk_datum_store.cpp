@@ -768,6 +768,42 @@ TEST_F(TestChunkDatumStore, disk)
   rs.reset();
 }
 
+TEST_F(TestChunkDatumStore, disk_compressed)
+{
+  const char *funcs[] = { "none", "lz4_1.0", "zstd_1.3.8" };
+  int64_t raw_file_size = 0;
+  for (int64_t f = 0; f < ARRAYSIZEOF(funcs); f++) {
+    GCONF._sql_spill_compress_func.set_value(funcs[f]);
+    int64_t rows = 50 * 10000;
+    ObChunkDatumStore rs;
+    ObChunkDatumStore::Iterator it;
+    ASSERT_EQ(OB_SUCCESS, rs.init(0, tenant_id_, ctx_id_, label_));
+    ASSERT_EQ(OB_SUCCESS, rs.alloc_dir_id());
+    rs.set_mem_limit(1L << 20);
+    for (int64_t i = 0; i < 50; i++) {
+      CALL(append_rows, rs, 10000);
+    }
+    ASSERT_EQ(OB_SUCCESS, rs.finish_add_row());
+    ASSERT_TRUE(rs.is_file_open());
+    LOG_INFO("compressed disk", K(funcs[f]), K(rows), K(rs.get_file_size()),
+             K(rs.get_disk_file_size()));
+    if (0 == f) {
+      raw_file_size = rs.get_file_size();
+      ASSERT_EQ(raw_file_size, rs.get_disk_file_size());
+    } else {
+      // sizing of dumped data always sees the uncompressed size
+      ASSERT_EQ(raw_file_size, rs.get_file_size());
+      ASSERT_LT(rs.get_disk_file_size(), rs.get_file_size());
+    }
+
+    it.reset();
+    CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true);
+    it.reset();
+    rs.reset();
+  }
+  GCONF._sql_spill_compress_func.set_value("none");
+}
+
 TEST_F(TestChunkDatumStore, disk_with_chunk)
 {
   int64_t begin = 0;
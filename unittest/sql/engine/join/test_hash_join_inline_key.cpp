@@ -0,0 +1,272 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/join/ob_hash_join_op.h"
+#undef private
+#include "lib/allocator/page_arena.h"
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+typedef ObHashJoinOp::PartHashJoinTable HashTable;
+typedef ObHashJoinOp::HTInlineKey HTInlineKey;
+
+class TestHashJoinInlineKey : public ::testing::Test
+{
+public:
+  static const int64_t KEY_CNT = 2;
+  TestHashJoinInlineKey() : alloc_("HJInlineKey") {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, init_table(ht_, 1024, KEY_CNT));
+  }
+  virtual void TearDown()
+  {
+    ht_.free(&alloc_);
+    alloc_.reset();
+  }
+
+  int init_table(HashTable &ht, const int64_t nbuckets, const int64_t key_cnt)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(ht.init(alloc_))) {
+    } else {
+      ht.nbuckets_ = nbuckets;
+      ht.inline_key_cnt_ = key_cnt;
+      ret = ht.init_buckets();
+    }
+    return ret;
+  }
+
+  // stored row of two int keys, the datum payload follows the extra info
+  ObHashJoinStoredJoinRow *make_row(const uint64_t hash_val, const int64_t k0, const int64_t k1,
+                                    const bool k1_null = false)
+  {
+    const int64_t head_size = sizeof(ObChunkDatumStore::StoredRow) + sizeof(ObDatum) * KEY_CNT
+                              + sizeof(ObHashJoinStoredJoinRow::ExtraInfo);
+    char *buf = static_cast<char *>(alloc_.alloc(head_size + sizeof(int64_t) * KEY_CNT));
+    ObHashJoinStoredJoinRow *sr = reinterpret_cast<ObHashJoinStoredJoinRow *>(buf);
+    sr->cnt_ = KEY_CNT;
+    sr->row_size_ = static_cast<uint32_t>(head_size + sizeof(int64_t) * KEY_CNT);
+    int64_t *payload = reinterpret_cast<int64_t *>(buf + head_size);
+    for (int64_t i = 0; i < KEY_CNT; i++) {
+      sr->cells()[i].ptr_ = reinterpret_cast<char *>(&payload[i]);
+    }
+    sr->cells()[0].set_int(k0);
+    if (k1_null) {
+      sr->cells()[1].set_null();
+    } else {
+      sr->cells()[1].set_int(k1);
+    }
+    sr->set_hash_value(hash_val);
+    return sr;
+  }
+
+  void set_row(HashTable &ht, ObHashJoinStoredJoinRow *sr)
+  {
+    int64_t keys[KEY_CNT];
+    bool keys_valid = true;
+    for (int64_t i = 0; keys_valid && i < ht.inline_key_cnt_; ++i) {
+      keys_valid = ObHashJoinOp::get_inline_key(sr->cells()[i], keys[i]);
+    }
+    ht.set(sr->get_hash_value(), sr, keys, keys_valid);
+  }
+
+  int64_t chain_len(ObHashJoinStoredJoinRow *sr)
+  {
+    int64_t cnt = 0;
+    for (; NULL != sr; sr = sr->get_next()) {
+      ++cnt;
+    }
+    return cnt;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  HashTable ht_;
+};
+
+TEST_F(TestHashJoinInlineKey, get_inline_key)
+{
+  int64_t buf[2];
+  int64_t key = 0;
+  ObDatum datum;
+  datum.ptr_ = reinterpret_cast<char *>(buf);
+  datum.set_int(-7);
+  ASSERT_TRUE(ObHashJoinOp::get_inline_key(datum, key));
+  ASSERT_EQ(-7, key);
+  // date is int32
+  datum.set_date(-719528);
+  ASSERT_TRUE(ObHashJoinOp::get_inline_key(datum, key));
+  ASSERT_EQ(-719528, key);
+  datum.set_null();
+  ASSERT_FALSE(ObHashJoinOp::get_inline_key(datum, key));
+  datum.set_string("abc", 3);
+  ASSERT_FALSE(ObHashJoinOp::get_inline_key(datum, key));
+}
+
+TEST_F(TestHashJoinInlineKey, uniform_bucket)
+{
+  const HTInlineKey *inline_key = NULL;
+  int64_t probe_keys[KEY_CNT] = {1, 2};
+  set_row(ht_, make_row(100, 1, 2));
+  set_row(ht_, make_row(100, 1, 2));
+  set_row(ht_, make_row(100, 1, 2));
+  ObHashJoinStoredJoinRow *sr = ht_.get(100, inline_key);
+  ASSERT_EQ(3, chain_len(sr));
+  ASSERT_TRUE(NULL != inline_key);
+  ASSERT_TRUE(inline_key->uniform_);
+  ASSERT_TRUE(inline_key->equal(probe_keys, KEY_CNT));
+  // the second key differs
+  probe_keys[1] = 3;
+  ASSERT_FALSE(inline_key->equal(probe_keys, KEY_CNT));
+  // not found
+  ASSERT_TRUE(NULL == ht_.get(101, inline_key));
+  ASSERT_TRUE(NULL == inline_key);
+  ASSERT_EQ(1, ht_.used_buckets_);
+}
+
+TEST_F(TestHashJoinInlineKey, hash_collision)
+{
+  // rows of different keys with the same hash value share one bucket
+  const HTInlineKey *inline_key = NULL;
+  set_row(ht_, make_row(200, 1, 2));
+  set_row(ht_, make_row(200, 1, 3));
+  ASSERT_EQ(2, chain_len(ht_.get(200, inline_key)));
+  ASSERT_TRUE(NULL != inline_key);
+  ASSERT_FALSE(inline_key->uniform_);
+  // stay mixed when the keys of later rows match the first row again
+  set_row(ht_, make_row(200, 1, 2));
+  ASSERT_EQ(3, chain_len(ht_.get(200, inline_key)));
+  ASSERT_FALSE(inline_key->uniform_);
+
+  // different hash values of the same slot are linear probed, each bucket has its own keys
+  const uint64_t h1 = 300;
+  const uint64_t h2 = 300 + ht_.nbuckets_;
+  int64_t probe_keys[KEY_CNT] = {5, 6};
+  set_row(ht_, make_row(h1, 4, 4));
+  set_row(ht_, make_row(h2, 5, 6));
+  ASSERT_EQ(1, chain_len(ht_.get(h2, inline_key)));
+  ASSERT_TRUE(inline_key->uniform_);
+  ASSERT_TRUE(inline_key->equal(probe_keys, KEY_CNT));
+  ASSERT_EQ(1, chain_len(ht_.get(h1, inline_key)));
+  ASSERT_TRUE(inline_key->uniform_);
+  ASSERT_FALSE(inline_key->equal(probe_keys, KEY_CNT));
+  ASSERT_GT(ht_.collisions_, 0);
+
+  // probe wraps around the end of the bucket array
+  const uint64_t last = ht_.nbuckets_ - 1;
+  set_row(ht_, make_row(last, 7, 7));
+  set_row(ht_, make_row(last + ht_.nbuckets_, 8, 8));
+  probe_keys[0] = 8;
+  probe_keys[1] = 8;
+  ASSERT_EQ(1, chain_len(ht_.get(last + ht_.nbuckets_, inline_key)));
+  ASSERT_TRUE(inline_key->equal(probe_keys, KEY_CNT));
+}
+
+TEST_F(TestHashJoinInlineKey, null_key)
+{
+  // bucket with null key never decides the match by inline keys
+  const HTInlineKey *inline_key = NULL;
+  set_row(ht_, make_row(400, 1, 0, true));
+  ASSERT_EQ(1, chain_len(ht_.get(400, inline_key)));
+  ASSERT_FALSE(inline_key->uniform_);
+
+  set_row(ht_, make_row(500, 1, 2));
+  set_row(ht_, make_row(500, 1, 0, true));
+  ASSERT_EQ(2, chain_len(ht_.get(500, inline_key)));
+  ASSERT_FALSE(inline_key->uniform_);
+}
+
+TEST_F(TestHashJoinInlineKey, reuse_buckets)
+{
+  const HTInlineKey *inline_key = NULL;
+  set_row(ht_, make_row(600, 1, 0, true));
+  ht_.buckets_->reuse();
+  ASSERT_EQ(OB_SUCCESS, ht_.init_buckets());
+  set_row(ht_, make_row(600, 1, 1));
+  ASSERT_EQ(1, chain_len(ht_.get(600, inline_key)));
+  ASSERT_TRUE(inline_key->uniform_);
+}
+
+// Probe of a hash table larger than cache, keys decided by inline keys of the bucket
+// compared with keys read from the stored rows.
+TEST_F(TestHashJoinInlineKey, probe_perf)
+{
+  const int64_t ROW_CNT = 1 << 20;
+  const int64_t BATCH = 256;
+  HashTable ht;
+  ASSERT_EQ(OB_SUCCESS, init_table(ht, ROW_CNT * 2, KEY_CNT));
+  ObHashJoinStoredJoinRow **rows = static_cast<ObHashJoinStoredJoinRow **>(
+      alloc_.alloc(sizeof(ObHashJoinStoredJoinRow *) * ROW_CNT));
+  ASSERT_TRUE(NULL != rows);
+  for (int64_t i = 0; i < ROW_CNT; i++) {
+    rows[i] = make_row(murmurhash(&i, sizeof(i), 0), i, i + 1);
+    set_row(ht, rows[i]);
+  }
+  uint64_t hash_vals[BATCH];
+  ObHashJoinStoredJoinRow *tuples[BATCH];
+  const HTInlineKey *inline_keys[BATCH];
+  int64_t matched[2] = {0, 0};
+  int64_t cost[2] = {0, 0};
+  for (int64_t round = 0; round < 2; round++) {
+    const bool use_inline_key = (0 == round);
+    const int64_t start = ObTimeUtility::current_time();
+    for (int64_t base = 0; base < ROW_CNT; base += BATCH) {
+      for (int64_t i = 0; i < BATCH; i++) {
+        const int64_t k = (base + i) * 7 % ROW_CNT;
+        hash_vals[i] = murmurhash(&k, sizeof(k), 0) & ObHashJoinStoredJoinRow::HASH_VAL_MASK;
+        __builtin_prefetch(&ht.buckets_->at(hash_vals[i] & (ht.nbuckets_ - 1)), 0, 1);
+        if (use_inline_key) {
+          __builtin_prefetch(&ht.inline_keys_->at(hash_vals[i] & (ht.nbuckets_ - 1)), 0, 1);
+        }
+      }
+      for (int64_t i = 0; i < BATCH; i++) {
+        tuples[i] = use_inline_key ? ht.get(hash_vals[i], inline_keys[i]) : ht.get(hash_vals[i]);
+      }
+      for (int64_t i = 0; i < BATCH; i++) {
+        const int64_t k = (base + i) * 7 % ROW_CNT;
+        const int64_t probe_keys[KEY_CNT] = {k, k + 1};
+        if (NULL == tuples[i]) {
+        } else if (use_inline_key && inline_keys[i]->uniform_) {
+          matched[round] += inline_keys[i]->equal(probe_keys, KEY_CNT);
+        } else {
+          const ObDatum *cells = tuples[i]->cells();
+          matched[round] += (cells[0].get_int() == probe_keys[0] && cells[1].get_int() == probe_keys[1]);
+        }
+      }
+    }
+    cost[round] = ObTimeUtility::current_time() - start;
+  }
+  ASSERT_EQ(ROW_CNT, matched[0]);
+  ASSERT_EQ(ROW_CNT, matched[1]);
+  std::cout << "probe " << ROW_CNT << " rows, inline key: " << cost[0]
+            << "us, stored row key: " << cost[1] << "us" << std::endl;
+  ht.free(&alloc_);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
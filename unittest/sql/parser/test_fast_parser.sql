@@ -261,4 +261,14 @@ select interval '123123 23:23:23.123123' day (9) to second (9) R from dual;
 select interval '123123 23:23:23.123123' day(9)to second(9) R from dual;
 select interval '12 23:23:23.123123' day to second(6) R from dual;
 select interval '12 23:23:23.123123' day to second R from dual;
-select '\103hh\100hh' 'ueuoiuo';
\ No newline at end of file
+select '\103hh\100hh' 'ueuoiuo';
+select 'a long string literal which is longer than one block \' with escapes \\ and '' quotes' from dual;
+select "a long double quoted string which is longer than one block \" with escapes" from dual;
+select `a_long_backtick_quoted_identifier_longer_than_one_block` from t1;
+select 1 /* a long comment which is longer than one block * / ** with stars */, 2 from dual;
+select 1, 2 from dual # a long line comment which is longer than one block
+select 1, 2 from dual -- a long line comment which is longer than one block
+select 12345678901234567890123456789012345.12345678901234567890123456789e1234567890123456789 from dual;
+select                                                       1,                                  2 from dual;
+insert into t1 values (1234567890123456, 'abcdefghijklmnopqrstuvwxyz0123456789'), (6543210987654321, 'zyxwvutsrqponmlkjihgfedcba9876543210');
+select * from t1 where c1 in (1000000000000001, 1000000000000002, 1000000000000003, 1000000000000004, 1000000000000005);
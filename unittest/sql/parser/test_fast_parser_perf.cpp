@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "sql/parser/ob_fast_parser.h"
+#include "sql/parser/ob_fast_parser_simd.h"
+#include "lib/worker.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/time/ob_time_utility.h"
+#include <fstream>
+#include <vector>
+#include <string>
+#include <iostream>
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+// Micro benchmark of ObFastParser over a corpus of statements, one statement per
+// line. Statements captured from the sql audit can be used as the corpus with -q,
+// otherwise test_fast_parser.sql and some generated statements with long literals
+// are used.
+//
+//   ./test_fast_parser_perf [-q corpus_file] [-n loop_count] [-o]
+namespace test
+{
+static const char *corpus_file = NULL;
+static int LOOP_COUNT = 1000;
+static bool IS_ORACLE = false;
+
+int load_sql(const char *file, std::vector<std::string> &sql_array)
+{
+  int ret = OB_SUCCESS;
+  std::ifstream in(file);
+  if (!in.is_open()) {
+    ret = OB_ERROR;
+    SQL_PC_LOG(ERROR, "failed to open file", K(file));
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.size() <= 0) continue;
+    std::size_t begin = line.find_first_not_of('\t');
+    if (begin == std::string::npos || line.at(begin) == '#') continue;
+    std::size_t end = line.find_last_not_of('\t');
+    sql_array.push_back(line.substr(begin, end - begin + 1));
+  }
+  in.close();
+  return ret;
+}
+
+// multi values insert and long in list, whose literals take most of the sql text
+void gen_sql(std::vector<std::string> &sql_array)
+{
+  char buf[128];
+  std::string insert_sql = "insert into t1 (c1, c2, c3, c4) values ";
+  for (int i = 0; i < 200; i++) {
+    snprintf(buf, sizeof(buf), "%s(%d, 'name_of_the_row_%08d', %d.%06d, '2023-01-01 12:00:00')",
+             0 == i ? "" : ", ", i, i, i * 7, i * 13);
+    insert_sql += buf;
+  }
+  sql_array.push_back(insert_sql);
+  std::string in_sql = "select /* long in list */ c1, c2 from t1 where c1 in (";
+  for (int i = 0; i < 500; i++) {
+    snprintf(buf, sizeof(buf), "%s%d", 0 == i ? "" : ", ", 1000000000 + i);
+    in_sql += buf;
+  }
+  in_sql += ") -- generated";
+  sql_array.push_back(in_sql);
+  std::string str_sql = "update t1 set c2 = '";
+  for (int i = 0; i < 100; i++) {
+    str_sql += "a long text value without any quote or escape, ";
+  }
+  str_sql += "' where c1 = 1";
+  sql_array.push_back(str_sql);
+}
+
+void run_fast_parser(const std::vector<std::string> &sql_array, const int64_t total_len)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  FPContext fp_ctx(CS_TYPE_UTF8MB4_GENERAL_CI);
+  fp_ctx.sql_mode_ = IS_ORACLE ? (DEFAULT_ORACLE_MODE | SMO_ORACLE) : DEFAULT_MYSQL_MODE;
+  int64_t succ_cnt = 0;
+  int64_t total_cnt = 0;
+  int64_t start_ts = ObTimeUtility::current_time();
+  for (int i = 0; i < LOOP_COUNT; i++) {
+    for (int64_t j = 0; j < (int64_t)sql_array.size(); j++) {
+      ObString sql(sql_array.at(j).length(), sql_array.at(j).c_str());
+      char *no_param_sql = NULL;
+      int64_t no_param_sql_len = 0;
+      ParamList *param_list = NULL;
+      int64_t param_num = 0;
+      if (OB_SUCCESS == ObFastParser::parse(sql, fp_ctx, allocator, no_param_sql,
+                                            no_param_sql_len, param_list, param_num)) {
+        succ_cnt++;
+      }
+      total_cnt++;
+      allocator.reuse();
+    }
+  }
+  int64_t cost = ObTimeUtility::current_time() - start_ts;
+  std::cout << "==== fast parser" << std::endl;
+  std::cout << "succ_cnt: " << succ_cnt << ", total_cnt: " << total_cnt << std::endl;
+  std::cout << "avg_time(ns): " << (double)cost * 1000 / (double)total_cnt << std::endl;
+  std::cout << "throughput(MB/s): "
+            << (double)total_len * LOOP_COUNT / (double)cost << std::endl;
+}
+
+// the quote scanning used by process_string, with and without the block scanner
+void run_scanner(const std::vector<std::string> &sql_array, const int64_t total_len)
+{
+  int64_t hit_cnt[2] = {0, 0};
+  int64_t cost[2] = {0, 0};
+  for (int k = 0; k < 2; k++) {
+    int64_t start_ts = ObTimeUtility::current_time();
+    for (int i = 0; i < LOOP_COUNT; i++) {
+      for (int64_t j = 0; j < (int64_t)sql_array.size(); j++) {
+        const char *str = sql_array.at(j).c_str();
+        const int64_t len = sql_array.at(j).length();
+        for (int64_t pos = 0; pos < len; pos++) {
+          if (0 == k) {
+            while (pos < len && '\\' != str[pos] && '\'' != str[pos]) {
+              pos++;
+            }
+          } else {
+            pos = ObFastParserSimd::find_char2(str, pos, len, '\\', '\'');
+          }
+          hit_cnt[k] += pos < len ? 1 : 0;
+        }
+      }
+    }
+    cost[k] = ObTimeUtility::current_time() - start_ts;
+  }
+  std::cout << "==== quote scanner" << std::endl;
+  std::cout << "hit_cnt: " << hit_cnt[0] << "/" << hit_cnt[1] << std::endl;
+  std::cout << "scalar throughput(MB/s): "
+            << (double)total_len * LOOP_COUNT / (double)cost[0] << std::endl;
+  std::cout << "block throughput(MB/s): "
+            << (double)total_len * LOOP_COUNT / (double)cost[1] << std::endl;
+}
+
+void run()
+{
+  std::vector<std::string> sql_array;
+  if (NULL != corpus_file) {
+    load_sql(corpus_file, sql_array);
+  } else {
+    load_sql("test_fast_parser.sql", sql_array);
+    gen_sql(sql_array);
+  }
+  int64_t total_len = 0;
+  for (int64_t i = 0; i < (int64_t)sql_array.size(); i++) {
+    total_len += sql_array.at(i).length();
+  }
+  std::cout << "sql_cnt: " << sql_array.size() << ", total_len: " << total_len << std::endl;
+  if (total_len > 0) {
+    run_fast_parser(sql_array, total_len);
+    run_scanner(sql_array, total_len);
+  }
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("ERROR");
+  OB_LOGGER.set_file_name("test_fast_parser_perf.log", true);
+  int c = 0;
+  while(-1 != (c = getopt(argc, argv, "q:n:o"))) {
+    switch(c) {
+      case 'q':
+        test::corpus_file = optarg;
+        break;
+      case 'n':
+        test::LOOP_COUNT = atoi(optarg);
+        break;
+      case 'o':
+        test::IS_ORACLE = true;
+        break;
+      default:
+        printf("usage: %s [-q corpus_file] [-n loop_count] [-o]\n", argv[0]);
+        break;
+    }
+  }
+  set_compat_mode(test::IS_ORACLE ? lib::Worker::CompatMode::ORACLE
+                                  : lib::Worker::CompatMode::MYSQL);
+  ::test::run();
+  return 0;
+}
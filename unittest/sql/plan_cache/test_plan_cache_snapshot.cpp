@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/plan_cache/ob_plan_cache_snapshot.h"
+#undef private
+#include "lib/file/file_directory_utils.h"
+#include "share/config/ob_server_config.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace test
+{
+static const char *DATA_DIR = "test_plan_cache_snapshot_data";
+static const uint64_t TENANT_ID = 1001;
+
+class TestPlanCacheSnapshot : public ::testing::Test
+{
+public:
+  TestPlanCacheSnapshot() : allocator_("PCSnapshotTest") {}
+  virtual ~TestPlanCacheSnapshot() {}
+  virtual void SetUp()
+  {
+    system("rm -rf test_plan_cache_snapshot_data");
+    GCONF.data_dir.set_value(DATA_DIR);
+  }
+  virtual void TearDown()
+  {
+    system("rm -rf test_plan_cache_snapshot_data");
+  }
+
+  void make_items(const int64_t cnt, ObIArray<ObPlanCacheSnapshotItem> &items)
+  {
+    for (int64_t i = 0; i < cnt; i++) {
+      ObPlanCacheSnapshotItem item;
+      char sql[64];
+      snprintf(sql, sizeof(sql), "select * from t%ld where c1 = ?", i);
+      item.db_id_ = 500001;
+      item.sql_cs_type_ = CS_TYPE_UTF8MB4_GENERAL_CI;
+      ASSERT_EQ(OB_SUCCESS, ob_write_string(allocator_, ObString::make_string(sql), item.constructed_sql_));
+      item.param_infos_ = ObString::make_string("{1,0,0,-1,5}");
+      item.sys_vars_str_ = ObString::make_string("sys_vars");
+      item.config_str_ = ObString::make_string("configs");
+      item.outline_data_ = ObString::make_string("/*+ FULL(t1) */");
+      item.hit_count_ = 1000 - i;
+      item.execute_times_ = 2000 - i;
+      item.elapsed_time_ = i * 10;
+      item.last_active_time_ = i * 100;
+      ASSERT_EQ(OB_SUCCESS, items.push_back(item));
+    }
+  }
+
+  void get_path(char *path)
+  {
+    ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::get_file_path(TENANT_ID, path, MAX_PATH_SIZE));
+  }
+
+  int64_t get_file_size()
+  {
+    char path[MAX_PATH_SIZE] = {0};
+    int64_t file_size = 0;
+    get_path(path);
+    EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::get_file_size(path, file_size));
+    return file_size;
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestPlanCacheSnapshot, write_and_load)
+{
+  ObArray<ObPlanCacheSnapshotItem> items;
+  ObArray<ObPlanCacheSnapshotItem> load_items;
+  // no snapshot
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+  ASSERT_EQ(0, load_items.count());
+
+  make_items(100, items);
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::write(TENANT_ID, items));
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+  ASSERT_EQ(items.count(), load_items.count());
+  for (int64_t i = 0; i < items.count(); i++) {
+    const ObPlanCacheSnapshotItem &item = items.at(i);
+    const ObPlanCacheSnapshotItem &load_item = load_items.at(i);
+    ASSERT_EQ(item.db_id_, load_item.db_id_);
+    ASSERT_EQ(item.sql_cs_type_, load_item.sql_cs_type_);
+    ASSERT_EQ(item.constructed_sql_, load_item.constructed_sql_);
+    ASSERT_EQ(item.param_infos_, load_item.param_infos_);
+    ASSERT_EQ(item.sys_vars_str_, load_item.sys_vars_str_);
+    ASSERT_EQ(item.config_str_, load_item.config_str_);
+    ASSERT_EQ(item.outline_data_, load_item.outline_data_);
+    ASSERT_EQ(item.hit_count_, load_item.hit_count_);
+    ASSERT_EQ(item.execute_times_, load_item.execute_times_);
+    ASSERT_EQ(item.elapsed_time_, load_item.elapsed_time_);
+    ASSERT_EQ(item.last_active_time_, load_item.last_active_time_);
+  }
+
+  // overwrite the previous snapshot
+  items.reset();
+  load_items.reset();
+  make_items(10, items);
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::write(TENANT_ID, items));
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+  ASSERT_EQ(10, load_items.count());
+
+  // tenant dropped
+  load_items.reset();
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::remove(TENANT_ID));
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::remove(TENANT_ID));
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+  ASSERT_EQ(0, load_items.count());
+}
+
+TEST_F(TestPlanCacheSnapshot, truncated_file)
+{
+  ObArray<ObPlanCacheSnapshotItem> items;
+  ObArray<ObPlanCacheSnapshotItem> load_items;
+  char path[MAX_PATH_SIZE] = {0};
+  make_items(100, items);
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::write(TENANT_ID, items));
+  get_path(path);
+  const int64_t file_size = get_file_size();
+
+  ASSERT_EQ(0, truncate(path, file_size - 1));
+  ASSERT_EQ(OB_INVALID_DATA, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+  // only part of the header
+  ASSERT_EQ(0, truncate(path, 3));
+  ASSERT_NE(OB_SUCCESS, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+  ASSERT_EQ(0, truncate(path, 0));
+  ASSERT_EQ(OB_INVALID_DATA, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+}
+
+TEST_F(TestPlanCacheSnapshot, corrupted_file)
+{
+  ObArray<ObPlanCacheSnapshotItem> items;
+  ObArray<ObPlanCacheSnapshotItem> load_items;
+  char path[MAX_PATH_SIZE] = {0};
+  make_items(100, items);
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::write(TENANT_ID, items));
+  get_path(path);
+  const int64_t file_size = get_file_size();
+
+  // flip a byte of the last item
+  int fd = ::open(path, O_RDWR);
+  char c = 0;
+  ASSERT_TRUE(fd >= 0);
+  ASSERT_EQ(1, pread(fd, &c, 1, file_size - 1));
+  c = static_cast<char>(~c);
+  ASSERT_EQ(1, pwrite(fd, &c, 1, file_size - 1));
+  ::close(fd);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+
+  // bad magic
+  fd = ::open(path, O_RDWR);
+  ASSERT_TRUE(fd >= 0);
+  ASSERT_EQ(8, pwrite(fd, "garbage!", 8, 0));
+  ::close(fd);
+  ASSERT_NE(OB_SUCCESS, ObPlanCacheSnapshot::load(TENANT_ID, allocator_, load_items));
+}
+
+TEST_F(TestPlanCacheSnapshot, build_sql)
+{
+  ObPlanCacheSnapshotItem item;
+  ObString sql;
+  char param_infos[256];
+  // int, varchar, bool checked int and decimal(.., 2)
+  snprintf(param_infos, sizeof(param_infos), "{1,0,0,-1,%d},{1,0,0,-1,%d},{1,1,0,-1,%d},{1,0,0,2,%d}",
+           ObIntType, ObVarcharType, ObIntType, ObNumberType);
+  item.constructed_sql_ = ObString::make_string(
+      "select /* ? */ '?', `c?` from t1 where c1 = ? and c2 = ? and ? and c3 = \"a\\\"?\" + ?");
+  item.param_infos_ = ObString::make_string(param_infos);
+  ASSERT_EQ(OB_SUCCESS, item.build_sql(allocator_, sql));
+  ASSERT_EQ(ObString::make_string(
+      "select /* ? */ '?', `c?` from t1 where c1 = 1 and c2 = '1' and 0 and c3 = \"a\\\"?\" + 1.00"), sql);
+
+  // order by 1 is restored as text, the parameter is not in constructed sql
+  item.constructed_sql_ = ObString::make_string("select c1 from t1 order by 1");
+  ASSERT_EQ(OB_NOT_SUPPORTED, item.build_sql(allocator_, sql));
+  item.constructed_sql_ = ObString::make_string("select ?, ?, ?, ?, ? from t1");
+  ASSERT_EQ(OB_NOT_SUPPORTED, item.build_sql(allocator_, sql));
+
+  // no literal for bit
+  snprintf(param_infos, sizeof(param_infos), "{1,0,0,-1,%d}", ObBitType);
+  item.constructed_sql_ = ObString::make_string("select * from t1 where c1 = ?");
+  item.param_infos_ = ObString::make_string(param_infos);
+  ASSERT_EQ(OB_NOT_SUPPORTED, item.build_sql(allocator_, sql));
+
+  item.param_infos_ = ObString::make_string("{1,0,0");
+  ASSERT_EQ(OB_INVALID_DATA, item.build_sql(allocator_, sql));
+}
+
+TEST_F(TestPlanCacheSnapshot, parameterized_sql_in_file)
+{
+  ObArray<ObPlanCacheSnapshotItem> items;
+  char path[MAX_PATH_SIZE] = {0};
+  make_items(1, items);
+  ASSERT_EQ(OB_SUCCESS, ObPlanCacheSnapshot::write(TENANT_ID, items));
+  get_path(path);
+  const int64_t file_size = get_file_size();
+  char *buf = static_cast<char *>(allocator_.alloc(file_size));
+  int fd = ::open(path, O_RDONLY);
+  ASSERT_TRUE(fd >= 0);
+  ASSERT_EQ(file_size, pread(fd, buf, file_size, 0));
+  ::close(fd);
+  const char *sql = "select * from t0 where c1 = ?";
+  ASSERT_TRUE(NULL != memmem(buf, file_size, sql, strlen(sql)));
+}
+
+} // end namespace test
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_plan_cache_snapshot.log*");
+  OB_LOGGER.set_file_name("test_plan_cache_snapshot.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_row_writer.h"
 #include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_aggregated_store.h"
 #include "storage/ob_i_store.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/basic/ob_pushdown_filter.h"
@@ -84,10 +85,18 @@ public:
 
   void basic_filter_pushdown_bt_test();
 
+  void basic_filter_pushdown_like_test();
+
   void filter_pushdown_comaprison_neg_test();
 
   void batch_decode_to_datum_test(bool is_condensed = false);
 
+  void batch_get_ref_cnts_test();
+
+  void batch_sum_aggregate_test();
+
+  void sum_agg_cell_overflow_test();
+
   void batch_get_row_perf_test();
 
   void set_encoding_type(ObColumnHeader::Type type);
@@ -339,6 +348,8 @@ int TestColumnDecoder::test_filter_pushdown(
   filter.params_ = objs;
   if (sql::WHITE_OP_IN == filter.get_op_type()) {
     filter.init_obj_set();
+  } else if (sql::WHITE_OP_LI == filter.get_op_type()) {
+    filter.init_like_escape();
   }
 
   if (is_retro) {
@@ -840,6 +851,101 @@ void TestColumnDecoder::basic_filter_pushdown_bt_test()
   }
 }
 
+void TestColumnDecoder::basic_filter_pushdown_like_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+
+  int64_t seed0 = 10000;
+  int64_t seed1 = 10001;
+  for (int64_t i = 0; i < ROW_CNT - 40; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 40; i < ROW_CNT - 20; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 20; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  int64_t seed0_count = ROW_CNT - 40;
+  int64_t seed1_count = 20;
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    const ObObjType column_type = row_generate_.column_list_.at(i).col_type_.get_type();
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    } else if (ObVarcharType != column_type && ObCharType != column_type) {
+      continue;
+    }
+    ObObj ref_obj0;
+    setup_obj(ref_obj0, i, seed0);
+    ObObj ref_obj1;
+    setup_obj(ref_obj1, i, seed1);
+    const ObString val0 = ref_obj0.get_string();
+    ASSERT_GT(val0.length(), 8);
+
+    // contains, starts with, single char wildcard and mismatch
+    const int64_t pattern_cnt = 4;
+    char patterns[pattern_cnt][128];
+    snprintf(patterns[0], 128, "%%%.*s%%", 8, val0.ptr() + val0.length() - 8);
+    snprintf(patterns[1], 128, "%.*s%%", val0.length() - 4, val0.ptr());
+    snprintf(patterns[2], 128, "_%.*s", val0.length() - 1, val0.ptr() + 1);
+    snprintf(patterns[3], 128, "%%x%%");
+
+    for (int64_t j = 0; j < pattern_cnt; ++j) {
+      sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+      ObMalloc mallocer;
+      mallocer.set_label("ColumnDecoder");
+      ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 2);
+      objs.init(2);
+      ObObj pattern_obj;
+      pattern_obj.set_varchar(patterns[j], static_cast<int32_t>(strlen(patterns[j])));
+      pattern_obj.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+      ObObj escape_obj;
+      escape_obj.set_varchar("\\", 1);
+      escape_obj.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+      objs.push_back(pattern_obj);
+      objs.push_back(escape_obj);
+
+      int64_t expect_count = 0;
+      const ObString pattern_val = pattern_obj.get_string();
+      if (ObCharset::wildcmp(CS_TYPE_UTF8MB4_GENERAL_CI, val0, pattern_val, '\\', '_', '%')) {
+        expect_count += seed0_count;
+      }
+      if (ObCharset::wildcmp(CS_TYPE_UTF8MB4_GENERAL_CI, ref_obj1.get_string(), pattern_val, '\\', '_', '%')) {
+        expect_count += seed1_count;
+      }
+      if (j < pattern_cnt - 1) {
+        ASSERT_LE(seed0_count, expect_count);
+      } else {
+        ASSERT_EQ(0, expect_count);
+      }
+
+      int32_t col_idx = i;
+      white_filter.op_type_ = sql::WHITE_OP_LI;
+      ObBitmap result_bitmap(allocator_);
+      result_bitmap.init(ROW_CNT);
+      ASSERT_EQ(0, result_bitmap.popcnt());
+      ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(col_idx, is_retro_, decoder, white_filter, result_bitmap, objs));
+      ASSERT_EQ(expect_count, result_bitmap.popcnt()) << "pattern: " << patterns[j] << std::endl;
+    }
+  }
+}
+
 void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
 {
   ObDatumRow row;
@@ -937,6 +1043,230 @@ void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
   }
 }
 
+void TestColumnDecoder::batch_get_ref_cnts_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed0 = 10000;
+  int64_t seed1 = 10001;
+  for (int64_t i = 0; i < ROW_CNT - 22; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 22; i < ROW_CNT - 2; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 2; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  int64_t row_ids[ROW_CNT];
+  for (int64_t j = 0; j < ROW_CNT; ++j) {
+    row_ids[j] = j;
+  }
+  int64_t row_len = 0;
+  const char *row_data = nullptr;
+  int64_t checked_col_cnt = 0;
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    const ObColumnDecoder &col_decoder = decoder.decoders_[i];
+    if (ObColumnHeader::DICT != col_decoder.decoder_->get_type()) {
+      continue;
+    }
+    const ObDictDecoder *dict_decoder = static_cast<const ObDictDecoder *>(col_decoder.decoder_);
+    const int64_t dict_count = dict_decoder->get_dict_header()->count_;
+    int64_t ref_cnts[dict_count + 2];
+    ASSERT_EQ(OB_SUCCESS, dict_decoder->batch_get_ref_cnts(*col_decoder.ctx_, row_ids, ROW_CNT, ref_cnts));
+    ASSERT_EQ(2, ref_cnts[dict_count]);
+    ASSERT_EQ(0, ref_cnts[dict_count + 1]);
+    int64_t total_cnt = 0;
+    for (int64_t ref = 0; ref < dict_count; ++ref) {
+      ObObj dict_obj;
+      ASSERT_EQ(OB_SUCCESS, dict_decoder->decode(col_decoder.ctx_->obj_meta_, dict_obj, ref,
+                                                 col_decoder.ctx_->col_header_->length_));
+      int64_t expected_cnt = 0;
+      for (int64_t j = 0; j < ROW_CNT; ++j) {
+        ObObj obj;
+        ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(row_ids[j], row_data, row_len));
+        ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+        ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, row_ids[j], bs, row_data, row_len));
+        expected_cnt += (!obj.is_null() && obj == dict_obj) ? 1 : 0;
+      }
+      ASSERT_EQ(expected_cnt, ref_cnts[ref]) << "col: " << i << " ref: " << ref << std::endl;
+      total_cnt += ref_cnts[ref];
+    }
+    ASSERT_EQ(ROW_CNT - 2, total_cnt);
+    ++checked_col_cnt;
+  }
+  ASSERT_LT(0, checked_col_cnt);
+}
+
+void TestColumnDecoder::batch_sum_aggregate_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed0 = 10000;
+  int64_t seed1 = 10001;
+  for (int64_t i = 0; i < ROW_CNT - 22; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 22; i < ROW_CNT - 2; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 2; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  void *datum_buf = allocator_.alloc(sizeof(int8_t) * 128 * ROW_CNT);
+  ObDatum datums[ROW_CNT];
+  const char *cell_datas[ROW_CNT];
+  int64_t row_ids[ROW_CNT];
+  for (int64_t j = 0; j < ROW_CNT; ++j) {
+    datums[j].ptr_ = reinterpret_cast<char *>(datum_buf) + j * 128;
+    row_ids[j] = j;
+  }
+  int64_t row_len = 0;
+  const char *row_data = nullptr;
+  int64_t weighted_col_cnt = 0;
+  int64_t row_wise_col_cnt = 0;
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    const ObColumnDecoder &col_decoder = decoder.decoders_[i];
+    const ObObjMeta &meta = col_decoder.ctx_->obj_meta_;
+    sql::ObExpr expr;
+    if (ObIntTC == meta.get_type_class() || ObUIntTC == meta.get_type_class() ||
+        ObNumberTC == meta.get_type_class()) {
+      expr.datum_meta_.type_ = ObNumberType;
+    } else if (ObFloatTC == meta.get_type_class() || ObDoubleTC == meta.get_type_class()) {
+      expr.datum_meta_.type_ = ObDoubleType;
+    } else {
+      continue;
+    }
+    ObColumnParam col_param(allocator_);
+    col_param.set_meta_type(meta);
+    ObSumAggCell agg_cell(i, &col_param, &expr, allocator_);
+    ObSumAggCell row_cell(i, &col_param, &expr, allocator_);
+    ASSERT_EQ(OB_SUCCESS, agg_cell.init(ROW_CNT));
+    ASSERT_EQ(OB_SUCCESS, row_cell.init(ROW_CNT));
+    ASSERT_EQ(OB_SUCCESS, decoder.get_aggregate_result(i, row_ids, cell_datas, ROW_CNT, datums, agg_cell));
+    for (int64_t j = 0; j < ROW_CNT; ++j) {
+      ObObj obj;
+      ObStorageDatum datum;
+      ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(row_ids[j], row_data, row_len));
+      ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+      ASSERT_EQ(OB_SUCCESS, col_decoder.decode(obj, row_ids[j], bs, row_data, row_len));
+      ASSERT_EQ(OB_SUCCESS, datum.from_obj_enhance(obj));
+      ASSERT_EQ(OB_SUCCESS, row_cell.eval(datum));
+    }
+    ASSERT_EQ(row_cell.has_value_, agg_cell.has_value_) << "col: " << i << std::endl;
+    if (agg_cell.support_weighted_eval()) {
+      ObArenaAllocator tmp_allocator;
+      number::ObNumber agg_nmb;
+      number::ObNumber row_nmb;
+      ASSERT_EQ(OB_SUCCESS, agg_cell.get_result_number(agg_nmb, tmp_allocator));
+      ASSERT_EQ(OB_SUCCESS, row_cell.get_result_number(row_nmb, tmp_allocator));
+      ASSERT_EQ(0, agg_nmb.compare(row_nmb)) << "col: " << i << " " << agg_nmb.format()
+                                             << " " << row_nmb.format() << std::endl;
+      weighted_col_cnt += ObColumnHeader::DICT == col_decoder.decoder_->get_type() ? 1 : 0;
+    } else {
+      // float and double must be added in the same order as rows
+      ASSERT_EQ(0, MEMCMP(&agg_cell.sum_double_, &row_cell.sum_double_, sizeof(double)))
+          << "col: " << i << " " << agg_cell.sum_double_ << " " << row_cell.sum_double_ << std::endl;
+      ObStorageDatum one;
+      one.set_double(1.0);
+      ASSERT_EQ(OB_INVALID_ARGUMENT, agg_cell.eval(one, 2));
+      ++row_wise_col_cnt;
+    }
+  }
+  ASSERT_LT(0, weighted_col_cnt);
+  ASSERT_LT(0, row_wise_col_cnt);
+}
+
+void TestColumnDecoder::sum_agg_cell_overflow_test()
+{
+  ObArenaAllocator tmp_allocator;
+  sql::ObExpr expr;
+  expr.datum_meta_.type_ = ObNumberType;
+  ObObjMeta meta;
+  ObStorageDatum datum;
+  number::ObNumber result;
+  number::ObNumber expected;
+
+  // INT64_MAX * 4 - 5 * 2, overflow on both multiply and add
+  ObColumnParam int_param(allocator_);
+  meta.set_int();
+  int_param.set_meta_type(meta);
+  ObSumAggCell int_cell(0, &int_param, &expr, allocator_);
+  ASSERT_EQ(OB_SUCCESS, int_cell.init(ROW_CNT));
+  datum.set_int(INT64_MAX);
+  ASSERT_EQ(OB_SUCCESS, int_cell.eval(datum));
+  ASSERT_EQ(OB_SUCCESS, int_cell.eval(datum, 3));
+  datum.set_int(-5);
+  ASSERT_EQ(OB_SUCCESS, int_cell.eval(datum, 2));
+  datum.set_null();
+  ASSERT_EQ(OB_SUCCESS, int_cell.eval(datum, 100));
+  ASSERT_EQ(OB_SUCCESS, int_cell.get_result_number(result, tmp_allocator));
+  ASSERT_EQ(OB_SUCCESS, expected.from("36893488147419103218", tmp_allocator));
+  ASSERT_EQ(0, result.compare(expected)) << result.format() << std::endl;
+
+  // UINT64_MAX * 2 + 1 * 3
+  ObColumnParam uint_param(allocator_);
+  meta.set_uint64();
+  uint_param.set_meta_type(meta);
+  ObSumAggCell uint_cell(0, &uint_param, &expr, allocator_);
+  ASSERT_EQ(OB_SUCCESS, uint_cell.init(ROW_CNT));
+  datum.set_uint(UINT64_MAX);
+  ASSERT_EQ(OB_SUCCESS, uint_cell.eval(datum, 2));
+  datum.set_uint(1);
+  ASSERT_EQ(OB_SUCCESS, uint_cell.eval(datum, 3));
+  ASSERT_EQ(OB_SUCCESS, uint_cell.get_result_number(result, tmp_allocator));
+  ASSERT_EQ(OB_SUCCESS, expected.from("36893488147419103233", tmp_allocator));
+  ASSERT_EQ(0, result.compare(expected)) << result.format() << std::endl;
+
+  // number weighted by row count
+  ObColumnParam nmb_param(allocator_);
+  meta.set_number();
+  nmb_param.set_meta_type(meta);
+  ObSumAggCell nmb_cell(0, &nmb_param, &expr, allocator_);
+  ASSERT_EQ(OB_SUCCESS, nmb_cell.init(ROW_CNT));
+  number::ObNumber value;
+  ASSERT_EQ(OB_SUCCESS, value.from("1.25", tmp_allocator));
+  datum.set_number(value);
+  ASSERT_EQ(OB_SUCCESS, nmb_cell.eval(datum, 7));
+  ASSERT_EQ(OB_SUCCESS, nmb_cell.eval(datum));
+  ASSERT_EQ(OB_SUCCESS, nmb_cell.get_result_number(result, tmp_allocator));
+  ASSERT_EQ(OB_SUCCESS, expected.from("10", tmp_allocator));
+  ASSERT_EQ(0, result.compare(expected)) << result.format() << std::endl;
+
+  // the cell rejects the sum types which the optimizer does not push down
+  ASSERT_TRUE(sql::ObPushdownFilterUtils::is_sum_pushdown_supported(ObFloatTC, ObDoubleTC));
+  ASSERT_FALSE(sql::ObPushdownFilterUtils::is_sum_pushdown_supported(ObIntTC, ObIntTC));
+  ASSERT_FALSE(sql::ObPushdownFilterUtils::is_sum_pushdown_supported(ObDoubleTC, ObNumberTC));
+  ASSERT_FALSE(sql::ObPushdownFilterUtils::is_sum_pushdown_supported(ObStringTC, ObNumberTC));
+  expr.datum_meta_.type_ = ObIntType;
+  ObSumAggCell int_result_cell(0, &int_param, &expr, allocator_);
+  ASSERT_EQ(OB_NOT_SUPPORTED, int_result_cell.init(ROW_CNT));
+}
+
 // void TestColumnDecoder::batch_get_row_perf_test()
 // {
 //   ObDatumRow row;
@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 #include "test_column_decoder.h"
+#include "lib/random/ob_random.h"
 #define protected public
 #define private public
 
@@ -51,8 +52,155 @@ class TestIntBaseDiffDecoder : public TestColumnDecoder
 public:
   TestIntBaseDiffDecoder() : TestColumnDecoder(ObColumnHeader::Type::INTEGER_BASE_DIFF) {}
   virtual ~TestIntBaseDiffDecoder() {}
+  void batch_decode_by_row_ids_test(const bool has_null);
 };
 
+#define SET_SCALAR_DECODE_FUNC(funcs, STORE_LEN_TAG, DATUM_LEN_TAG) \
+  funcs[STORE_LEN_TAG][DATUM_LEN_TAG] \
+      = &(IntDiffFixBatchDecodeFunc_T<STORE_LEN_TAG, DATUM_LEN_TAG>::int_diff_fix_batch_decode_func)
+
+// Compare the dispatched (simd on capable cpu) decode functions with the scalar ones
+TEST(TestIntDiffFixBatchDecode, dispatched_equal_to_scalar)
+{
+  const int64_t DELTA_CNT = 300;
+  const int64_t MAX_ROW_CAP = 200;
+  const int64_t DATUM_BUF_LEN = 16;
+  const int64_t row_caps[] = {0, 1, 7, 8, 9, 15, 16, 17, 63, 64, 65, MAX_ROW_CAP};
+  ObMultiDimArray_T<int_diff_fix_batch_decode_func, 4, 4> scalar_funcs;
+  for (int32_t store_tag = 0; store_tag < 4; ++store_tag) {
+    for (int32_t datum_tag = 0; datum_tag < 4; ++datum_tag) {
+      scalar_funcs[store_tag][datum_tag] = nullptr;
+    }
+  }
+  // deltas are never longer than datums
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 0, 0);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 0, 1);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 0, 2);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 0, 3);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 1, 1);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 1, 2);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 1, 3);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 2, 2);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 2, 3);
+  SET_SCALAR_DECODE_FUNC(scalar_funcs, 3, 3);
+  ASSERT_TRUE(int_diff_fix_batch_decode_funcs_inited);
+  LOG_INFO("int diff fix batch decode", "avx512", is_avx512_valid());
+
+  uint64_t deltas[DELTA_CNT];
+  int64_t row_ids[MAX_ROW_CAP];
+  char expect_buf[MAX_ROW_CAP * DATUM_BUF_LEN];
+  char result_buf[MAX_ROW_CAP * DATUM_BUF_LEN];
+  // one more datum to check nothing is written after row_cap
+  ObDatum expect_datums[MAX_ROW_CAP + 1];
+  ObDatum result_datums[MAX_ROW_CAP + 1];
+  for (int64_t i = 0; i < DELTA_CNT; ++i) {
+    deltas[i] = ObRandom::rand(0, INT64_MAX);
+  }
+  const uint64_t base = ObRandom::rand(0, INT64_MAX);
+  for (int32_t store_tag = 0; store_tag < 4; ++store_tag) {
+    for (int32_t datum_tag = 0; datum_tag < 4; ++datum_tag) {
+      if (nullptr == scalar_funcs[store_tag][datum_tag]) {
+        continue;
+      }
+      for (int64_t k = 0; k < ARRAYSIZEOF(row_caps); ++k) {
+        const int64_t row_cap = row_caps[k];
+        // delta array is read with the store length, so DELTA_CNT is always in range
+        for (int64_t i = 0; i < row_cap; ++i) {
+          row_ids[i] = ObRandom::rand(0, DELTA_CNT - 1);
+        }
+        MEMSET(expect_buf, 0xa5, sizeof(expect_buf));
+        MEMSET(result_buf, 0xa5, sizeof(result_buf));
+        for (int64_t i = 0; i <= MAX_ROW_CAP; ++i) {
+          expect_datums[i].set_null();
+          result_datums[i].set_null();
+          expect_datums[i].ptr_ = expect_buf + (i % MAX_ROW_CAP) * DATUM_BUF_LEN;
+          result_datums[i].ptr_ = result_buf + (i % MAX_ROW_CAP) * DATUM_BUF_LEN;
+        }
+        const unsigned char *col_data = reinterpret_cast<const unsigned char *>(deltas);
+        scalar_funcs[store_tag][datum_tag](col_data, base, row_ids, row_cap, expect_datums);
+        int_diff_fix_batch_decode_funcs[store_tag][datum_tag](
+            col_data, base, row_ids, row_cap, result_datums);
+        ASSERT_EQ(0, MEMCMP(expect_buf, result_buf, sizeof(expect_buf)))
+            << "store_tag: " << store_tag << " datum_tag: " << datum_tag << " row_cap: " << row_cap;
+        for (int64_t i = 0; i <= MAX_ROW_CAP; ++i) {
+          ASSERT_EQ(expect_datums[i].pack_, result_datums[i].pack_) << "i: " << i;
+          ASSERT_EQ(i >= row_cap, result_datums[i].is_null()) << "i: " << i;
+        }
+      }
+    }
+  }
+}
+
+// Batch decode random row ids with a tail shorter than a simd batch, check with decode of each row
+void TestIntBaseDiffDecoder::batch_decode_by_row_ids_test(const bool has_null)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed = 10000;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed, row));
+    if (has_null && 0 == i % 13) {
+      for (int64_t j = rowkey_cnt_ + extra_rowkey_cnt_; j < full_column_cnt_; ++j) {
+        row.storage_datums_[j].set_null();
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  // fixed length deltas go through the dispatched decode functions
+  const_cast<bool &>(encoder_.ctx_.encoder_opt_.enable_bit_packing_) = false;
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  int64_t row_len = 0;
+  const char *row_data = nullptr;
+  const char *cell_datas[ROW_CNT];
+  void *datum_buf_1 = allocator_.alloc(sizeof(int8_t) * 128 * ROW_CNT);
+  void *datum_buf_2 = allocator_.alloc(sizeof(int8_t) * 128);
+  const int64_t row_caps[] = {1, 9, ROW_CNT - 3};
+  int64_t fast_path_col_cnt = 0;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    }
+    const ObColumnDecoder &col_decoder = decoder.decoders_[i];
+    if (ObColumnHeader::INTEGER_BASE_DIFF == col_decoder.decoder_->get_type()
+        && static_cast<const ObIntegerBaseDiffDecoder *>(col_decoder.decoder_)
+            ->fast_fix_data_valid(*col_decoder.ctx_)) {
+      ++fast_path_col_cnt;
+    }
+    for (int64_t k = 0; k < ARRAYSIZEOF(row_caps); ++k) {
+      const int64_t row_cap = row_caps[k];
+      ObDatum datums[ROW_CNT];
+      int64_t row_ids[ROW_CNT];
+      for (int64_t j = 0; j < row_cap; ++j) {
+        datums[j].ptr_ = reinterpret_cast<char *>(datum_buf_1) + j * 128;
+        row_ids[j] = (j * 7 + k) % ROW_CNT;
+      }
+      ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i]
+                .batch_decode(decoder.row_index_, row_ids, cell_datas, row_cap, datums));
+      for (int64_t j = 0; j < row_cap; ++j) {
+        ObObj obj;
+        ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(row_ids[j], row_data, row_len));
+        ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+        ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, row_ids[j], bs, row_data, row_len));
+        ObDatum datum_cast_from_obj;
+        datum_cast_from_obj.ptr_ = reinterpret_cast<char *>(datum_buf_2);
+        ASSERT_EQ(OB_SUCCESS, datum_cast_from_obj.from_obj(obj));
+        ASSERT_TRUE(ObDatum::binary_equal(datum_cast_from_obj, datums[j]))
+            << "col: " << i << " row_cap: " << row_cap << " row_id: " << row_ids[j];
+      }
+    }
+  }
+  if (!has_null) {
+    ASSERT_LT(0, fast_path_col_cnt);
+  }
+}
+
 class TestRetroPDDecoder : public TestColumnDecoder
 {
 public:
@@ -96,6 +244,21 @@ TEST_F(TestHexDecoder, basic_filter_pushdown_op_test_eq_ne_nu_nn)
   basic_filter_pushdown_eq_ne_nu_nn_test();
 }
 
+TEST_F(TestRetroPDDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
+TEST_F(TestDictDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
+TEST_F(TestStringPrefixDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
 TEST_F(TestDictDecoder, batch_decode_to_datum_condense_test)
 {
   batch_decode_to_datum_test(true);
@@ -106,6 +269,21 @@ TEST_F(TestDictDecoder, batch_decode_to_datum_test)
   batch_decode_to_datum_test();
 }
 
+TEST_F(TestDictDecoder, batch_get_ref_cnts_test)
+{
+  batch_get_ref_cnts_test();
+}
+
+TEST_F(TestDictDecoder, batch_sum_aggregate_test)
+{
+  batch_sum_aggregate_test();
+}
+
+TEST_F(TestDictDecoder, sum_agg_cell_overflow_test)
+{
+  sum_agg_cell_overflow_test();
+}
+
 TEST_F(TestRLEDecoder, batch_decode_to_datum_test)
 {
   batch_decode_to_datum_test();
@@ -116,6 +294,16 @@ TEST_F(TestIntBaseDiffDecoder, batch_decode_to_datum_test)
   batch_decode_to_datum_test();
 }
 
+TEST_F(TestIntBaseDiffDecoder, batch_decode_by_row_ids_test)
+{
+  batch_decode_by_row_ids_test(false);
+}
+
+TEST_F(TestIntBaseDiffDecoder, batch_decode_by_row_ids_with_null_test)
+{
+  batch_decode_by_row_ids_test(true);
+}
+
 TEST_F(TestHexDecoder, batch_decode_to_datum_test)
 {
   batch_decode_to_datum_test();
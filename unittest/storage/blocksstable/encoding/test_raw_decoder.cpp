@@ -361,6 +361,9 @@ int TestRawDecoder::test_filter_pushdown(
   ObObj *col_buf = new (obj_buf) ObObj [COLUMN_CNT]();
   filter.params_ = objs;
   filter.init_obj_set();
+  if (sql::WHITE_OP_LI == filter.get_op_type()) {
+    filter.init_like_escape();
+  }
   pd_filter_info.col_buf_ = col_buf;
   pd_filter_info.col_capacity_ = full_column_cnt_;
   pd_filter_info.start_ = 0;
@@ -723,6 +726,85 @@ TEST_F(TestRawDecoder, filter_push_down_in_nu)
   }
 }
 
+TEST_F(TestRawDecoder, filter_push_down_like)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+
+  int64_t seed0 = 0x0;
+  int64_t seed1 = 0x1;
+  for (int64_t i = 0; i < ROW_CNT - 20; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 20; i < ROW_CNT - 10; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 10; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  int64_t seed0_count = ROW_CNT - 20;
+  int64_t seed1_count = 10;
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    const ObObjType column_type = row_generate_.column_list_.at(i).col_type_.get_type();
+    if (i >= ROWKEY_CNT && i < read_info_.get_rowkey_count()) {
+      continue;
+    } else if (ObVarcharType != column_type && ObCharType != column_type) {
+      continue;
+    }
+    sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+    ObMalloc mallocer;
+    mallocer.set_label("RawDecoder");
+    ObFixedArray<ObObj, ObIAllocator> objs(mallocer);
+    objs.init(2);
+
+    ObObj ref_obj0;
+    setup_obj(ref_obj0, i, seed0);
+    ObObj ref_obj1;
+    setup_obj(ref_obj1, i, seed1);
+    // match the whole value of seed0 except its first char
+    char pattern[128];
+    const ObString val0 = ref_obj0.get_string();
+    snprintf(pattern, 128, "%%%.*s", val0.length() - 1, val0.ptr() + 1);
+    ObObj pattern_obj;
+    pattern_obj.set_varchar(pattern, static_cast<int32_t>(strlen(pattern)));
+    pattern_obj.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    ObObj escape_obj;
+    escape_obj.set_varchar("\\", 1);
+    escape_obj.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    objs.push_back(pattern_obj);
+    objs.push_back(escape_obj);
+
+    int64_t expect_count = seed0_count;
+    if (ObCharset::wildcmp(CS_TYPE_UTF8MB4_GENERAL_CI, ref_obj1.get_string(),
+                           pattern_obj.get_string(), '\\', '_', '%')) {
+      expect_count += seed1_count;
+    }
+
+    int32_t col_idx = i;
+    white_filter.op_type_ = sql::WHITE_OP_LI;
+    ObBitmap result_bitmap(allocator_);
+    result_bitmap.init(ROW_CNT);
+    ASSERT_EQ(0, result_bitmap.popcnt());
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(col_idx, decoder, white_filter, result_bitmap, objs));
+    ASSERT_EQ(expect_count, result_bitmap.popcnt());
+  }
+}
+
 TEST_F(TestRawDecoder, batch_decode_to_datum)
 {
   // Generate data and encode
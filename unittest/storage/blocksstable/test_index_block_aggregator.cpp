@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "share/schema/ob_table_schema.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestIndexBlockAggregator : public ::testing::Test
+{
+public:
+  static const int64_t TABLE_ID = 3001;
+  static const int64_t SNAPSHOT_VERSION = 2;
+  // rowkey(int), trans_version, sql_sequence, c1(int), c2(varchar)
+  static const int64_t STORE_COLUMN_CNT = 5;
+  TestIndexBlockAggregator() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  void prepare_row(const int64_t key, const int64_t c1, const bool c1_null, ObDatumRow &row);
+protected:
+  ObArenaAllocator allocator_;
+  ObTableSchema table_schema_;
+  ObDataStoreDesc desc_;
+};
+
+void TestIndexBlockAggregator::SetUp()
+{
+  ObColumnSchemaV2 column;
+  table_schema_.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema_.set_table_name("test_skip_index"));
+  table_schema_.set_tenant_id(1);
+  table_schema_.set_tablegroup_id(1);
+  table_schema_.set_database_id(1);
+  table_schema_.set_table_id(TABLE_ID);
+  table_schema_.set_rowkey_column_num(1);
+  table_schema_.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + 2);
+  const ObObjType types[] = {ObIntType, ObIntType, ObVarcharType};
+  char name[OB_MAX_FILE_NAME_LENGTH];
+  for (int64_t i = 0; i < 3; ++i) {
+    column.reset();
+    column.set_table_id(TABLE_ID);
+    column.set_column_id(i + OB_APP_MIN_COLUMN_ID);
+    sprintf(name, "test%020ld", i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name));
+    column.set_data_type(types[i]);
+    column.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    column.set_rowkey_position(0 == i ? 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+  }
+  ASSERT_EQ(OB_SUCCESS, desc_.init(table_schema_, share::ObLSID(1), ObTabletID(1), MAJOR_MERGE, SNAPSHOT_VERSION));
+  ASSERT_EQ(STORE_COLUMN_CNT, desc_.row_column_count_);
+}
+
+void TestIndexBlockAggregator::prepare_row(
+    const int64_t key,
+    const int64_t c1,
+    const bool c1_null,
+    ObDatumRow &row)
+{
+  row.storage_datums_[0].set_int(key);
+  row.storage_datums_[1].set_int(-SNAPSHOT_VERSION);
+  row.storage_datums_[2].set_int(0);
+  if (c1_null) {
+    row.storage_datums_[3].set_null();
+  } else {
+    row.storage_datums_[3].set_int(c1);
+  }
+  row.storage_datums_[4].set_string(ObString("skip_index"));
+  row.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+}
+
+TEST_F(TestIndexBlockAggregator, test_eval_and_serialize)
+{
+  ObSkipIndexAggregator aggregator;
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, STORE_COLUMN_CNT));
+  ASSERT_EQ(OB_NOT_INIT, aggregator.eval(row));
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_));
+  // only rowkey and c1 are collected, multi-version columns and varchar are ignored
+  ASSERT_EQ(2, aggregator.col_cnt_);
+  ASSERT_EQ(0, aggregator.get_serialize_size());
+
+  const int64_t c1_values[] = {5, -3, 100, 7};
+  for (int64_t i = 0; i < 4; ++i) {
+    prepare_row(i + 10, c1_values[i], false, row);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  }
+  prepare_row(20, 0, true, row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+
+  const int64_t size = aggregator.get_serialize_size();
+  ASSERT_EQ(sizeof(ObSkipIndexHeader) + 2 * sizeof(ObSkipIndexColMeta), size);
+  char buf[256];
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.serialize(buf, sizeof(buf), pos));
+  ASSERT_EQ(size, pos);
+
+  const ObSkipIndexHeader *skip_index = reinterpret_cast<const ObSkipIndexHeader *>(buf);
+  ASSERT_TRUE(skip_index->is_valid());
+  ASSERT_EQ(2, skip_index->col_cnt_);
+  ASSERT_EQ(nullptr, skip_index->get_col_meta(1));
+  const ObSkipIndexColMeta *rowkey_meta = skip_index->get_col_meta(0);
+  const ObSkipIndexColMeta *c1_meta = skip_index->get_col_meta(3);
+  ASSERT_NE(nullptr, rowkey_meta);
+  ASSERT_NE(nullptr, c1_meta);
+
+  ObStorageDatum datum;
+  rowkey_meta->get_min_datum(datum);
+  ASSERT_EQ(10, datum.get_int());
+  rowkey_meta->get_max_datum(datum);
+  ASSERT_EQ(20, datum.get_int());
+  ASSERT_EQ(0, rowkey_meta->null_count_);
+  c1_meta->get_min_datum(datum);
+  ASSERT_EQ(-3, datum.get_int());
+  c1_meta->get_max_datum(datum);
+  ASSERT_EQ(100, datum.get_int());
+  ASSERT_EQ(1, c1_meta->null_count_);
+
+  // next micro block with null c1 only
+  aggregator.reuse();
+  ASSERT_EQ(0, aggregator.get_serialize_size());
+  prepare_row(30, 0, true, row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.serialize(buf, sizeof(buf), pos));
+  c1_meta = reinterpret_cast<const ObSkipIndexHeader *>(buf)->get_col_meta(3);
+  ASSERT_NE(nullptr, c1_meta);
+  ASSERT_FALSE(c1_meta->has_min_max());
+  ASSERT_EQ(1, c1_meta->null_count_);
+
+  // nop value makes the column invalid in current block
+  aggregator.reuse();
+  prepare_row(40, 1, false, row);
+  row.storage_datums_[3].set_nop();
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+  ASSERT_EQ(sizeof(ObSkipIndexHeader) + sizeof(ObSkipIndexColMeta), aggregator.get_serialize_size());
+}
+
+TEST_F(TestIndexBlockAggregator, test_index_row)
+{
+  ObSkipIndexAggregator aggregator;
+  ObDatumRow row;
+  ObIndexBlockRowBuilder row_builder;
+  ObIndexBlockRowParser row_parser;
+  ObIndexBlockRowDesc row_desc(desc_);
+  const ObDatumRow *index_row = nullptr;
+  const ObIndexBlockRowHeader *header = nullptr;
+  const ObSkipIndexHeader *skip_index = nullptr;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, STORE_COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(desc_));
+  prepare_row(1, 1, false, row);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row));
+
+  ASSERT_EQ(OB_SUCCESS, row_builder.init(desc_));
+  ASSERT_EQ(OB_SUCCESS, row_desc.row_key_.assign(row.storage_datums_, desc_.rowkey_column_count_));
+  row_desc.is_data_block_ = true;
+  row_desc.micro_block_count_ = 1;
+  row_desc.row_count_ = 1;
+  row_desc.aggregator_ = &aggregator;
+  ASSERT_EQ(OB_SUCCESS, row_builder.build_row(row_desc, index_row));
+  ASSERT_EQ(OB_SUCCESS, row_parser.init(desc_.rowkey_column_count_, *index_row));
+  ASSERT_EQ(OB_SUCCESS, row_parser.get_header(header));
+  ASSERT_TRUE(header->is_pre_aggregated());
+  ASSERT_EQ(OB_SUCCESS, row_parser.get_skip_index(skip_index));
+  ASSERT_NE(nullptr, skip_index);
+  ASSERT_EQ(2, skip_index->col_cnt_);
+
+  // reused micro block carries no skip index
+  row_desc.aggregator_ = nullptr;
+  ASSERT_EQ(OB_SUCCESS, row_builder.build_row(row_desc, index_row));
+  ASSERT_EQ(OB_SUCCESS, row_parser.init(desc_.rowkey_column_count_, *index_row));
+  ASSERT_EQ(OB_SUCCESS, row_parser.get_header(header));
+  ASSERT_FALSE(header->is_pre_aggregated());
+  ASSERT_EQ(OB_SUCCESS, row_parser.get_skip_index(skip_index));
+  ASSERT_EQ(nullptr, skip_index);
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_index_block_aggregator.log");
+  OB_LOGGER.set_file_name("test_index_block_aggregator.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <thread>
+#include <vector>
+
+#define USING_LOG_PREFIX STORAGE
+
+#define protected public
+#define private public
+
+#include "lib/oblog/ob_log.h"
+#include "share/ob_local_device.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+#ifdef OB_LOCAL_DEVICE_IO_URING_ENABLED
+static const char *TEST_FILE = "test_io_uring_context.data";
+static const int64_t IO_SIZE = 4096;
+static const int64_t THREAD_CNT = 4;
+static const int64_t IO_CNT_PER_THREAD = 256;
+static const int64_t IO_CNT = THREAD_CNT * IO_CNT_PER_THREAD;
+static const uint32_t MAX_EVENTS = 64;
+
+class TestIOUringContext : public ::testing::Test
+{
+public:
+  TestIOUringContext() : fd_(-1), bufs_(nullptr) {}
+  virtual ~TestIOUringContext() = default;
+  virtual void SetUp()
+  {
+    fd_ = ::open(TEST_FILE, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    ASSERT_TRUE(fd_ >= 0);
+    ASSERT_EQ(0, posix_memalign(reinterpret_cast<void **>(&bufs_), IO_SIZE, IO_SIZE * IO_CNT));
+  }
+  virtual void TearDown()
+  {
+    free(bufs_);
+    ::close(fd_);
+    ::unlink(TEST_FILE);
+  }
+  // submit IO_CNT ios from several threads and reap them in the current thread
+  void run_ios(share::ObLocalIOUringContext &ctx, const bool is_read);
+protected:
+  int fd_;
+  char *bufs_;
+};
+
+void TestIOUringContext::run_ios(share::ObLocalIOUringContext &ctx, const bool is_read)
+{
+  std::vector<struct iocb> cbs(IO_CNT);
+  std::vector<int64_t> results(IO_CNT, -1);
+  std::vector<std::thread> submitters;
+  int64_t submit_fail_cnt = 0;
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    submitters.push_back(std::thread([&, t]() {
+      for (int64_t i = t * IO_CNT_PER_THREAD; i < (t + 1) * IO_CNT_PER_THREAD; ++i) {
+        if (is_read) {
+          io_prep_pread(&cbs[i], fd_, bufs_ + i * IO_SIZE, IO_SIZE, i * IO_SIZE);
+        } else {
+          io_prep_pwrite(&cbs[i], fd_, bufs_ + i * IO_SIZE, IO_SIZE, i * IO_SIZE);
+        }
+        cbs[i].data = reinterpret_cast<void *>(i + 1);
+        int ret = OB_EAGAIN;
+        while (OB_EAGAIN == ret) {
+          // submission queue is full until the reaper catches up
+          if (OB_EAGAIN == (ret = ctx.submit(cbs[i]))) {
+            usleep(100);
+          }
+        }
+        if (OB_SUCCESS != ret) {
+          ATOMIC_INC(&submit_fail_cnt);
+        }
+      }
+    }));
+  }
+  struct io_event events[MAX_EVENTS];
+  struct timespec timeout;
+  timeout.tv_sec = 0;
+  timeout.tv_nsec = 10 * 1000 * 1000;
+  int64_t reaped_cnt = 0;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  while (reaped_cnt < IO_CNT && ObTimeUtility::current_time() - start_ts < 60 * 1000 * 1000) {
+    int64_t complete_cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, ctx.get_events(1, MAX_EVENTS, events, &timeout, complete_cnt));
+    for (int64_t i = 0; i < complete_cnt; ++i) {
+      const int64_t idx = reinterpret_cast<int64_t>(events[i].data) - 1;
+      ASSERT_TRUE(idx >= 0 && idx < IO_CNT);
+      ASSERT_EQ(-1, results[idx]);
+      results[idx] = static_cast<int64_t>(events[i].res);
+    }
+    reaped_cnt += complete_cnt;
+  }
+  for (int64_t t = 0; t < THREAD_CNT; ++t) {
+    submitters[t].join();
+  }
+  ASSERT_EQ(0, submit_fail_cnt);
+  ASSERT_EQ(IO_CNT, reaped_cnt);
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    ASSERT_EQ(IO_SIZE, results[i]) << "io: " << i;
+  }
+  // every sqe is consumed by kernel
+  ASSERT_EQ(*ctx.sq_tail_, *ctx.sq_head_);
+  ASSERT_FALSE(ctx.submitting_);
+}
+
+TEST_F(TestIOUringContext, concurrent_read_write)
+{
+  share::ObLocalIOUringContext ctx;
+  int ret = ctx.init(MAX_EVENTS, false/*enable_sqpoll*/, fd_);
+  if (OB_NOT_SUPPORTED == ret) {
+    LOG_INFO("io uring is not supported by kernel, skip", K(ret));
+    return;
+  }
+  ASSERT_EQ(OB_SUCCESS, ret);
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    MEMSET(bufs_ + i * IO_SIZE, static_cast<int>('a' + i % 26), IO_SIZE);
+  }
+  run_ios(ctx, false);
+  MEMSET(bufs_, 0, IO_SIZE * IO_CNT);
+  run_ios(ctx, true);
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    for (int64_t j = 0; j < IO_SIZE; ++j) {
+      ASSERT_EQ(static_cast<char>('a' + i % 26), bufs_[i * IO_SIZE + j]) << "io: " << i;
+    }
+  }
+  // read beyond the end of file
+  struct iocb cb;
+  struct io_event event;
+  int64_t complete_cnt = 0;
+  io_prep_pread(&cb, fd_, bufs_, IO_SIZE, IO_SIZE * IO_CNT);
+  cb.data = &cb;
+  ASSERT_EQ(OB_SUCCESS, ctx.submit(cb));
+  ASSERT_EQ(OB_SUCCESS, ctx.get_events(1, 1, &event, nullptr, complete_cnt));
+  ASSERT_EQ(1, complete_cnt);
+  ASSERT_EQ(static_cast<void *>(&cb), event.data);
+  ASSERT_EQ(0, static_cast<int64_t>(event.res));
+}
+
+TEST_F(TestIOUringContext, get_events_timeout)
+{
+  share::ObLocalIOUringContext ctx;
+  int ret = ctx.init(MAX_EVENTS, false/*enable_sqpoll*/, -1);
+  if (OB_NOT_SUPPORTED == ret) {
+    LOG_INFO("io uring is not supported by kernel, skip", K(ret));
+    return;
+  }
+  ASSERT_EQ(OB_SUCCESS, ret);
+  struct io_event events[MAX_EVENTS];
+  struct timespec timeout;
+  timeout.tv_sec = 0;
+  timeout.tv_nsec = 20 * 1000 * 1000;
+  int64_t complete_cnt = -1;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, ctx.get_events(1, MAX_EVENTS, events, &timeout, complete_cnt));
+  ASSERT_EQ(0, complete_cnt);
+  ASSERT_GE(ObTimeUtility::current_time() - start_ts, 10 * 1000);
+}
+
+TEST_F(TestIOUringContext, sqpoll)
+{
+  share::ObLocalIOUringContext ctx;
+  int ret = ctx.init(MAX_EVENTS, true/*enable_sqpoll*/, fd_);
+  if (OB_NOT_SUPPORTED == ret) {
+    // sqpoll needs privilege on old kernels
+    LOG_INFO("io uring sqpoll is not supported, skip", K(ret));
+    return;
+  }
+  ASSERT_EQ(OB_SUCCESS, ret);
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    MEMSET(bufs_ + i * IO_SIZE, static_cast<int>('A' + i % 26), IO_SIZE);
+  }
+  run_ios(ctx, false);
+  MEMSET(bufs_, 0, IO_SIZE * IO_CNT);
+  run_ios(ctx, true);
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    ASSERT_EQ(static_cast<char>('A' + i % 26), bufs_[i * IO_SIZE + IO_SIZE - 1]) << "io: " << i;
+  }
+}
+#endif
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_io_uring_context.log*");
+  OB_LOGGER.set_file_name("test_io_uring_context.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
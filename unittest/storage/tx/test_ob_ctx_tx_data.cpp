@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#define private public
+#include "storage/tx/ob_ctx_tx_data.h"
+#undef private
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace storage;
+using namespace transaction;
+namespace unittest
+{
+
+static const int64_t READER_CNT = 4;
+static const int64_t WRITE_CNT = 1000000;
+
+class TestObTxStateSnapshot : public ::testing::Test
+{
+public:
+  virtual void SetUp() { stop_ = false; }
+  virtual void TearDown() {}
+  static int32_t state_of(const int64_t version)
+  {
+    return static_cast<int32_t>(version % ObTxData::MAX_STATE_CNT);
+  }
+protected:
+  ObTxStateSnapshot snapshot_;
+  ObTxData tx_data_;
+  bool stop_;
+};
+
+TEST_F(TestObTxStateSnapshot, basic)
+{
+  int32_t state = 0;
+  SCN version;
+  snapshot_.get(state, version);
+  ASSERT_EQ(ObTxData::RUNNING, state);
+  ASSERT_FALSE(version.is_valid());
+
+  tx_data_.state_ = ObTxData::RUNNING;
+  tx_data_.commit_version_.reset();
+  snapshot_.refresh(tx_data_);
+  ASSERT_TRUE(snapshot_.check(tx_data_));
+
+  version.convert_for_tx(100);
+  snapshot_.set_commit_version(tx_data_, version);
+  snapshot_.set_state(tx_data_, ObTxData::COMMIT);
+  ASSERT_EQ(ObTxData::COMMIT, tx_data_.state_);
+  ASSERT_EQ(version, tx_data_.commit_version_);
+  ASSERT_TRUE(snapshot_.check(tx_data_));
+  ASSERT_EQ(6, snapshot_.seq_);
+
+  // tx data modified without the snapshot
+  tx_data_.commit_version_.convert_for_tx(200);
+  ASSERT_FALSE(snapshot_.check(tx_data_));
+  snapshot_.refresh(tx_data_);
+  ASSERT_TRUE(snapshot_.check(tx_data_));
+  tx_data_.state_ = ObTxData::ABORT;
+  ASSERT_FALSE(snapshot_.check(tx_data_));
+}
+
+// readers never see a state and commit version written by different writes
+TEST_F(TestObTxStateSnapshot, concurrent_refresh)
+{
+  std::vector<std::thread> readers;
+  int64_t fail_cnt = 0;
+  for (int64_t i = 0; i < READER_CNT; i++) {
+    readers.push_back(std::thread([&]() {
+      int64_t last_version = 0;
+      while (!ATOMIC_LOAD(&stop_)) {
+        int32_t state = 0;
+        SCN version;
+        snapshot_.get(state, version);
+        if (version.is_valid()) {
+          const int64_t v = version.get_val_for_tx();
+          if (state != state_of(v) || v < last_version) {
+            ATOMIC_INC(&fail_cnt);
+          }
+          last_version = v;
+        }
+      }
+    }));
+  }
+  ObTxData tx_data;
+  for (int64_t i = 1; i <= WRITE_CNT; i++) {
+    tx_data.commit_version_.convert_for_tx(i);
+    tx_data.state_ = state_of(i);
+    snapshot_.refresh(tx_data);
+  }
+  ATOMIC_STORE(&stop_, true);
+  for (int64_t i = 0; i < READER_CNT; i++) {
+    readers[i].join();
+  }
+  ASSERT_EQ(0, fail_cnt);
+  ASSERT_EQ(2 * WRITE_CNT, snapshot_.seq_);
+}
+
+// tx data updated through the snapshot always matches it, which is what the
+// debug check of ObCtxTxData relies on
+TEST_F(TestObTxStateSnapshot, concurrent_set)
+{
+  std::vector<std::thread> readers;
+  int64_t fail_cnt = 0;
+  snapshot_.refresh(tx_data_);
+  for (int64_t i = 0; i < READER_CNT; i++) {
+    readers.push_back(std::thread([&]() {
+      while (!ATOMIC_LOAD(&stop_)) {
+        if (!snapshot_.check(tx_data_)) {
+          ATOMIC_INC(&fail_cnt);
+        }
+      }
+    }));
+  }
+  // two writers on different fields
+  std::thread state_writer([&]() {
+    for (int64_t i = 1; i <= WRITE_CNT; i++) {
+      snapshot_.set_state(tx_data_, state_of(i));
+    }
+  });
+  for (int64_t i = 1; i <= WRITE_CNT; i++) {
+    SCN version;
+    version.convert_for_tx(i);
+    snapshot_.set_commit_version(tx_data_, version);
+  }
+  state_writer.join();
+  ATOMIC_STORE(&stop_, true);
+  for (int64_t i = 0; i < READER_CNT; i++) {
+    readers[i].join();
+  }
+  ASSERT_EQ(0, fail_cnt);
+  ASSERT_EQ(4 * WRITE_CNT + 2, snapshot_.seq_);
+  ASSERT_TRUE(snapshot_.check(tx_data_));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  oceanbase::common::ObLogger &logger = oceanbase::common::ObLogger::get_logger();
+  logger.set_file_name("test_ob_ctx_tx_data.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
@@ -237,6 +237,7 @@ TEST_F(TestObStandbyRead, trans_check_for_standby)
   max_decided_scn.convert_for_tx(10);
   bool can_read = false;
   SCN trans_version = SCN::min_scn();
+  SCN commit_version;
   bool is_determined_state = false;
   ObStateInfo state_info;
   ObAskStateRespMsg resp;
@@ -318,8 +319,9 @@ TEST_F(TestObStandbyRead, trans_check_for_standby)
   ObSliceAlloc slice_allocator;
   part2_tx_data.ref_cnt_ = 1000;
   part2_tx_data.slice_allocator_ = &slice_allocator;
-  part2.ctx_tx_data_.tx_data_guard_.init(&part2_tx_data);
-  part2.ctx_tx_data_.tx_data_guard_.tx_data()->commit_version_.convert_for_tx(90);
+  part2.ctx_tx_data_.test_init(part2_tx_data, part2.ctx_tx_data_.ctx_mgr_);
+  commit_version.convert_for_tx(90);
+  ASSERT_EQ(OB_SUCCESS, part2.ctx_tx_data_.set_commit_version(commit_version));
   part3.set_downstream_state(ObTxState::UNKNOWN);
   can_read = false;
   part1.state_info_array_.reset();
@@ -348,7 +350,8 @@ TEST_F(TestObStandbyRead, trans_check_for_standby)
   part1.set_downstream_state(ObTxState::PREPARE);
   coord.exec_info_.prepare_version_.convert_for_tx(90);
   part2.set_downstream_state(ObTxState::COMMIT);
-  part2.ctx_tx_data_.tx_data_guard_.tx_data()->commit_version_.convert_for_tx(300);
+  commit_version.convert_for_tx(300);
+  ASSERT_EQ(OB_SUCCESS, part2.ctx_tx_data_.set_commit_version(commit_version));
   part3.set_downstream_state(ObTxState::UNKNOWN);
   can_read = true;
   part1.state_info_array_.reset();
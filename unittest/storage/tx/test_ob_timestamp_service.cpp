@@ -11,12 +11,16 @@
  */
 
 #include <gtest/gtest.h>
+#define private public
+#include "storage/tx/ob_gts_source.h"
+#undef private
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
 #include "lib/net/ob_addr.h"
 #include "storage/tx/ob_timestamp_service.h"
 #include "storage/tx/ob_gts_rpc.h"
 #include "storage/tx/ob_gts_define.h"
+#include "storage/tx/ob_location_adapter.h"
 
 namespace oceanbase
 {
@@ -169,6 +173,70 @@ private:
   MyResponseRpc rpc_;
 };
 
+class MyRequestRpc : public ObIGtsRequestRpc
+{
+public:
+  MyRequestRpc() : post_cnt_(0), last_srr_() {}
+  ~MyRequestRpc() {}
+  int start() { return OB_SUCCESS; }
+  int stop() { return OB_SUCCESS; }
+  int wait() { return OB_SUCCESS; }
+  void destroy() {}
+public:
+  int post(const uint64_t tenant_id, const ObAddr &server, const ObGtsRequest &msg)
+  {
+    UNUSED(tenant_id);
+    UNUSED(server);
+    post_cnt_++;
+    last_srr_ = msg.get_srr();
+    return OB_SUCCESS;
+  }
+  int64_t post_cnt_;
+  MonotonicTs last_srr_;
+};
+
+class MyLocationAdapter : public ObILocationAdapter
+{
+public:
+  MyLocationAdapter() {}
+  ~MyLocationAdapter() {}
+  int init(share::schema::ObMultiVersionSchemaService *schema_service,
+           share::ObLocationService *location_service)
+  {
+    UNUSED(schema_service);
+    UNUSED(location_service);
+    return OB_SUCCESS;
+  }
+  void destroy() {}
+public:
+  int nonblock_get_leader(const int64_t cluster_id, const int64_t tenant_id,
+                          const share::ObLSID &ls_id, ObAddr &leader)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    leader = leader_;
+    return OB_SUCCESS;
+  }
+  int nonblock_renew(const int64_t cluster_id, const int64_t tenant_id, const share::ObLSID &ls_id)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    return OB_SUCCESS;
+  }
+  int nonblock_get(const int64_t cluster_id, const int64_t tenant_id, const share::ObLSID &ls_id,
+                   share::ObLSLocation &location)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    UNUSED(location);
+    return OB_NOT_SUPPORTED;
+  }
+  ObAddr leader_;
+};
+
 class TestObGtsMgr : public ::testing::Test
 {
 public :
@@ -244,6 +312,104 @@ TEST_F(TestObGtsMgr, invalid_argument)
   EXPECT_EQ(OB_INVALID_ARGUMENT, request.init(tenant_id, srr, ts_range, ObAddr()));
 }
 
+TEST_F(TestObGtsMgr, gts_wait_histogram)
+{
+  ObGtsWaitHistogram histogram;
+  EXPECT_EQ(0, histogram.get_total_count());
+  EXPECT_EQ(0, histogram.get_percentile(99));
+  for (int64_t i = 0; i < 98; i++) {
+    histogram.add(30);
+  }
+  histogram.add(800);
+  histogram.add(200 * 1000);
+  EXPECT_EQ(100, histogram.get_total_count());
+  EXPECT_EQ(98, histogram.get_count(0));
+  EXPECT_EQ(1, histogram.get_count(4));
+  EXPECT_EQ(1, histogram.get_count(ObGtsWaitHistogram::BUCKET_COUNT - 1));
+  EXPECT_EQ(50, histogram.get_percentile(50));
+  EXPECT_EQ(1000, histogram.get_percentile(99));
+  EXPECT_EQ(200 * 1000, histogram.get_percentile(100));
+  TRANS_LOG(INFO, "gts wait histogram", K(histogram));
+  histogram.reset();
+  EXPECT_EQ(0, histogram.get_total_count());
+  EXPECT_EQ(0, histogram.get_count(0));
+}
+
+TEST_F(TestObGtsMgr, gts_rpc_slot_and_deferral)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  const ObAddr server(ObAddr::IPV4, "10.0.0.1", 20000);
+  const uint64_t tenant_id = 1001;
+  MyRequestRpc rpc;
+  MyLocationAdapter location_adapter;
+  location_adapter.leader_ = ObAddr(ObAddr::IPV4, "10.0.0.2", 20000);
+  ObGtsSource gts_source;
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  MonotonicTs stc;
+  bool update = false;
+  ASSERT_EQ(OB_SUCCESS, gts_source.init(tenant_id, server, &rpc, &location_adapter));
+
+  // the first waiter sends rpc at once
+  EXPECT_EQ(OB_EAGAIN, gts_source.get_gts(MonotonicTs::current_time(), NULL, gts, receive_gts_ts));
+  EXPECT_EQ(1, rpc.post_cnt_);
+
+  // the window is full, the waiter is deferred until the rpc interval expires
+  gts_source.gts_rpc_rtt_ = 40 * 1000;
+  gts_source.last_rpc_ts_ = MonotonicTs::current_time().mts_;
+  stc = MonotonicTs(rpc.last_srr_.mts_ + 1);
+  EXPECT_EQ(OB_EAGAIN, gts_source.get_gts(stc, NULL, gts, receive_gts_ts));
+  EXPECT_EQ(1, rpc.post_cnt_);
+  EXPECT_EQ(stc.mts_, gts_source.deferred_stc_);
+  gts_source.query_deferred_gts();
+  EXPECT_EQ(1, rpc.post_cnt_);
+  gts_source.last_rpc_ts_ -= ObGtsSource::MAX_GTS_RPC_INTERVAL_US;
+  gts_source.query_deferred_gts();
+  EXPECT_EQ(2, rpc.post_cnt_);
+  EXPECT_EQ(0, gts_source.deferred_stc_);
+
+  // an error response sends the deferred rpc at once
+  gts_source.last_rpc_ts_ = MonotonicTs::current_time().mts_;
+  stc = MonotonicTs(rpc.last_srr_.mts_ + 1);
+  EXPECT_EQ(OB_EAGAIN, gts_source.get_gts(stc, NULL, gts, receive_gts_ts));
+  EXPECT_EQ(2, rpc.post_cnt_);
+  ObGtsErrResponse err_response;
+  EXPECT_EQ(OB_SUCCESS, err_response.init(tenant_id, rpc.last_srr_, OB_GTS_NOT_READY,
+                                          location_adapter.leader_));
+  EXPECT_EQ(OB_SUCCESS, gts_source.handle_gts_err_response(err_response));
+  EXPECT_EQ(3, rpc.post_cnt_);
+  EXPECT_EQ(0, gts_source.deferred_stc_);
+
+  // a response sent before stc can't satisfy the deferred waiter, the rpc is sent at once
+  gts_source.gts_rpc_rtt_ = 40 * 1000;
+  gts_source.last_rpc_ts_ = MonotonicTs::current_time().mts_;
+  stc = MonotonicTs(rpc.last_srr_.mts_ + 1);
+  EXPECT_EQ(OB_EAGAIN, gts_source.get_gts(stc, NULL, gts, receive_gts_ts));
+  EXPECT_EQ(3, rpc.post_cnt_);
+  EXPECT_EQ(OB_SUCCESS, gts_source.update_gts(rpc.last_srr_, 100, MonotonicTs::current_time(), update));
+  EXPECT_EQ(4, rpc.post_cnt_);
+  EXPECT_EQ(0, gts_source.deferred_stc_);
+
+  // a response sent after stc satisfies the deferred waiter
+  gts_source.gts_rpc_rtt_ = 40 * 1000;
+  gts_source.last_rpc_ts_ = MonotonicTs::current_time().mts_;
+  stc = MonotonicTs(rpc.last_srr_.mts_ + 1);
+  EXPECT_EQ(OB_EAGAIN, gts_source.get_gts(stc, NULL, gts, receive_gts_ts));
+  EXPECT_EQ(4, rpc.post_cnt_);
+  EXPECT_EQ(OB_SUCCESS, gts_source.update_gts(stc, 200, MonotonicTs::current_time(), update));
+  EXPECT_EQ(4, rpc.post_cnt_);
+  EXPECT_EQ(0, gts_source.deferred_stc_);
+  EXPECT_EQ(OB_SUCCESS, gts_source.get_gts(stc, NULL, gts, receive_gts_ts));
+  EXPECT_EQ(200, gts);
+
+  // no rpc is in flight, the waiter sends rpc at once even if the window is full
+  gts_source.last_rpc_ts_ = MonotonicTs::current_time().mts_;
+  stc = MonotonicTs(stc.mts_ + 1);
+  EXPECT_EQ(OB_EAGAIN, gts_source.get_gts(stc, NULL, gts, receive_gts_ts));
+  EXPECT_EQ(5, rpc.post_cnt_);
+  EXPECT_EQ(0, gts_source.deferred_stc_);
+}
+
 }//end of unittest
 }//end of oceanbase
 
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+#define UNITTEST
+
+#include "storage/tx_table/ob_tx_data_cache.h"
+#include "storage/tx_table/ob_tx_table_iterator.h"
+#include "storage/tx/ob_tx_data_define.h"
+#include "share/ob_simple_mem_limit_getter.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace common;
+using namespace transaction;
+using namespace storage;
+using namespace blocksstable;
+using namespace share;
+
+namespace unittest
+{
+
+static ObSimpleMemLimitGetter getter;
+
+// rows of tx data sstable, only the tx id column is filled
+class MockTxDataRowIterator : public ObIStoreRowIterator
+{
+public:
+  MockTxDataRowIterator() : allocator_(), rows_(), idx_(0) {}
+  virtual ~MockTxDataRowIterator() {}
+  int add_row(const int64_t tx_id)
+  {
+    int ret = OB_SUCCESS;
+    ObDatumRow *row = OB_NEWx(ObDatumRow, &allocator_);
+    if (OB_ISNULL(row)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else if (OB_FAIL(row->init(allocator_, TX_DATA_MAX_COLUMN))) {
+    } else {
+      row->storage_datums_[TX_DATA_ID_COLUMN].set_int(tx_id);
+      ret = rows_.push_back(row);
+    }
+    return ret;
+  }
+  virtual int get_next_row(const ObDatumRow *&row) override
+  {
+    int ret = OB_SUCCESS;
+    if (idx_ >= rows_.count()) {
+      ret = OB_ITER_END;
+    } else {
+      row = rows_.at(idx_++);
+    }
+    return ret;
+  }
+private:
+  ObArenaAllocator allocator_;
+  ObSEArray<ObDatumRow *, 16> rows_;
+  int64_t idx_;
+};
+
+class TestTxDataCache : public ::testing::Test
+{
+public:
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_F(TestTxDataCache, tx_data_cache_key)
+{
+  const uint64_t tenant_id = 1001;
+  ObTxDataCacheKey key1(tenant_id, ObLSID(1001), ObTransID(100));
+  ObTxDataCacheKey key2(tenant_id, ObLSID(1001), ObTransID(100));
+  ObTxDataCacheKey key3(tenant_id, ObLSID(1002), ObTransID(100));
+  ObTxDataCacheKey invalid_key;
+  ASSERT_TRUE(key1.is_valid());
+  ASSERT_FALSE(invalid_key.is_valid());
+  ASSERT_TRUE(key1 == key2);
+  ASSERT_EQ(key1.hash(), key2.hash());
+  ASSERT_FALSE(key1 == key3);
+
+  char buf[sizeof(ObTxDataCacheKey)];
+  ObIKVCacheKey *copy_key = NULL;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, key1.deep_copy(buf, sizeof(buf) - 1, copy_key));
+  ASSERT_EQ(OB_INVALID_DATA, invalid_key.deep_copy(buf, sizeof(buf), copy_key));
+  ASSERT_EQ(OB_SUCCESS, key1.deep_copy(buf, sizeof(buf), copy_key));
+  ASSERT_TRUE(key1 == *copy_key);
+  ASSERT_EQ(tenant_id, copy_key->get_tenant_id());
+}
+
+TEST_F(TestTxDataCache, tx_data_cache_value)
+{
+  ObArenaAllocator allocator;
+  ObSliceAlloc slice_allocator;
+  ObTxData tx_data;
+  tx_data.tx_id_ = ObTransID(100);
+  tx_data.state_ = ObTxData::COMMIT;
+  tx_data.commit_version_.convert_for_tx(300);
+  tx_data.start_scn_.convert_for_tx(100);
+  tx_data.end_scn_.convert_for_tx(200);
+
+  ObTxDataCacheValue value;
+  ASSERT_FALSE(value.is_valid());
+  ASSERT_EQ(OB_SUCCESS, value.init(tx_data, allocator));
+  ASSERT_TRUE(value.is_valid());
+
+  // deep copy into kv cache buffer
+  char *buf = static_cast<char *>(allocator.alloc(value.size()));
+  ObIKVCacheValue *copy_value = NULL;
+  ASSERT_NE(nullptr, buf);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, value.deep_copy(buf, value.size() - 1, copy_value));
+  ASSERT_EQ(OB_SUCCESS, value.deep_copy(buf, value.size(), copy_value));
+  ASSERT_EQ(value.size(), copy_value->size());
+
+  ObTxData read_tx_data;
+  ASSERT_EQ(OB_SUCCESS, static_cast<ObTxDataCacheValue *>(copy_value)->get_tx_data(
+      tx_data.tx_id_, read_tx_data, slice_allocator));
+  ASSERT_EQ(tx_data.tx_id_, read_tx_data.tx_id_);
+  ASSERT_EQ(tx_data.state_, read_tx_data.state_);
+  ASSERT_EQ(tx_data.commit_version_, read_tx_data.commit_version_);
+  ASSERT_EQ(tx_data.start_scn_, read_tx_data.start_scn_);
+  ASSERT_EQ(tx_data.end_scn_, read_tx_data.end_scn_);
+  ASSERT_EQ(nullptr, read_tx_data.undo_status_list_.head_);
+}
+
+TEST_F(TestTxDataCache, tx_data_bf_cache_key)
+{
+  const uint64_t tenant_id = 1001;
+  ObITable::TableKey table_key;
+  table_key.table_type_ = ObITable::MINI_SSTABLE;
+  table_key.tablet_id_ = ObTabletID(ObTabletID::LS_TX_DATA_TABLET_ID);
+  table_key.scn_range_.start_scn_.convert_for_tx(100);
+  table_key.scn_range_.end_scn_.convert_for_tx(200);
+
+  ObTxDataBFCacheKey key1(tenant_id, ObLSID(1001), table_key, 12345);
+  ObTxDataBFCacheKey key2(tenant_id, ObLSID(1001), table_key, 12345);
+  // the same table key with different data
+  ObTxDataBFCacheKey key3(tenant_id, ObLSID(1001), table_key, 54321);
+  ASSERT_TRUE(key1.is_valid());
+  ASSERT_TRUE(key1 == key2);
+  ASSERT_EQ(key1.hash(), key2.hash());
+  ASSERT_FALSE(key1 == key3);
+
+  char buf[sizeof(ObTxDataBFCacheKey)];
+  ObIKVCacheKey *copy_key = NULL;
+  ASSERT_EQ(OB_SUCCESS, key1.deep_copy(buf, sizeof(buf), copy_key));
+  ASSERT_TRUE(key1 == *copy_key);
+}
+
+TEST_F(TestTxDataCache, tx_data_bloom_filter)
+{
+  const int64_t tx_cnt = 10000;
+  ObBloomFilterCacheValue bf_value;
+  ASSERT_EQ(OB_SUCCESS, bf_value.init(1, tx_cnt));
+  for (int64_t i = 1; i <= tx_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, bf_value.insert(ObTxDataBFCache::hash_tx_id(ObTransID(i * 2))));
+  }
+
+  bool is_contain = false;
+  int64_t false_positive_cnt = 0;
+  for (int64_t i = 1; i <= tx_cnt; i++) {
+    // no false negative
+    ASSERT_EQ(OB_SUCCESS, bf_value.may_contain(ObTxDataBFCache::hash_tx_id(ObTransID(i * 2)), is_contain));
+    ASSERT_TRUE(is_contain);
+    ASSERT_EQ(OB_SUCCESS, bf_value.may_contain(ObTxDataBFCache::hash_tx_id(ObTransID(i * 2 + 1)), is_contain));
+    false_positive_cnt += is_contain ? 1 : 0;
+  }
+  // the false positive probability is 1%
+  ASSERT_LT(false_positive_cnt, tx_cnt * 5 / 100);
+}
+
+TEST_F(TestTxDataCache, build_tx_data_bloom_filter)
+{
+  MockTxDataRowIterator row_iter;
+  // tx 2 is splitted into 3 rows, and the last row is the commit versions
+  ASSERT_EQ(OB_SUCCESS, row_iter.add_row(2));
+  ASSERT_EQ(OB_SUCCESS, row_iter.add_row(2));
+  ASSERT_EQ(OB_SUCCESS, row_iter.add_row(2));
+  ASSERT_EQ(OB_SUCCESS, row_iter.add_row(4));
+  ASSERT_EQ(OB_SUCCESS, row_iter.add_row(6));
+  ASSERT_EQ(OB_SUCCESS, row_iter.add_row(INT64_MAX));
+
+  ObBloomFilterCacheValue bf_value;
+  ASSERT_EQ(OB_NOT_INIT, ObTxDataBloomFilterBuilder::insert_tx_ids(row_iter, bf_value));
+  row_iter.idx_ = 0;
+  ASSERT_EQ(OB_SUCCESS, bf_value.init(1, row_iter.rows_.count()));
+  ASSERT_EQ(OB_SUCCESS, ObTxDataBloomFilterBuilder::insert_tx_ids(row_iter, bf_value));
+  // each tx is inserted once
+  ASSERT_EQ(3, bf_value.get_row_count());
+
+  bool is_contain = false;
+  for (int64_t tx_id = 2; tx_id <= 6; tx_id += 2) {
+    ASSERT_EQ(OB_SUCCESS, bf_value.may_contain(ObTxDataBFCache::hash_tx_id(ObTransID(tx_id)), is_contain));
+    ASSERT_TRUE(is_contain);
+  }
+}
+
+TEST_F(TestTxDataCache, tx_data_bf_cache_lookup)
+{
+  const uint64_t tenant_id = 1001;
+  ASSERT_EQ(OB_SUCCESS, getter.add_tenant(tenant_id, 2L * 1024L * 1024L, 1024L * 1024L * 1024L));
+  int ret = ObKVGlobalCache::get_instance().init(&getter, 1024, 1024L * 1024L * 1024L, lib::ACHUNK_SIZE);
+  ASSERT_TRUE(OB_SUCCESS == ret || OB_INIT_TWICE == ret);
+  ObTxDataBFCache bf_cache;
+  ASSERT_EQ(OB_SUCCESS, bf_cache.init("tx_data_bf_cache"));
+
+  ObITable::TableKey table_key;
+  table_key.table_type_ = ObITable::MINI_SSTABLE;
+  table_key.tablet_id_ = ObTabletID(ObTabletID::LS_TX_DATA_TABLET_ID);
+  table_key.scn_range_.start_scn_.convert_for_tx(100);
+  table_key.scn_range_.end_scn_.convert_for_tx(200);
+  ObTxDataBFCacheKey key(tenant_id, ObLSID(1001), table_key, 12345);
+  ObTxDataBFCacheKey other_key(tenant_id, ObLSID(1001), table_key, 54321);
+
+  // not built yet, the sstable should be read
+  bool is_contain = false;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, bf_cache.may_contain(key, ObTransID(2), is_contain));
+  ASSERT_TRUE(is_contain);
+
+  const int64_t tx_cnt = 1000;
+  ObBloomFilterCacheValue bf_value;
+  ASSERT_EQ(OB_SUCCESS, bf_value.init(1, tx_cnt));
+  for (int64_t i = 1; i <= tx_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, bf_value.insert(ObTxDataBFCache::hash_tx_id(ObTransID(i * 2))));
+  }
+  ObBloomFilterCacheValue invalid_bf_value;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, bf_cache.put_bloom_filter(key, invalid_bf_value));
+  ASSERT_EQ(OB_SUCCESS, bf_cache.put_bloom_filter(key, bf_value));
+
+  int64_t false_positive_cnt = 0;
+  for (int64_t i = 1; i <= tx_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, bf_cache.may_contain(key, ObTransID(i * 2), is_contain));
+    ASSERT_TRUE(is_contain);
+    ASSERT_EQ(OB_SUCCESS, bf_cache.may_contain(key, ObTransID(i * 2 + 1), is_contain));
+    false_positive_cnt += is_contain ? 1 : 0;
+  }
+  ASSERT_LT(false_positive_cnt, tx_cnt * 5 / 100);
+  // the sstable with the same table key but different data
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, bf_cache.may_contain(other_key, ObTransID(2), is_contain));
+
+  bf_cache.destroy();
+  ObKVGlobalCache::get_instance().destroy();
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_tx_data_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_data_cache.log");
+  OB_LOGGER.set_log_level("INFO");
+  STORAGE_LOG(INFO, "begin unittest: test tx data cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}